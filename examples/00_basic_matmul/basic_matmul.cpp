@@ -26,6 +26,7 @@
 #include "catlass/gemm/block/block_mmad.hpp"
 #include "catlass/gemm/block/block_swizzle.hpp"
 #include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
 #include "catlass/gemm/kernel/basic_matmul.hpp"
 #include "catlass/gemm/gemm_type.hpp"
 #include "catlass/layout/layout.hpp"
@@ -33,55 +34,39 @@
 using namespace Catlass;
 using fp16_t = op::fp16_t;
 
-template <
-    class LayoutA,
-    class LayoutB,
-    class LayoutC
->
-CATLASS_GLOBAL
-void BasicMatmul(
-    GemmCoord problemShape,
-    GM_ADDR gmA, LayoutA layoutA,
-    GM_ADDR gmB, LayoutB layoutB,
-    GM_ADDR gmC, LayoutC layoutC
-)
-{
-    using ArchTag = Arch::AtlasA2;
-    using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<true>;
-    using L1TileShape = GemmShape<128, 256, 256>;
-    using L0TileShape = GemmShape<128, 256, 64>;
-
-    using AType = Gemm::GemmType<half, LayoutA>;
-    using BType = Gemm::GemmType<half, LayoutB>;
-    using CType = Gemm::GemmType<half, LayoutC>;
-
-    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
-    using BlockEpilogue = void;
-
-    if (problemShape.m() > problemShape.n()) {
-        // Swizzle offset is 3 and direction is 0.
-        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
-
-        // kernel level
-        using MatmulKernel = Gemm::Kernel::BasicMatmul<BlockMmad, BlockEpilogue, BlockScheduler>;
-
-        typename MatmulKernel::Params params{problemShape, gmA, layoutA, gmB, layoutB, gmC, layoutC};
-
-        // call a kernel
-        MatmulKernel matmul;
-        matmul(params);
-    } else {
-        // Swizzle offset is 3 and direction is 1.
-        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
+using ArchTag = Arch::AtlasA2;
+using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<true>;
+using L1TileShape = GemmShape<128, 256, 256>;
+using L0TileShape = GemmShape<128, 256, 64>;
 
-        // kernel level
-        using MatmulKernel = Gemm::Kernel::BasicMatmul<BlockMmad, BlockEpilogue, BlockScheduler>;
+using LayoutA = layout::RowMajor;
+using LayoutB = layout::RowMajor;
+using LayoutC = layout::RowMajor;
+using AType = Gemm::GemmType<half, LayoutA>;
+using BType = Gemm::GemmType<half, LayoutB>;
+using CType = Gemm::GemmType<half, LayoutC>;
 
-        typename MatmulKernel::Params params{problemShape, gmA, layoutA, gmB, layoutB, gmC, layoutC};
+using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+using BlockEpilogue = void;
 
-        // call a kernel
-        MatmulKernel matmul;
-        matmul(params);
+template <class BlockScheduler>
+void LaunchBasicMatmul(aclrtStream stream, uint32_t blockDim, GemmCoord problemShape,
+    uint8_t *deviceA, LayoutA layoutA, uint8_t *deviceB, LayoutB layoutB, uint8_t *deviceC, LayoutC layoutC)
+{
+    // kernel level
+    using MatmulKernel = Gemm::Kernel::BasicMatmul<BlockMmad, BlockEpilogue, BlockScheduler>;
+    // device level
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    typename MatmulKernel::Arguments arguments{problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC};
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+    // BasicMatmul needs no workspace.
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, nullptr, stream, blockDim) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
     }
 }
 
@@ -161,8 +146,15 @@ void Run(Options const &options)
     // Get the number of cube cores of the current hardware
     auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
 
-    BasicMatmul<<<aicCoreNum, nullptr, stream>>>(
-        options.problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC);
+    if (m > n) {
+        // Swizzle offset is 3 and direction is 0.
+        LaunchBasicMatmul<Gemm::Block::GemmIdentityBlockSwizzle<3, 0>>(
+            stream, aicCoreNum, options.problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC);
+    } else {
+        // Swizzle offset is 3 and direction is 1.
+        LaunchBasicMatmul<Gemm::Block::GemmIdentityBlockSwizzle<3, 1>>(
+            stream, aicCoreNum, options.problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC);
+    }
     ACL_CHECK(aclrtSynchronizeStream(stream));
 
     std::vector<fp16_t> hostC(lenC);
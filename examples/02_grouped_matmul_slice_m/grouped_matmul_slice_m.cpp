@@ -28,6 +28,7 @@
 #include "catlass/gemm/block/block_swizzle.hpp"
 #include "catlass/gemm/dispatch_policy.hpp"
 #include "catlass/gemm/kernel/grouped_matmul_slice_m.hpp"
+#include "catlass/gemm/kernel/prefetch_l2.hpp"
 #include "catlass/gemm/gemm_type.hpp"
 #include "catlass/layout/layout.hpp"
 
@@ -41,6 +42,7 @@ template <
 >
 CATLASS_GLOBAL
 void GroupedMatmulSliceM(
+    uint64_t fftsAddr,
     GemmCoord problemShape,
     uint32_t problemCount, GM_ADDR gmGroupList,
     GM_ADDR gmA, LayoutA layoutA,
@@ -48,6 +50,8 @@ void GroupedMatmulSliceM(
     GM_ADDR gmC, LayoutC layoutC
 )
 {
+    // Set FFTS address
+    AscendC::SetSyncBaseAddr(fftsAddr);
     if (problemShape.k() > problemShape.n()) {
         constexpr uint32_t preloadStages = 1;
         constexpr uint32_t l1Stages = 2;
@@ -75,7 +79,11 @@ void GroupedMatmulSliceM(
         using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
 
         // kernel level
-        using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceM<BlockMmad, BlockEpilogue, BlockScheduler, int64_t>;
+        // AIV cores prefetch the B matrix of the next group into L2
+        constexpr uint32_t computeLength = 32 * 1024 / sizeof(half);
+        using PrologueB = Gemm::Kernel::PrefetchGmToL2<ArchTag, half, computeLength>;
+        using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceM<BlockMmad, BlockEpilogue, BlockScheduler, int64_t,
+            PrologueB>;
 
         typename MatmulKernel::Params params{
             problemShape, problemCount, gmGroupList, gmA, layoutA, gmB, layoutB, gmC, layoutC
@@ -111,7 +119,11 @@ void GroupedMatmulSliceM(
         using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
 
         // kernel level
-        using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceM<BlockMmad, BlockEpilogue, BlockScheduler, int64_t>;
+        // AIV cores prefetch the B matrix of the next group into L2
+        constexpr uint32_t computeLength = 32 * 1024 / sizeof(half);
+        using PrologueB = Gemm::Kernel::PrefetchGmToL2<ArchTag, half, computeLength>;
+        using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceM<BlockMmad, BlockEpilogue, BlockScheduler, int64_t,
+            PrologueB>;
 
         typename MatmulKernel::Params params{
             problemShape, problemCount, gmGroupList, gmA, layoutA, gmB, layoutB, gmC, layoutC
@@ -209,10 +221,16 @@ void Run(Options const &options)
     LayoutB layoutB{k, n};
     LayoutC layoutC{m, n};
 
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
     // Get the number of cube cores of the current hardware
     auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
 
     GroupedMatmulSliceM<<<aicCoreNum, nullptr, stream>>>(
+        fftsAddr,
         options.problemShape, problemCount, deviceGroupList,
         deviceA, layoutA,
         deviceB, layoutB,
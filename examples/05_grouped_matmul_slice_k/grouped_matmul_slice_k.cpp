@@ -28,6 +28,7 @@
 #include "catlass/gemm/block/block_swizzle.hpp"
 #include "catlass/gemm/dispatch_policy.hpp"
 #include "catlass/gemm/kernel/grouped_matmul_slice_k.hpp"
+#include "catlass/gemm/kernel/prefetch_l2.hpp"
 #include "catlass/gemm/gemm_type.hpp"
 #include "catlass/layout/layout.hpp"
 
@@ -41,6 +42,7 @@ template <
 >
 CATLASS_GLOBAL
 void GroupedMatmul(
+    uint64_t fftsAddr,
     GemmCoord problemShape,
     uint32_t problemCount, GM_ADDR gmGroupList,
     GM_ADDR gmA, LayoutA layoutA,
@@ -48,6 +50,8 @@ void GroupedMatmul(
     GM_ADDR gmC, LayoutC layoutC
 )
 {
+    // Set FFTS address
+    AscendC::SetSyncBaseAddr(fftsAddr);
     constexpr uint32_t preloadStages = 1;
     constexpr uint32_t l1Stages = 2;
     constexpr uint32_t l0AStages = 4;
@@ -74,7 +78,11 @@ void GroupedMatmul(
     using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
 
     // kernel level
-    using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceK<BlockMmad, BlockEpilogue, BlockScheduler, int64_t>;
+    // AIV cores prefetch the B matrix of the next group into L2
+    constexpr uint32_t computeLength = 32 * 1024 / sizeof(half);
+    using PrologueB = Gemm::Kernel::PrefetchGmToL2<ArchTag, half, computeLength>;
+    using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceK<BlockMmad, BlockEpilogue, BlockScheduler, int64_t,
+        PrologueB>;
 
     typename MatmulKernel::Params params{
         problemShape, problemCount, gmGroupList, gmA, layoutA, gmB, layoutB, gmC, layoutC
@@ -173,10 +181,16 @@ void Run(Options const &options)
     LayoutB layoutB{k, n};
     LayoutC layoutC{m, n};
 
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
     // Get the number of cube cores of the current hardware
     auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
 
     GroupedMatmul<LayoutA, LayoutB, LayoutC><<<aicCoreNum, nullptr, stream>>>(
+        fftsAddr,
         options.problemShape,
         problemCount, deviceGroupList,
         deviceA, layoutA,
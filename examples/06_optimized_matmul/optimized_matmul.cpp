@@ -45,19 +45,14 @@ template <
     /// GemmType type for Bias operand
     class BiasType = void
 >
-struct TileCopyOpt : public Catlass::Gemm::Tile::TileCopy<ArchTag, AType, BType, CType, BiasType> {
-    using Base = Catlass::Gemm::Tile::TileCopy<ArchTag, AType, BType, CType, BiasType>;
+struct TileCopyOpt : public Catlass::Gemm::Tile::TileCopyAdaptive<ArchTag, AType, BType, CType, BiasType> {
+    using Base = Catlass::Gemm::Tile::TileCopyAdaptive<ArchTag, AType, BType, CType, BiasType>;
     using ElementA = typename Base::ElementA;
     using ElementB = typename Base::ElementB;
     using ElementAccumulator = typename Base::ElementAccumulator;
 
-    // When matrix A is row-major, if the number of rows in matrix A is less than 16, 
-    // using the CopyGmToL1IntervalDataCopy method can improve the transfer efficiency.
-    // The situation is similar for matrix B. If the above conditions are met, 
-    // please uncomment the following and comment out the original matrix A transfer method
-
-    // using CopyGmToL1A = Gemm::Tile::CopyGmToL1IntervalDataCopy<ArchTag, AType>;
-
+    // TileCopyAdaptive switches to CopyGmToL1IntervalDataCopy per tile when the tile has few rows (A row-major)
+    // or few columns (B column-major), and for strides the padding cost model leaves in place.
     using CopyGmToL1A = typename Base::CopyGmToL1A;
     using CopyGmToL1B = typename Base::CopyGmToL1B;
 
@@ -153,24 +148,18 @@ size_t GetWorkspaceLen(Layout layout, size_t blockRows, size_t blockCols)
         RoundUp(static_cast<size_t>(layout.shape(1)), blockCols);
 }
 
-bool IsNeedPadding(layout::RowMajor layout, uint32_t align)
+// The padding prologue is only worth its extra pass over the operand when its tiles are loaded often enough,
+// unaligned and large strides are otherwise read in place by the adaptive GM to L1 copy.
+bool IsNeedPadding(layout::RowMajor layout, uint32_t tileRows, uint32_t tileCols, uint32_t reuseCount)
 {
-    // If the stride is greater than 65536, padding is required to reduce the stride.
-    if (layout.stride(0) < 65536) {
-        return layout.stride(0) % align != 0;
-    } else {
-        return true;
-    }
+    return Gemm::Tile::OperandPaddingCostModel::NeedPadding(
+        tileRows, tileCols, layout.stride(0), sizeof(fp16_t), reuseCount);
 }
 
-bool IsNeedPadding(layout::ColumnMajor layout, uint32_t align)
+bool IsNeedPadding(layout::ColumnMajor layout, uint32_t tileRows, uint32_t tileCols, uint32_t reuseCount)
 {
-    // If the stride is greater than 65536, padding is required to reduce the stride.
-    if (layout.stride(1) < 65536) {
-        return layout.stride(1) % align != 0;
-    } else {
-        return true;
-    }
+    return Gemm::Tile::OperandPaddingCostModel::NeedPadding(
+        tileCols, tileRows, layout.stride(1), sizeof(fp16_t), reuseCount);
 }
 
 void Run(Options const &options)
@@ -193,8 +182,6 @@ void Run(Options const &options)
     size_t sizeB = lenB * sizeof(fp16_t);
     size_t sizeC = lenC * sizeof(fp16_t);
 
-    constexpr uint32_t alignByByte = 512;
-    constexpr uint32_t alignByElement = alignByByte / sizeof(fp16_t);
     using ArchTag = Arch::AtlasA2;
     using ElementA = half;
     using ElementB = half;
@@ -224,8 +211,6 @@ void Run(Options const &options)
     LayoutA layoutA{m, k};
     LayoutB layoutB{k, n};
     LayoutC layoutC{m, n};
-    bool isNeedPaddingA = IsNeedPadding(layoutA, alignByElement);
-    bool isNeedPaddingB = IsNeedPadding(layoutB, alignByElement);
 
     // if LayoutA and LayoutB is both ColumnMajor,
     // L1TileShape using GemmShape<256, 128, 256> can achieve better performance.
@@ -234,6 +219,10 @@ void Run(Options const &options)
     using L0TileShape = std::conditional_t<std::is_same_v<LayoutA, layout::ColumnMajor> &&
     std::is_same_v<LayoutB, layout::ColumnMajor>, GemmShape<256, 128, 64>, GemmShape<128, 256, 64>>;
 
+    // A tile of A is loaded once per N tile and a tile of B once per M tile.
+    bool isNeedPaddingA = IsNeedPadding(layoutA, L1TileShape::M, L1TileShape::K, CeilDiv(n, L1TileShape::N));
+    bool isNeedPaddingB = IsNeedPadding(layoutB, L1TileShape::K, L1TileShape::N, CeilDiv(m, L1TileShape::M));
+
     size_t sizeWA = GetWorkspaceLen(layoutA, L1TileShape::M, L1TileShape::K) * sizeof(fp16_t);
     size_t sizeWB = GetWorkspaceLen(layoutB, L1TileShape::K, L1TileShape::N) * sizeof(fp16_t);
 
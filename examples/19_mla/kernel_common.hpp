@@ -17,6 +17,14 @@ constexpr uint32_t PV_READY_ID = 3;
 constexpr uint32_t BLOCK_SIZE = 16;
 constexpr uint32_t TMP_SIZE = 65536;
 constexpr uint32_t TMP_SIZE_DECODER = 32768;
+// Per core strides (in elements) of the scratch buffers s, p, oTmp and oUpdate in the workspace. The tp1
+// specialized kernel keeps four s and two p tiles per core in flight.
+constexpr uint32_t S_CORE_STRIDE = TMP_SIZE_DECODER;
+constexpr uint32_t S_CORE_STRIDE_TP1 = TMP_SIZE_DECODER * 4;
+constexpr uint32_t P_CORE_STRIDE = TMP_SIZE;
+constexpr uint32_t P_CORE_STRIDE_TP1 = TMP_SIZE * 2;
+constexpr uint32_t O_TMP_CORE_STRIDE = TMP_SIZE * 2;
+constexpr uint32_t O_UPDATE_CORE_STRIDE = TMP_SIZE;
 
 constexpr int32_t TILING_BATCH = 0;
 constexpr int32_t TILING_NUMHEADS = 1;
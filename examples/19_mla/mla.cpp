@@ -22,6 +22,7 @@
 #include "fp16_t.h"
 #include "bfloat16.h"
 #include "mla_tiling.cpp"
+#include "mla_workspace.hpp"
 
 using namespace std;
 using fp16_t = op::fp16_t;
@@ -234,26 +235,6 @@ void Run(const Options &options)
     ReadFile(dataPath + "/block_table.bin", blockTableHost, blockTableSize);
     ACL_CHECK(aclrtMemcpy(blockTableDevice, blockTableSize, blockTableHost, blockTableSize, ACL_MEMCPY_HOST_TO_DEVICE));
 
-    // Allocate matrices in device memory for workspace.
-    uint8_t *sDevice;
-    ACL_CHECK(aclrtMalloc((void **)(&sDevice),
-                          aicCoreNum * MLATiling::WORKSPACE_BLOCK_SIZE_DB * sizeof(float) * MLATiling::NUM2,
-                          ACL_MEM_MALLOC_HUGE_FIRST));
-
-    uint8_t *pDevice;
-    ACL_CHECK(aclrtMalloc((void **)(&pDevice),
-                          aicCoreNum * MLATiling::WORKSPACE_BLOCK_SIZE_DB * sizeof(fp16_t) * MLATiling::NUM2,
-                          ACL_MEM_MALLOC_HUGE_FIRST));
-
-    uint8_t *oTmpDevice;
-    ACL_CHECK(aclrtMalloc((void **)(&oTmpDevice),
-                          aicCoreNum * MLATiling::WORKSPACE_BLOCK_SIZE_DB * sizeof(float) * MLATiling::NUM2,
-                          ACL_MEM_MALLOC_HUGE_FIRST));
-
-    uint8_t *globaloDevice;
-    ACL_CHECK(aclrtMalloc((void **)(&globaloDevice), aicCoreNum * MLATiling::WORKSPACE_BLOCK_SIZE_DB * sizeof(float),
-                          ACL_MEM_MALLOC_HUGE_FIRST));
-
     uint8_t *oDevice{nullptr};
     ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&oDevice), static_cast<size_t>(qoSize), ACL_MEM_MALLOC_HUGE_FIRST));
 
@@ -281,15 +262,32 @@ void Run(const Options &options)
 
     ACL_CHECK(aclrtMemcpy(tilingDevice, tilingSize, tilingHost, tilingSize, ACL_MEMCPY_HOST_TO_DEVICE));
 
-    uint32_t kvSplitCoreNum = *((uint32_t *)tilingHost + MLATiling::TILING_KVCORENUM);
-    uint64_t oFdSize = embeddingSize * numHeads * numTokens * kvSplitCoreNum * sizeof(float);
-    uint64_t lSize = numTokens * numHeads * kvSplitCoreNum * sizeof(float);
-
-    uint8_t *oCoreTmpDevice;
-    ACL_CHECK(aclrtMalloc((void **)(&oCoreTmpDevice), oFdSize, ACL_MEM_MALLOC_HUGE_FIRST));
-
-    uint8_t *lDevice;
-    ACL_CHECK(aclrtMalloc((void **)(&lDevice), lSize, ACL_MEM_MALLOC_HUGE_FIRST));
+    // The workspace plan keeps its arena across calls. In a decode loop, keep the plan and call Prepare before
+    // every launch, the arena is only reallocated when a step needs more than any step before.
+    MLAWorkspace::WorkspacePlan workspacePlan(
+        [](uint64_t size) {
+            uint8_t *ptr{nullptr};
+            ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&ptr), size, ACL_MEM_MALLOC_HUGE_FIRST));
+            return ptr;
+        },
+        [](uint8_t *ptr) { ACL_CHECK(aclrtFree(ptr)); });
+    MLAWorkspace::MLAWorkspaceParams workspaceParams;
+    workspaceParams.blockDim = blockDim;
+    workspaceParams.numTokens = numTokens;
+    workspaceParams.numHeads = numHeads;
+    workspaceParams.embeddingSize = embeddingSize;
+    workspaceParams.kvSplitCoreNum = *((uint32_t *)tilingHost + MLATiling::TILING_KVCORENUM);
+    workspaceParams.tp1Spec = (specStraKey != 0);
+    if (!workspacePlan.Prepare(workspaceParams)) {
+        cerr << "[ERROR] Failed to allocate the MLA workspace." << endl;
+        return;
+    }
+    uint8_t *sDevice = workspacePlan.Buffer(MLAWorkspace::S);
+    uint8_t *pDevice = workspacePlan.Buffer(MLAWorkspace::P);
+    uint8_t *oTmpDevice = workspacePlan.Buffer(MLAWorkspace::O_TMP);
+    uint8_t *globaloDevice = workspacePlan.Buffer(MLAWorkspace::O_UPDATE);
+    uint8_t *oCoreTmpDevice = workspacePlan.Buffer(MLAWorkspace::O_CORE_TMP);
+    uint8_t *lDevice = workspacePlan.Buffer(MLAWorkspace::L);
 
     // Prepare FFTS address
     uint64_t fftsAddr{0};
@@ -353,12 +351,7 @@ void Run(const Options &options)
     FreeMem(blockTableHost, blockTableDevice);
     aclrtFree(oDevice);
     aclrtFree(tilingDevice);
-    aclrtFree(sDevice);
-    aclrtFree(pDevice);
-    aclrtFree(oTmpDevice);
-    aclrtFree(globaloDevice);
-    aclrtFree(oCoreTmpDevice);
-    aclrtFree(lDevice);
+    workspacePlan.Release();
     aclrtFreeHost(tilingHost);
     aclrtFreeHost(qNtokens);
     aclrtFreeHost(qSeq);
@@ -252,7 +252,7 @@ public:
                     uint64_t kvOffset = (uint64_t)blockTableId * blockSize * strideKV;
                     uint64_t kvOffsetRope = (uint64_t)blockTableId * blockSize * strideKVRope;
                     uint64_t gSOffset =
-                        (uint64_t)coreIdx * TMP_SIZE_DECODER + (uint64_t)qkPingPongFlag * TMP_SIZE_DECODER / 2;
+                        (uint64_t)coreIdx * S_CORE_STRIDE + (uint64_t)qkPingPongFlag * TMP_SIZE_DECODER / 2;
                     // Calculate a Q * K^T in advance
                     blockMmadQK(
                         gQ[gQOffset],
@@ -276,8 +276,8 @@ public:
                     LayoutOTmp layoutOTmp(rowNumRound, embedRound);
                     GemmCoord actualBlockShapePV{rowNum, embed, vSeqTile};
                     uint32_t pvPingPongFlag = (nIdx - 1) % 2;
-                    uint64_t gPOffset = (uint64_t)coreIdx * TMP_SIZE + (uint64_t)pvPingPongFlag * TMP_SIZE / 2;
-                    uint64_t gOTmpOffset = (uint64_t)coreIdx * TMP_SIZE * 2 + (uint64_t)pvPingPongFlag * TMP_SIZE;
+                    uint64_t gPOffset = (uint64_t)coreIdx * P_CORE_STRIDE + (uint64_t)pvPingPongFlag * TMP_SIZE / 2;
+                    uint64_t gOTmpOffset = (uint64_t)coreIdx * O_TMP_CORE_STRIDE + (uint64_t)pvPingPongFlag * TMP_SIZE;
                     // Calculate P * V
                     blockMmadPV(
                         gP[gPOffset],
@@ -456,9 +456,9 @@ public:
                     LayoutS layoutS(rowNumRound, kSeqTile, kSeqTileRound);
                     GemmCoord actualBlockShapeQK{rowNum, kSeqTile, embedRound};
                     uint32_t softmaxPingPongFlag = nIdx % 2;
-                    uint64_t gmOffsetP = (uint64_t)coreIdx * TMP_SIZE + softmaxPingPongFlag * TMP_SIZE / 2;
+                    uint64_t gmOffsetP = (uint64_t)coreIdx * P_CORE_STRIDE + softmaxPingPongFlag * TMP_SIZE / 2;
                     uint64_t gmOffsetS =
-                        (uint64_t)coreIdx * TMP_SIZE_DECODER + softmaxPingPongFlag * TMP_SIZE_DECODER / 2;
+                        (uint64_t)coreIdx * S_CORE_STRIDE + softmaxPingPongFlag * TMP_SIZE_DECODER / 2;
                     // Softmax one-stage calculation
                     epilogueMLASoftmax(
                         gP[gmOffsetP], gS[gmOffsetS],
@@ -483,8 +483,8 @@ public:
                     LayoutUpdate layoutUpdate(rowNum, embed, embedRound);
                     GemmCoord actualBlockShapePV{rowNum, embed, vSeqTile};
                     uint32_t rescaleOPingPongFlag = (nIdx - 1) % 2;
-                    uint64_t gmOffsetOTmp = (uint64_t)(coreIdx * TMP_SIZE * 2 + rescaleOPingPongFlag * TMP_SIZE);
-                    uint64_t gmOffsetUpdate = (uint64_t)(coreIdx * TMP_SIZE);
+                    uint64_t gmOffsetOTmp = (uint64_t)(coreIdx * O_TMP_CORE_STRIDE + rescaleOPingPongFlag * TMP_SIZE);
+                    uint64_t gmOffsetUpdate = (uint64_t)(coreIdx * O_UPDATE_CORE_STRIDE);
                     uint32_t isLastNTile = (nIdx == nLoop) ? 1 : 0;
                     // Softmax two-stage update
                     epilogueMLARescaleO(
@@ -212,7 +212,7 @@ public:
                     GemmCoord actualBlockShapeQK{rowNum, stackSeqTile, embed + embedRope};
                     uint32_t gSPingPongFlag = (nIdx / UNIT_BLOCK_STACK_NUM) % 2;
                     uint64_t gmOffseS =
-                        (uint64_t)coreIdx * TMP_SIZE_DECODER * 4 + (uint64_t)gSPingPongFlag * TMP_SIZE_DECODER * 2;
+                        (uint64_t)coreIdx * S_CORE_STRIDE_TP1 + (uint64_t)gSPingPongFlag * TMP_SIZE_DECODER * 2;
                     // Calculate Q * K^T
                     blockMmadQK(gQ[gmOffsetQ], gQRope[gmOffsetQRope], gK, gKRope,
                                 gblockTable[gmOffsetBlockTable + startKV / blockSize],
@@ -233,7 +233,7 @@ public:
                     LayoutOTmp layoutOTmp(rowNumRound, embedRound);
                     GemmCoord actualBlockShapePV{rowNum, embed, stackSeqTile};
                     uint32_t gPPingPongFlag = (nIdx / UNIT_BLOCK_STACK_NUM - 1) % 2;
-                    uint64_t gmOffseP = (uint64_t)coreIdx * TMP_SIZE * 2 + (uint64_t)gPPingPongFlag * TMP_SIZE;
+                    uint64_t gmOffseP = (uint64_t)coreIdx * P_CORE_STRIDE_TP1 + (uint64_t)gPPingPongFlag * TMP_SIZE;
                     uint64_t gmOffseOtmp = gmOffseP;
                     // Calculate P * V
                     blockMmadPV(gP[gmOffseP], gK, gblockTable[gmOffsetBlockTable + startKV / blockSize],
@@ -284,7 +284,7 @@ public:
                     GemmCoord actualBlockShapeQK{rowNum, stackSeqTile, embed + embedRope};
                     uint32_t gSPingPongFlag = (nIdx / UNIT_BLOCK_STACK_NUM) % 2;
                     uint64_t gmOffseS =
-                        (uint64_t)coreIdx * TMP_SIZE_DECODER * 4 + (uint64_t)gSPingPongFlag * TMP_SIZE_DECODER * 2;
+                        (uint64_t)coreIdx * S_CORE_STRIDE_TP1 + (uint64_t)gSPingPongFlag * TMP_SIZE_DECODER * 2;
                     // Calculate Q * K^T
                     blockMmadQK(gQ[gmOffsetQ], gQRope[gmOffsetQRope], gK, gKRope, gblockTable[gmOffsetBlockTable],
                                 gS[gmOffseS], layoutQ, layoutQRope, layoutK, layoutKRope, layoutS, actualBlockShapeQK,
@@ -304,7 +304,7 @@ public:
                     LayoutOTmp layoutOTmp(rowNumRound, embedRound);
                     GemmCoord actualBlockShapePV{rowNum, embed, stackSeqTile};
                     uint32_t gPPingPongFlag = (nIdx / UNIT_BLOCK_STACK_NUM - 1) % 2;
-                    uint64_t gmOffseP = (uint64_t)coreIdx * TMP_SIZE * 2 + (uint64_t)gPPingPongFlag * TMP_SIZE;
+                    uint64_t gmOffseP = (uint64_t)coreIdx * P_CORE_STRIDE_TP1 + (uint64_t)gPPingPongFlag * TMP_SIZE;
                     uint64_t gmOffseOtmp = gmOffseP;
                     // Calculate P * V
                     blockMmadPV(gP[gmOffseP], gK, gblockTable[gmOffsetBlockTable], gOTmp[gmOffseOtmp], layoutP, layoutV,
@@ -449,10 +449,10 @@ public:
                     LayoutP layoutP(rowNum, stackSeqTile, stackSeqTileRound);
                     LayoutS layoutS(rowNum, stackSeqTile, stackSeqTileRound);
                     GemmCoord actualBlockShapeQK{rowNum, stackSeqTile, embed};
-                    uint32_t gmOffsetP = (uint64_t)coreIdx * TMP_SIZE * 2 +
+                    uint32_t gmOffsetP = (uint64_t)coreIdx * P_CORE_STRIDE_TP1 +
                                          (uint64_t)subBlockIdx * rowNum / 2 * stackSeqTileRound +
                                          (uint64_t)((nIdx / UNIT_BLOCK_STACK_NUM) % 2) * TMP_SIZE;
-                    uint32_t gmOffsetS = (int64_t)coreIdx * TMP_SIZE_DECODER * 4 +
+                    uint32_t gmOffsetS = (int64_t)coreIdx * S_CORE_STRIDE_TP1 +
                                          (int64_t)subBlockIdx * rowNum / 2 * stackSeqTileRound +
                                          (uint64_t)((nIdx / UNIT_BLOCK_STACK_NUM) % 2) * TMP_SIZE_DECODER * 2;
                     // Softmax one-stage calculation
@@ -476,8 +476,8 @@ public:
                     GemmCoord actualBlockShapePV{rowNum, embed, stackSeqTile};
                     uint32_t isLastNTile = (nIdx >= nLoop) ? 1 : 0;
                     uint32_t rescaleOPingPongFlag = (nIdx / UNIT_BLOCK_STACK_NUM - 1) % 2;
-                    uint64_t gmOffsetOTmp = (uint64_t)(coreIdx * TMP_SIZE * 2 + rescaleOPingPongFlag * TMP_SIZE);
-                    uint64_t gmOffsetUpdate = (uint64_t)(coreIdx * TMP_SIZE);
+                    uint64_t gmOffsetOTmp = (uint64_t)(coreIdx * O_TMP_CORE_STRIDE + rescaleOPingPongFlag * TMP_SIZE);
+                    uint64_t gmOffsetUpdate = (uint64_t)(coreIdx * O_UPDATE_CORE_STRIDE);
                     // Softmax two-stage update
                     epilogueMLATP1RescaleO(gOTmp[gmOffsetOTmp], gOUpdate[gmOffsetUpdate], gO[gmOffsetO],
                                            gOCoreTmp[oFdOffset], gl[lOffset], layoutOTmp,
@@ -518,10 +518,10 @@ public:
                     LayoutP layoutP(rowNum, stackSeqTile, stackSeqTileRound);
                     LayoutS layoutS(rowNum, stackSeqTile, stackSeqTileRound);
                     GemmCoord actualBlockShapeQK{rowNum, stackSeqTile, embed};
-                    uint32_t gmOffsetP = (uint64_t)coreIdx * TMP_SIZE * 2 +
+                    uint32_t gmOffsetP = (uint64_t)coreIdx * P_CORE_STRIDE_TP1 +
                                          (uint64_t)subBlockIdx * rowNum / 2 * stackSeqTileRound +
                                          (uint64_t)((nIdx / UNIT_BLOCK_STACK_NUM) % 2) * TMP_SIZE;
-                    uint32_t gmOffsetS = (int64_t)coreIdx * TMP_SIZE_DECODER * 4 +
+                    uint32_t gmOffsetS = (int64_t)coreIdx * S_CORE_STRIDE_TP1 +
                                          (int64_t)subBlockIdx * rowNum / 2 * stackSeqTileRound +
                                          (uint64_t)((nIdx / UNIT_BLOCK_STACK_NUM) % 2) * TMP_SIZE_DECODER * 2;
                     // Softmax one-stage calculation
@@ -545,8 +545,8 @@ public:
                     GemmCoord actualBlockShapePV{rowNum, embed, stackSeqTile};
                     uint32_t isLastNTile = (nIdx >= nLoop) ? 1 : 0;
                     uint32_t rescaleOPingPongFlag = (nIdx / UNIT_BLOCK_STACK_NUM - 1) % 2;
-                    uint64_t gmOffsetOTmp = (uint64_t)(coreIdx * TMP_SIZE * 2 + rescaleOPingPongFlag * TMP_SIZE);
-                    uint64_t gmOffsetUpdate = (uint64_t)(coreIdx * TMP_SIZE);
+                    uint64_t gmOffsetOTmp = (uint64_t)(coreIdx * O_TMP_CORE_STRIDE + rescaleOPingPongFlag * TMP_SIZE);
+                    uint64_t gmOffsetUpdate = (uint64_t)(coreIdx * O_UPDATE_CORE_STRIDE);
                     // Softmax two-stage update
                     epilogueMLATP1RescaleO(gOTmp[gmOffsetOTmp], gOUpdate[gmOffsetUpdate], gO[gmOffsetO],
                                            gOCoreTmp[0], gl[0], layoutOTmp,
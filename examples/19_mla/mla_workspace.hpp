@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef MLA_WORKSPACE_HPP
+#define MLA_WORKSPACE_HPP
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+#include "kernel_common.hpp"
+
+// Workspace of the MLA kernels. The scratch buffers s, p, oTmp, oUpdate, oCoreTmp and l are carved out of one GM
+// arena with their exact sizes, one after the other, and the arena is kept by a plan that is reused across decode
+// steps. Every buffer is live for the whole launch: oCoreTmp and l are written by the main loop and read by flash
+// decoding, the others by every main loop iteration. So no two buffers share memory. Pure host code.
+namespace MLAWorkspace {
+
+constexpr uint64_t BUFFER_ALIGN = 512;
+
+inline uint64_t AlignUp(uint64_t value)
+{
+    return (value + BUFFER_ALIGN - 1) / BUFFER_ALIGN * BUFFER_ALIGN;
+}
+
+enum BufferId : uint32_t { S = 0, P, O_TMP, O_UPDATE, O_CORE_TMP, L, BUFFER_NUM };
+
+struct MLAWorkspaceParams {
+    uint32_t blockDim{0};
+    uint32_t numTokens{0};
+    uint32_t numHeads{0};
+    uint32_t embeddingSize{0};
+    uint32_t kvSplitCoreNum{1};
+    // Tp1 specialized kernel (numHeads 128), which keeps four s and two p tiles per core in flight.
+    bool tp1Spec{false};
+
+    bool operator==(MLAWorkspaceParams const &other) const
+    {
+        return blockDim == other.blockDim && numTokens == other.numTokens && numHeads == other.numHeads &&
+            embeddingSize == other.embeddingSize && kvSplitCoreNum == other.kvSplitCoreNum &&
+            tp1Spec == other.tp1Spec;
+    }
+};
+
+/// Sizes of the buffers in bytes, as indexed by the kernels (see the per core strides in kernel_common.hpp).
+/// oCoreTmp and l are only touched when the kv sequence is split across cores.
+inline std::array<uint64_t, BUFFER_NUM> GetBufferSizes(MLAWorkspaceParams const &params)
+{
+    constexpr uint64_t FLOAT_BYTES = 4;
+    constexpr uint64_t HALF_BYTES = 2;
+    uint64_t cores = params.blockDim;
+    std::array<uint64_t, BUFFER_NUM> sizes{};
+    sizes[S] = cores * (params.tp1Spec ? S_CORE_STRIDE_TP1 : S_CORE_STRIDE) * FLOAT_BYTES;
+    sizes[P] = cores * (params.tp1Spec ? P_CORE_STRIDE_TP1 : P_CORE_STRIDE) * HALF_BYTES;
+    sizes[O_TMP] = cores * O_TMP_CORE_STRIDE * FLOAT_BYTES;
+    sizes[O_UPDATE] = cores * O_UPDATE_CORE_STRIDE * FLOAT_BYTES;
+    if (params.kvSplitCoreNum > 1) {
+        uint64_t rows = static_cast<uint64_t>(params.numTokens) * params.numHeads * params.kvSplitCoreNum;
+        sizes[O_CORE_TMP] = rows * params.embeddingSize * FLOAT_BYTES;
+        sizes[L] = rows * FLOAT_BYTES;
+    }
+    return sizes;
+}
+
+struct MLAWorkspaceLayout {
+    std::array<uint64_t, BUFFER_NUM> sizes{};
+    std::array<uint64_t, BUFFER_NUM> offsets{};
+    uint64_t size{0};
+};
+
+/// Place the buffers back to back, each at a BUFFER_ALIGN aligned offset.
+inline MLAWorkspaceLayout MakeWorkspaceLayout(MLAWorkspaceParams const &params)
+{
+    MLAWorkspaceLayout layout;
+    layout.sizes = GetBufferSizes(params);
+    for (uint32_t id = 0; id < BUFFER_NUM; ++id) {
+        layout.offsets[id] = layout.size;
+        layout.size += AlignUp(layout.sizes[id]);
+    }
+    return layout;
+}
+
+/// Persistent workspace of an MLA op. Prepare is called before every launch, the layout is only recomputed when
+/// the parameters change (kvSplitCoreNum follows the longest kv sequence) and the arena only grows, so a decode
+/// loop allocates once. The device allocation is injected, so that the plan can be tested on the host.
+class WorkspacePlan {
+public:
+    using AllocFunc = std::function<uint8_t *(uint64_t)>;
+    using FreeFunc = std::function<void(uint8_t *)>;
+
+    WorkspacePlan(AllocFunc alloc, FreeFunc free) : alloc_(std::move(alloc)), free_(std::move(free)) {}
+
+    WorkspacePlan(WorkspacePlan const &) = delete;
+    WorkspacePlan &operator=(WorkspacePlan const &) = delete;
+
+    ~WorkspacePlan()
+    {
+        Release();
+    }
+
+    /// Returns false if the arena can not be allocated.
+    bool Prepare(MLAWorkspaceParams const &params)
+    {
+        if (!valid_ || !(params == params_)) {
+            params_ = params;
+            layout_ = MakeWorkspaceLayout(params);
+            valid_ = true;
+        }
+        if (layout_.size <= capacity_) {
+            return true;
+        }
+        Release();
+        arena_ = alloc_(layout_.size);
+        if (arena_ == nullptr) {
+            return false;
+        }
+        capacity_ = layout_.size;
+        return true;
+    }
+
+    /// Address of a buffer in the current layout. Empty buffers may point past the used bytes, the kernels do not
+    /// touch them.
+    uint8_t *Buffer(BufferId id) const
+    {
+        return arena_ + layout_.offsets[id];
+    }
+
+    MLAWorkspaceLayout const &Layout() const
+    {
+        return layout_;
+    }
+
+    uint64_t Capacity() const
+    {
+        return capacity_;
+    }
+
+    /// Free the arena, e.g. before resetting the device. It is allocated again by the next Prepare.
+    void Release()
+    {
+        if (arena_ != nullptr) {
+            free_(arena_);
+            arena_ = nullptr;
+        }
+        capacity_ = 0;
+    }
+
+private:
+    AllocFunc alloc_;
+    FreeFunc free_;
+    MLAWorkspaceParams params_{};
+    MLAWorkspaceLayout layout_{};
+    bool valid_{false};
+    uint8_t *arena_{nullptr};
+    uint64_t capacity_{0};
+};
+
+} // namespace MLAWorkspace
+
+#endif // MLA_WORKSPACE_HPP
@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0, 
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+
+#include "helper.hpp"
+#include "golden.hpp"
+#include "fp16_t.h"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/tile/tile_copy.hpp"
+#include "catlass/epilogue/tile/tile_swizzle.hpp"
+#include "catlass/epilogue/tile/tile_row_reduce.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/matmul_residual_norm.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+using fp16_t = op::fp16_t;
+
+using ArchTag = Arch::AtlasA2;
+
+// Block level, define BlockMmad. The fp32 accumulator is written to the workspace, the residual add and the
+// norm are computed from it in fp32.
+constexpr bool ENABLE_UNIT_FLAG = true;
+using MmadDispatchPolicy = Gemm::MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG>;
+using L1TileShape = GemmShape<128, 256, 256>;
+using L0TileShape = GemmShape<128, 256, 64>;
+using LayoutA = layout::RowMajor;
+using LayoutB = layout::RowMajor;
+using LayoutD = layout::RowMajor;
+using AType = Gemm::GemmType<half, LayoutA>;
+using BType = Gemm::GemmType<half, LayoutB>;
+using CType = Gemm::GemmType<float, layout::RowMajor>;
+using BlockMmad = Gemm::Block::BlockMmad<MmadDispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+
+// Block level, define BlockEpilogue. The epilogue tiles span the 256 columns of a cube block, so that rows with
+// n <= 256 are normalized in UB.
+using ResidualType = Gemm::GemmType<half, layout::RowMajor>;
+using GammaType = Gemm::GemmType<half, layout::VectorLayout>;
+using DType = Gemm::GemmType<half, LayoutD>;
+
+using ComputeType = Gemm::GemmType<float, layout::RowMajor>;
+using EpilogueTileShape = MatrixShape<32, 256>;
+using TileRowReduceSum = Epilogue::Tile::TileRowReduceSum<ArchTag, ComputeType, EpilogueTileShape>;
+using EpilogueTileCopy = Epilogue::Tile::TileCopy<ArchTag, CType, ResidualType, GammaType, DType>;
+using EpilogueTileSwizzle = Epilogue::Tile::EpilogueHorizontalTileSwizzle;
+template <bool IS_LAYER_NORM>
+using BlockEpilogue = Epilogue::Block::BlockEpilogue<Epilogue::EpilogueAtlasA2ResidualNorm<IS_LAYER_NORM>, CType,
+    ResidualType, GammaType, DType, TileRowReduceSum, EpilogueTileCopy, EpilogueTileSwizzle>;
+
+template <bool IS_LAYER_NORM, class BlockScheduler>
+void LaunchMatmulResidualNorm(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr, GemmCoord problemShape,
+    uint8_t *deviceA, LayoutA layoutA, uint8_t *deviceB, LayoutB layoutB,
+    typename BlockEpilogue<IS_LAYER_NORM>::Params const &epilogueParams)
+{
+    // kernel level
+    using MatmulKernel = Gemm::Kernel::MatmulResidualNorm<BlockMmad, BlockEpilogue<IS_LAYER_NORM>, BlockScheduler>;
+    // device level
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    typename MatmulKernel::Arguments arguments{problemShape, deviceA, layoutA, deviceB, layoutB, epilogueParams};
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+
+    // The fp32 result of the mmad, overwritten with the residual sum if a row spans several blocks, and the fp32
+    // row statistics
+    size_t sizeWorkspace = MatmulAdapter::GetWorkspaceSize(arguments);
+    uint8_t *deviceWorkspace{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, deviceWorkspace, stream, blockDim, fftsAddr) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+    ACL_CHECK(aclrtFree(deviceWorkspace));
+}
+
+template <bool IS_LAYER_NORM>
+void RunMatmulResidualNorm(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr, GemmCoord problemShape,
+    uint8_t *deviceA, LayoutA layoutA, uint8_t *deviceB, LayoutB layoutB, uint8_t *deviceResidual,
+    uint8_t *deviceGamma, uint8_t *deviceBeta, layout::VectorLayout layoutGamma,
+    uint8_t *deviceSum, uint8_t *deviceD, LayoutD layoutD, float epsilon)
+{
+    typename BlockEpilogue<IS_LAYER_NORM>::Params epilogueParams{
+        reinterpret_cast<__gm__ half *>(deviceResidual), layout::RowMajor{problemShape.m(), problemShape.n()},
+        reinterpret_cast<__gm__ half *>(deviceGamma), reinterpret_cast<__gm__ half *>(deviceBeta), layoutGamma,
+        reinterpret_cast<__gm__ half *>(deviceSum), reinterpret_cast<__gm__ half *>(deviceD), layoutD, epsilon};
+
+    if (problemShape.m() > problemShape.n()) {
+        // Swizzle offset is 3 and direction is 0.
+        LaunchMatmulResidualNorm<IS_LAYER_NORM, Gemm::Block::GemmIdentityBlockSwizzle<3, 0>>(
+            stream, blockDim, fftsAddr, problemShape, deviceA, layoutA, deviceB, layoutB, epilogueParams);
+    } else {
+        // Swizzle offset is 3 and direction is 1.
+        LaunchMatmulResidualNorm<IS_LAYER_NORM, Gemm::Block::GemmIdentityBlockSwizzle<3, 1>>(
+            stream, blockDim, fftsAddr, problemShape, deviceA, layoutA, deviceB, layoutB, epilogueParams);
+    }
+}
+
+struct Options {
+    const std::string HELPER = "22_matmul_residual_norm m n k [norm_type] [device_id]";
+
+    GemmCoord problemShape{128, 128, 128};
+    // 0: RMSNorm, 1: LayerNorm
+    golden::NormType normType{golden::NormType::RMS_NORM};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            NORM_TYPE_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc > NORM_TYPE_INDEX) {
+            normType = (std::atoi(argv[NORM_TYPE_INDEX]) == 1) ? golden::NormType::LAYER_NORM :
+                golden::NormType::RMS_NORM;
+        }
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        return 0;
+    }
+};
+
+void Run(Options const &options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+    bool isLayerNorm = (options.normType == golden::NormType::LAYER_NORM);
+    constexpr float epsilon = 1e-6f;
+
+    // Compute the length of each matrix and the size of each buffer
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenGamma = static_cast<size_t>(n);
+    size_t lenD = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = lenB * sizeof(fp16_t);
+    size_t sizeGamma = lenGamma * sizeof(fp16_t);
+    size_t sizeD = lenD * sizeof(fp16_t);
+
+    // Define the layout of each matrix
+    layout::RowMajor layoutA{m, k};
+    layout::RowMajor layoutB{k, n};
+    layout::VectorLayout layoutGamma{n};
+    layout::RowMajor layoutD{m, n};
+
+    // Prepare input data A, B, residual, gamma and beta
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<fp16_t> hostB(lenB);
+    std::vector<fp16_t> hostResidual(lenD);
+    std::vector<fp16_t> hostGamma(lenGamma);
+    std::vector<fp16_t> hostBeta(lenGamma);
+    golden::FillRandomData<fp16_t>(hostA, -1.0f, 1.0f);
+    golden::FillRandomData<fp16_t>(hostB, -1.0f, 1.0f);
+    golden::FillRandomData<fp16_t>(hostResidual, -5.0f, 5.0f);
+    golden::FillRandomData<fp16_t>(hostGamma, 0.5f, 1.5f);
+    golden::FillRandomData<fp16_t>(hostBeta, -1.0f, 1.0f);
+
+    // Allocate device memory and copy data from host to device
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceResidual{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceResidual), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceResidual, sizeD, hostResidual.data(), sizeD, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceGamma{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceGamma), sizeGamma, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceGamma, sizeGamma, hostGamma.data(), sizeGamma, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceBeta{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceBeta), sizeGamma, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceBeta, sizeGamma, hostBeta.data(), sizeGamma, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceSum{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceSum), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    uint8_t *deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Launch the kernel
+    if (isLayerNorm) {
+        RunMatmulResidualNorm<true>(stream, aicCoreNum, fftsAddr, options.problemShape, deviceA, layoutA,
+            deviceB, layoutB, deviceResidual, deviceGamma, deviceBeta, layoutGamma, deviceSum, deviceD, layoutD,
+            epsilon);
+    } else {
+        RunMatmulResidualNorm<false>(stream, aicCoreNum, fftsAddr, options.problemShape, deviceA, layoutA,
+            deviceB, layoutB, deviceResidual, deviceGamma, nullptr, layoutGamma, deviceSum, deviceD, layoutD,
+            epsilon);
+    }
+
+    // Copy the result from device to host
+    std::vector<fp16_t> hostSum(lenD);
+    ACL_CHECK(aclrtMemcpy(hostSum.data(), sizeD, deviceSum, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+    std::vector<fp16_t> hostD(lenD);
+    ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // Compute the golden result
+    std::vector<float> hostGoldenSum(lenD);
+    std::vector<float> hostGolden(lenD);
+    golden::ComputeMatmulResidualNorm(options.problemShape, hostA, layoutA, hostB, layoutB, hostResidual,
+        hostGamma, isLayerNorm ? hostBeta : std::vector<fp16_t>{}, options.normType, epsilon,
+        hostGoldenSum, hostGolden);
+
+    // Compare the result
+    std::vector<uint64_t> errorIndicesSum = golden::CompareData(hostSum, hostGoldenSum, k);
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k);
+    if (errorIndicesSum.empty() && errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndicesSum.size() << " (sum), "
+            << errorIndices.size() << " (norm)" << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceResidual));
+    ACL_CHECK(aclrtFree(deviceGamma));
+    ACL_CHECK(aclrtFree(deviceBeta));
+    ACL_CHECK(aclrtFree(deviceSum));
+    ACL_CHECK(aclrtFree(deviceD));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
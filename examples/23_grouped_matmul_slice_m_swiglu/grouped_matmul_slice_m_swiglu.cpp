@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0, 
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "helper.hpp"
+#include "golden.hpp"
+#include "fp16_t.h"
+#include "swiglu_weight.hpp"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/tile/tile_activation.hpp"
+#include "catlass/epilogue/tile/tile_copy.hpp"
+#include "catlass/epilogue/tile/tile_elemwise_mul.hpp"
+#include "catlass/epilogue/tile/tile_swizzle.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/grouped_matmul_slice_m_swiglu.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+using fp16_t = op::fp16_t;
+
+using L1TileShape = GemmShape<128, 256, 256>;
+// Columns of a gate or an up tile in the interleaved weight
+constexpr uint32_t PAIR_N = L1TileShape::N / 2;
+
+using ArchTag = Arch::AtlasA2;
+constexpr uint32_t PRELOAD_STAGES = 1;
+constexpr uint32_t L1_STAGES = 2;
+constexpr uint32_t L0A_STAGES = 2;
+constexpr uint32_t L0B_STAGES = 4;
+constexpr uint32_t L0C_STAGES = 1;
+constexpr bool ENABLE_UNIT_FLAG = false;
+constexpr bool ENABLE_SHUFFLE_K = true;
+using DispatchPolicy = Gemm::MmadAtlasA2PreloadAsync<
+    PRELOAD_STAGES,
+    L1_STAGES, L0A_STAGES, L0B_STAGES, L0C_STAGES,
+    ENABLE_UNIT_FLAG, ENABLE_SHUFFLE_K
+>;
+using L0TileShape = GemmShape<128, 256, 64>;
+
+// The fp32 gate and up accumulators are kept for the activation
+using AType = Gemm::GemmType<half, layout::RowMajor>;
+using BType = Gemm::GemmType<half, layout::RowMajor>;
+using CType = Gemm::GemmType<float, layout::RowMajor>;
+
+using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+
+constexpr uint32_t UB_STAGES = 2;
+using EpilogueDispatchPolicy = Epilogue::EpilogueAtlasA2SwiGlu<UB_STAGES>;
+using DType = Gemm::GemmType<half, layout::RowMajor>;
+
+using ComputeType = Gemm::GemmType<float, layout::RowMajor>;
+using EpilogueTileShape = MatrixShape<32, PAIR_N>;
+using TileSilu = Epilogue::Tile::TileSilu<ArchTag, ComputeType, EpilogueTileShape>;
+using TileElemwiseMul = Epilogue::Tile::TileElemwiseMul<ArchTag, ComputeType, EpilogueTileShape>;
+using TileCopy = Epilogue::Tile::TileCopy<ArchTag, CType, DType>;
+using TileScheduler = Epilogue::Tile::EpilogueHorizontalTileSwizzle;
+
+using BlockEpilogue = Epilogue::Block::BlockEpilogue<EpilogueDispatchPolicy, CType, DType,
+    TileSilu, TileElemwiseMul, TileCopy, TileScheduler>;
+
+using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+
+// kernel level
+using ElementGroupList = int64_t;
+using MatmulKernel = Gemm::Kernel::GroupedMatmulSliceMSwiGlu<BlockMmad, BlockEpilogue, BlockScheduler,
+    ElementGroupList>;
+// device level
+using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+void LaunchGroupedMatmulSliceMSwiGlu(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr,
+    GemmCoord problemShape, uint32_t problemCount, uint8_t *deviceGroupList,
+    uint8_t *deviceA, layout::RowMajor layoutA,
+    uint8_t *deviceB, layout::RowMajor layoutB,
+    uint8_t *deviceD, layout::RowMajor layoutD)
+{
+    typename MatmulKernel::Arguments arguments{
+        problemShape, problemCount, deviceGroupList,
+        deviceA, layoutA,
+        deviceB, layoutB,
+        deviceD, layoutD
+    };
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+
+    // The m x 2n fp32 gate and up accumulators
+    size_t sizeWorkspace = MatmulAdapter::GetWorkspaceSize(arguments);
+    uint8_t *deviceWorkspace{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, deviceWorkspace, stream, blockDim, fftsAddr) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+    ACL_CHECK(aclrtFree(deviceWorkspace));
+}
+
+struct Options {
+    const std::string HELPER = "23_grouped_matmul_slice_m_swiglu group_count m n k [device_id]";
+
+    uint32_t groupCount{1};
+    // n is the intermediate size, the gate and up weights are k x n each
+    GemmCoord problemShape{128, 128, 128};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            GROUP_COUNT_INDEX = 1,
+            M_INDEX,
+            N_INDEX,
+            K_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        groupCount = std::atoi(argv[GROUP_COUNT_INDEX]);
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        return 0;
+    }
+};
+
+void Run(Options const &options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t problemCount = options.groupCount;
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenWeight = static_cast<size_t>(k) * n;
+    size_t lenB = lenWeight * 2 * problemCount;
+    size_t lenD = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = lenB * sizeof(fp16_t);
+    size_t sizeD = lenD * sizeof(fp16_t);
+
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<fp16_t> hostGate(lenWeight * problemCount);
+    std::vector<fp16_t> hostUp(lenWeight * problemCount);
+    golden::FillRandomData(hostA, -1.0f, 1.0f);
+    golden::FillRandomData(hostGate, -1.0f, 1.0f);
+    golden::FillRandomData(hostUp, -1.0f, 1.0f);
+    auto groupList = golden::GenerateGroupList<int64_t>(m, problemCount);
+
+    // Interleave the gate and up weights of every expert, offline in a real deployment
+    std::vector<fp16_t> hostB;
+    hostB.reserve(lenB);
+    for (uint32_t groupIdx = 0; groupIdx < problemCount; ++groupIdx) {
+        std::vector<fp16_t> gate(hostGate.begin() + groupIdx * lenWeight, hostGate.begin() + (groupIdx + 1) * lenWeight);
+        std::vector<fp16_t> up(hostUp.begin() + groupIdx * lenWeight, hostUp.begin() + (groupIdx + 1) * lenWeight);
+        auto interleaved = SwiGluWeight::InterleaveGateUp(k, n, PAIR_N, gate, up);
+        hostB.insert(hostB.end(), interleaved.begin(), interleaved.end());
+    }
+
+    size_t sizeGroupList = problemCount * sizeof(int64_t);
+    uint8_t *deviceGroupList{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceGroupList), sizeGroupList, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceGroupList, sizeGroupList, groupList.data(), sizeGroupList, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    layout::RowMajor layoutA{m, k};
+    layout::RowMajor layoutB{k, n * 2};
+    layout::RowMajor layoutD{m, n};
+
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    LaunchGroupedMatmulSliceMSwiGlu(stream, aicCoreNum, fftsAddr,
+        options.problemShape, problemCount, deviceGroupList,
+        deviceA, layoutA,
+        deviceB, layoutB,
+        deviceD, layoutD);
+
+    std::vector<fp16_t> hostD(lenD);
+    ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // The golden uses the separate gate and up weights
+    std::vector<float> hostGolden(lenD);
+    golden::ComputeGroupedMatmulSwiGlu(options.problemShape, problemCount, groupList, hostA, hostGate, hostUp,
+        hostGolden);
+
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k, groupList[problemCount - 1] * n);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceD));
+    ACL_CHECK(aclrtFree(deviceGroupList));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) == 0) {
+        Run(options);
+    }
+    return 0;
+}
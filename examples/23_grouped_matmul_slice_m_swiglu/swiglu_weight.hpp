@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SWIGLU_WEIGHT_HPP
+#define SWIGLU_WEIGHT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Interleaved gate/up weight of GroupedMatmulSliceMSwiGlu. The k x n gate and up weights of an expert are stored as
+// one row major k x 2n weight, in pairs of tiles of pairN = L1TileShape::N / 2 columns: the j-th pair holds the gate
+// columns [j * pairN, j * pairN + w) followed by the up columns of the same range, w being pairN except for a
+// shorter last pair. A cube block of 2 * pairN columns then holds both projections of the same output columns.
+// Pure host code.
+namespace SwiGluWeight {
+
+/// Column of the interleaved weight holding column j of the gate (isUp false) or the up weight
+inline uint32_t InterleavedColumn(uint32_t n, uint32_t pairN, uint32_t j, bool isUp)
+{
+    uint32_t pairIdx = j / pairN;
+    uint32_t pairStart = pairIdx * pairN;
+    uint32_t width = std::min(pairN, n - pairStart);
+    return 2 * pairStart + (isUp ? width : 0) + (j - pairStart);
+}
+
+/// Interleave the row major k x n gate and up weights of one expert into a row major k x 2n weight.
+template <class Element>
+std::vector<Element> InterleaveGateUp(uint32_t k, uint32_t n, uint32_t pairN,
+    const std::vector<Element> &gate, const std::vector<Element> &up)
+{
+    std::vector<Element> interleaved(static_cast<size_t>(k) * n * 2);
+    for (uint32_t j = 0; j < n; ++j) {
+        uint32_t gateColumn = InterleavedColumn(n, pairN, j, false);
+        uint32_t upColumn = InterleavedColumn(n, pairN, j, true);
+        for (uint32_t row = 0; row < k; ++row) {
+            size_t rowOffset = static_cast<size_t>(row) * n * 2;
+            interleaved[rowOffset + gateColumn] = gate[static_cast<size_t>(row) * n + j];
+            interleaved[rowOffset + upColumn] = up[static_cast<size_t>(row) * n + j];
+        }
+    }
+    return interleaved;
+}
+
+} // namespace SwiGluWeight
+
+#endif // SWIGLU_WEIGHT_HPP
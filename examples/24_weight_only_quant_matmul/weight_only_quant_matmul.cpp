@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0, 
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "helper.hpp"
+#include "golden.hpp"
+#include "fp16_t.h"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/weight_only_quant_matmul.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+using fp16_t = op::fp16_t;
+
+using ArchTag = Arch::AtlasA2;
+
+// Block level, define BlockMmad over the dequantized fp16 weight. Narrow panels give the cores more of them to share
+// when m is small.
+constexpr bool ENABLE_UNIT_FLAG = true;
+using MmadDispatchPolicy = Gemm::MmadAtlasA2Pingpong<ENABLE_UNIT_FLAG>;
+using L1TileShape = GemmShape<128, 128, 256>;
+using L0TileShape = GemmShape<128, 128, 64>;
+using AType = Gemm::GemmType<half, layout::RowMajor>;
+using BType = Gemm::GemmType<half, layout::RowMajor>;
+using CType = Gemm::GemmType<half, layout::RowMajor>;
+using BlockMmad = Gemm::Block::BlockMmad<MmadDispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+
+template <class ElementQuant>
+void LaunchWeightOnlyQuantMatmul(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr, GemmCoord problemShape,
+    uint8_t *deviceA, layout::RowMajor layoutA, uint8_t *deviceB, uint8_t *deviceScale, uint8_t *deviceZero,
+    uint32_t groupSize, uint8_t *deviceC, layout::RowMajor layoutC)
+{
+    // kernel level
+    using MatmulKernel = Gemm::Kernel::WeightOnlyQuantMatmul<BlockMmad, ElementQuant, half>;
+    // device level
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    typename MatmulKernel::Arguments arguments{problemShape, deviceA, layoutA,
+        deviceB, deviceScale, deviceZero, groupSize, deviceC, layoutC, blockDim};
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+
+    // The ring of dequantized fp16 strips of every cube core
+    size_t sizeWorkspace = MatmulAdapter::GetWorkspaceSize(arguments);
+    uint8_t *deviceWorkspace{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, deviceWorkspace, stream, blockDim, fftsAddr) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+    ACL_CHECK(aclrtFree(deviceWorkspace));
+}
+
+struct Options {
+    const std::string HELPER = "24_weight_only_quant_matmul m n k [bits] [group_size] [device_id]";
+
+    GemmCoord problemShape{128, 128, 128};
+    uint32_t bits{8};
+    uint32_t groupSize{128};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            BITS_INDEX,
+            GROUP_SIZE_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc > BITS_INDEX) {
+            bits = std::atoi(argv[BITS_INDEX]);
+        }
+        if (argc > GROUP_SIZE_INDEX) {
+            groupSize = std::atoi(argv[GROUP_SIZE_INDEX]);
+        }
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        if ((bits != 4) && (bits != 8)) {
+            std::cerr << "bits must be 4 or 8" << std::endl;
+            return -1;
+        }
+        if ((groupSize == 0) || (groupSize % 32 != 0)) {
+            std::cerr << "group_size must be a positive multiple of 32" << std::endl;
+            return -1;
+        }
+        if ((bits == 4) && (problemShape.n() % 2 != 0)) {
+            std::cerr << "n must be even for int4 weights" << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+};
+
+void Run(Options const &options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+    uint32_t groupSize = options.groupSize;
+    uint32_t groupNum = CeilDiv(k, groupSize);
+
+    // Compute the length of each matrix and the size of each buffer
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenScale = static_cast<size_t>(groupNum) * n;
+    size_t lenC = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(fp16_t);
+    size_t sizeB = lenB * options.bits / 8;
+    size_t sizeScale = lenScale * sizeof(fp16_t);
+    size_t sizeC = lenC * sizeof(fp16_t);
+
+    // Define the layout of each matrix
+    layout::RowMajor layoutA{m, k};
+    layout::RowMajor layoutB{k, n};
+    layout::RowMajor layoutC{m, n};
+
+    // Prepare input data A and the asymmetrically quantized weight B
+    std::vector<fp16_t> hostA(lenA);
+    std::vector<float> hostWeight(lenB);
+    golden::FillRandomData<fp16_t>(hostA, -1.0f, 1.0f);
+    golden::FillRandomData<float>(hostWeight, -1.0f, 1.0f);
+    std::vector<int8_t> hostQuant;
+    std::vector<fp16_t> hostScale;
+    std::vector<fp16_t> hostZero;
+    golden::QuantizeWeightPerGroup(k, n, groupSize, options.bits, false, hostWeight, hostQuant, hostScale, hostZero);
+    std::vector<int8_t> hostB = (options.bits == 4) ? golden::PackInt4(k, n, hostQuant) : hostQuant;
+
+    // Allocate device memory and copy data from host to device
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceZero{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceZero), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceZero, sizeScale, hostZero.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceC{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceC), sizeC, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    // Launch the kernel
+    if (options.bits == 4) {
+        LaunchWeightOnlyQuantMatmul<AscendC::int4b_t>(stream, aicCoreNum, fftsAddr, options.problemShape,
+            deviceA, layoutA, deviceB, deviceScale, deviceZero, groupSize, deviceC, layoutC);
+    } else {
+        LaunchWeightOnlyQuantMatmul<int8_t>(stream, aicCoreNum, fftsAddr, options.problemShape,
+            deviceA, layoutA, deviceB, deviceScale, deviceZero, groupSize, deviceC, layoutC);
+    }
+
+    // Copy the result from device to host
+    std::vector<fp16_t> hostC(lenC);
+    ACL_CHECK(aclrtMemcpy(hostC.data(), sizeC, deviceC, sizeC, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // Compute the golden result over the weight dequantized as the kernel does, rounded once to fp16
+    std::vector<fp16_t> hostDequantB;
+    golden::DequantizeWeightPerGroup(k, n, groupSize, hostQuant, hostScale, hostZero, hostDequantB);
+    std::vector<float> hostGolden(lenC);
+    golden::ComputeMatmul(options.problemShape, hostA, layoutA, hostDequantB, layoutB, hostGolden, layoutC);
+
+    // Compare the result
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostC, hostGolden, k);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceScale));
+    ACL_CHECK(aclrtFree(deviceZero));
+    ACL_CHECK(aclrtFree(deviceC));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
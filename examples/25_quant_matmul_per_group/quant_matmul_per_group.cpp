@@ -0,0 +1,287 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0, 
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include "helper.hpp"
+#include "golden.hpp"
+#include "bfloat16.h"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_mul.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_one_blk.hpp"
+#include "catlass/epilogue/tile/tile_swizzle.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/quant_matmul_per_group.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+using bfloat16 = op::bfloat16;
+
+using ArchTag = Arch::AtlasA2;
+constexpr uint32_t PRELOAD_STAGES = 1;
+constexpr uint32_t L1_STAGES = 2;
+constexpr uint32_t L0A_STAGES = 2;
+constexpr uint32_t L0B_STAGES = 2;
+constexpr uint32_t L0C_STAGES = 1;
+constexpr bool ENABLE_UNIT_FLAG = false;
+constexpr bool ENABLE_SHUFFLE_K = true;
+using DispatchPolicy = Gemm::MmadAtlasA2PreloadAsyncWithCallback<
+    PRELOAD_STAGES,
+    L1_STAGES, L0A_STAGES, L0B_STAGES, L0C_STAGES,
+    ENABLE_UNIT_FLAG, ENABLE_SHUFFLE_K
+>;
+// The k tile matches the usual group size of 128, so that a group is one k loop of the block
+using L1TileShape = GemmShape<128, 256, 128>;
+using L0TileShape = GemmShape<128, 256, 128>;
+
+using AType = Gemm::GemmType<int8_t, layout::RowMajor>;
+using BType = Gemm::GemmType<int8_t, layout::RowMajor>;
+using CType = Gemm::GemmType<int32_t, layout::RowMajor>;
+
+using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+
+constexpr uint32_t UB_STAGES = 2;
+using EpilogueDispatchPolicy = Epilogue::EpilogueAtlasA2PerGroupDequant<UB_STAGES>;
+using ScaleType = Gemm::GemmType<float, layout::VectorLayout>;
+using PerTokenScaleType = Gemm::GemmType<float, layout::VectorLayout>;
+using DType = Gemm::GemmType<bfloat16_t, layout::RowMajor>;
+
+using RowBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+using BroadcastOneBlkType = Gemm::GemmType<float, layout::RowMajor>;
+using OneBlkColumnBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+
+// The fp32 accumulators are staged in UB next to the partial sums
+using EpilogueTileShape = MatrixShape<32, 128>;
+using TileRowBroadcastMul = Epilogue::Tile::TileRowBroadcastMul<ArchTag, RowBroadcastMulType, EpilogueTileShape>;
+using TileBroadcastOneBlk = Epilogue::Tile::TileBroadcastOneBlk<ArchTag, BroadcastOneBlkType,
+    EpilogueTileShape::ROW>;
+using TileOneBlkColumnBroadcastMul = Epilogue::Tile::TileOneBlkColumnBroadcastMul<ArchTag,
+    OneBlkColumnBroadcastMulType, EpilogueTileShape>;
+using TileCopy = Epilogue::Tile::TileCopy<ArchTag, CType, ScaleType, PerTokenScaleType, DType>;
+using TileScheduler = Epilogue::Tile::EpilogueHorizontalTileSwizzle;
+
+using BlockEpilogue = Epilogue::Block::BlockEpilogue<EpilogueDispatchPolicy, CType, ScaleType, PerTokenScaleType,
+    DType, TileRowBroadcastMul, TileBroadcastOneBlk, TileOneBlkColumnBroadcastMul, TileCopy, TileScheduler>;
+
+using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+
+// kernel level
+constexpr uint32_t WORKSPACE_STAGES = 2;
+using MatmulKernel = Gemm::Kernel::QuantMatmulPerGroup<BlockMmad, BlockEpilogue, BlockScheduler, WORKSPACE_STAGES>;
+// device level
+using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+void LaunchQuantMatmulPerGroup(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr,
+    GemmCoord problemShape, uint32_t groupSize,
+    uint8_t *deviceA, layout::RowMajor layoutA,
+    uint8_t *deviceB, layout::RowMajor layoutB,
+    uint8_t *deviceScale, layout::VectorLayout layoutScale,
+    uint8_t *devicePerTokenScale, layout::VectorLayout layoutPerTokenScale,
+    uint8_t *deviceD, layout::RowMajor layoutD)
+{
+    typename MatmulKernel::Arguments arguments{
+        problemShape, groupSize,
+        deviceA, layoutA,
+        deviceB, layoutB,
+        deviceScale, layoutScale,
+        devicePerTokenScale, layoutPerTokenScale,
+        deviceD, layoutD,
+        blockDim
+    };
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+
+    // The int32 partial sums of the stages, then one block of fp32 accumulators per core
+    size_t sizeWorkspace = MatmulAdapter::GetWorkspaceSize(arguments);
+    uint8_t *deviceWorkspace{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, deviceWorkspace, stream, blockDim, fftsAddr) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+    ACL_CHECK(aclrtFree(deviceWorkspace));
+}
+
+struct Options {
+    const std::string HELPER = "25_quant_matmul_per_group m n k [group_size] [device_id]";
+
+    GemmCoord problemShape{128, 128, 128};
+    uint32_t groupSize{128};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            GROUP_SIZE_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc > GROUP_SIZE_INDEX) {
+            groupSize = std::atoi(argv[GROUP_SIZE_INDEX]);
+        }
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        if (groupSize == 0) {
+            std::cerr << "group_size must be positive" << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+};
+
+void Run(Options const & options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+    uint32_t groupSize = options.groupSize;
+    uint32_t groupNum = CeilDiv(k, groupSize);
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenScale = static_cast<size_t>(groupNum) * n;
+    size_t lenPerTokenScale = static_cast<size_t>(groupNum) * m;
+    size_t lenD = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA * sizeof(int8_t);
+    size_t sizeB = lenB * sizeof(int8_t);
+    size_t sizeScale = lenScale * sizeof(float);
+    size_t sizePerTokenScale = lenPerTokenScale * sizeof(float);
+    size_t sizeD = lenD * sizeof(bfloat16);
+
+    // Quantize random activations per 1 x group_size block and weights per group_size x 128 block
+    constexpr uint32_t weightBlockN = 128;
+    std::vector<float> hostActivation(lenA);
+    std::vector<float> hostWeight(lenB);
+    golden::FillRandomData(hostActivation, -4.0f, 4.0f);
+    golden::FillRandomData(hostWeight, -1.0f, 1.0f);
+    std::vector<int8_t> hostA;
+    std::vector<int8_t> hostB;
+    std::vector<float> hostScale;
+    std::vector<float> hostPerTokenScale;
+    golden::QuantizeActivationPerGroup(m, k, groupSize, hostActivation, hostA, hostPerTokenScale);
+    golden::QuantizeWeightPerBlock(k, n, groupSize, weightBlockN, hostWeight, hostB, hostScale);
+
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *devicePerTokenScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&devicePerTokenScale), sizePerTokenScale,
+        ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(devicePerTokenScale, sizePerTokenScale, hostPerTokenScale.data(), sizePerTokenScale,
+        ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    layout::RowMajor layoutA{m, k};
+    layout::RowMajor layoutB{k, n};
+    // The scales of one group
+    layout::VectorLayout layoutScale{n};
+    layout::VectorLayout layoutPerTokenScale{m};
+    layout::RowMajor layoutD{m, n};
+
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
+    LaunchQuantMatmulPerGroup(stream, aicCoreNum, fftsAddr,
+        options.problemShape, groupSize,
+        deviceA, layoutA,
+        deviceB, layoutB,
+        deviceScale, layoutScale,
+        devicePerTokenScale, layoutPerTokenScale,
+        deviceD, layoutD
+    );
+
+    std::vector<bfloat16> hostD(lenD);
+    ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<float> hostGolden;
+    golden::ComputeQuantMatmulPerGroup(m, n, k, groupSize, hostA, hostB, hostScale, hostPerTokenScale, hostGolden);
+
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceScale));
+    ACL_CHECK(aclrtFree(devicePerTokenScale));
+    ACL_CHECK(aclrtFree(deviceD));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) == 0) {
+        Run(options);
+    }
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0, 
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <cstdlib>
+
+#include "helper.hpp"
+#include "golden.hpp"
+#include "fp16_t.h"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/epilogue/block/block_epilogue.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_mul.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_one_blk.hpp"
+#include "catlass/epilogue/tile/tile_swizzle.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/dynamic_quant_matmul.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+using fp16_t = op::fp16_t;
+
+using ArchTag = Arch::AtlasA2;
+
+// Prologue, quantizes X into the int8 A operand on AIV
+constexpr uint32_t COMPUTE_LENGTH = 4096;
+using PrologueA = Gemm::Kernel::PerTokenQuantMatrixBlock<ArchTag, half, int8_t, COMPUTE_LENGTH>;
+
+constexpr uint32_t PRELOAD_STAGES = 1;
+constexpr uint32_t L1_STAGES = 2;
+constexpr uint32_t L0A_STAGES = 2;
+constexpr uint32_t L0B_STAGES = 4;
+constexpr uint32_t L0C_STAGES = 1;
+constexpr bool ENABLE_UNIT_FLAG = false;
+constexpr bool ENABLE_SHUFFLE_K = true;
+using DispatchPolicy = Gemm::MmadAtlasA2PreloadAsyncWithCallback<
+    PRELOAD_STAGES,
+    L1_STAGES, L0A_STAGES, L0B_STAGES, L0C_STAGES,
+    ENABLE_UNIT_FLAG, ENABLE_SHUFFLE_K
+>;
+using L1TileShape = GemmShape<128, 256, 256>;
+using L0TileShape = GemmShape<128, 256, 64>;
+
+using AType = Gemm::GemmType<int8_t, layout::RowMajor>;
+using BType = Gemm::GemmType<int8_t, layout::RowMajor>;
+using CType = Gemm::GemmType<int32_t, layout::RowMajor>;
+
+using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+
+constexpr uint32_t UB_STAGES = 2;
+using EpilogueDispatchPolicy = Epilogue::EpilogueAtlasA2PerTokenDequant<UB_STAGES>;
+using ScaleType = Gemm::GemmType<float, layout::VectorLayout>;
+using PerTokenScaleType = Gemm::GemmType<float, layout::VectorLayout>;
+using DType = Gemm::GemmType<half, layout::RowMajor>;
+
+using RowBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+using BroadcastOneBlkType = Gemm::GemmType<float, layout::RowMajor>;
+using OneBlkColumnBroadcastMulType = Gemm::GemmType<float, layout::RowMajor>;
+
+using EpilogueTileShape = MatrixShape<32, 256>;
+using TileRowBroadcastMul = Epilogue::Tile::TileRowBroadcastMul<ArchTag, RowBroadcastMulType, EpilogueTileShape>;
+using TileBroadcastOneBlk = Epilogue::Tile::TileBroadcastOneBlk<ArchTag, BroadcastOneBlkType,
+    EpilogueTileShape::ROW>;
+using TileOneBlkColumnBroadcastMul = Epilogue::Tile::TileOneBlkColumnBroadcastMul<ArchTag,
+    OneBlkColumnBroadcastMulType, EpilogueTileShape>;
+using TileCopy = Epilogue::Tile::TileCopy<ArchTag, CType, ScaleType, PerTokenScaleType, DType>;
+using TileScheduler = Epilogue::Tile::EpilogueHorizontalTileSwizzle;
+
+using BlockEpilogue = Epilogue::Block::BlockEpilogue<EpilogueDispatchPolicy, CType, ScaleType, PerTokenScaleType,
+    DType, TileRowBroadcastMul, TileBroadcastOneBlk, TileOneBlkColumnBroadcastMul, TileCopy, TileScheduler>;
+
+using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+
+// kernel level
+constexpr uint32_t WORKSPACE_STAGES = 2;
+using MatmulKernel = Gemm::Kernel::DynamicQuantMatmul<PrologueA, BlockMmad, BlockEpilogue, BlockScheduler,
+    WORKSPACE_STAGES>;
+// device level
+using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+void LaunchDynamicQuantMatmul(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr,
+    GemmCoord problemShape,
+    uint8_t *deviceX, layout::RowMajor layoutX,
+    uint8_t *deviceB, layout::RowMajor layoutB,
+    uint8_t *deviceScale, layout::VectorLayout layoutScale,
+    uint8_t *devicePerTokenScale, layout::VectorLayout layoutPerTokenScale,
+    uint8_t *deviceD, layout::RowMajor layoutD)
+{
+    typename MatmulKernel::Arguments arguments{
+        problemShape,
+        deviceX, layoutX,
+        deviceB, layoutB,
+        deviceScale, layoutScale,
+        devicePerTokenScale, layoutPerTokenScale,
+        deviceD, layoutD,
+        blockDim
+    };
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+
+    // The int32 accumulators of the stages, then the quantized int8 activation
+    size_t sizeWorkspace = MatmulAdapter::GetWorkspaceSize(arguments);
+    uint8_t *deviceWorkspace{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceWorkspace), sizeWorkspace, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, deviceWorkspace, stream, blockDim, fftsAddr) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+    ACL_CHECK(aclrtFree(deviceWorkspace));
+}
+
+struct Options {
+    const std::string HELPER = "26_dynamic_quant_matmul m n k [device_id]";
+
+    GemmCoord problemShape{128, 128, 128};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        return 0;
+    }
+};
+
+void Run(Options const & options)
+{
+    aclrtStream stream{nullptr};
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    size_t lenX = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenScale = static_cast<size_t>(n);
+    size_t lenPerTokenScale = static_cast<size_t>(m);
+    size_t lenD = static_cast<size_t>(m) * n;
+
+    size_t sizeX = lenX * sizeof(fp16_t);
+    size_t sizeB = lenB * sizeof(int8_t);
+    size_t sizeScale = lenScale * sizeof(float);
+    size_t sizePerTokenScale = lenPerTokenScale * sizeof(float);
+    size_t sizeD = lenD * sizeof(fp16_t);
+
+    // The fp16 activation is quantized by the kernel, the weight per output channel on the host
+    std::vector<fp16_t> hostX(lenX);
+    std::vector<float> hostWeight(lenB);
+    golden::FillRandomData<fp16_t>(hostX, -4.0f, 4.0f);
+    golden::FillRandomData<float>(hostWeight, -1.0f, 1.0f);
+    std::vector<int8_t> hostB;
+    std::vector<float> hostScale;
+    golden::QuantizeWeightPerBlock(k, n, k, 1, hostWeight, hostB, hostScale);
+
+    uint8_t *deviceX{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceX), sizeX, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceX, sizeX, hostX.data(), sizeX, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceScale), sizeScale, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceScale, sizeScale, hostScale.data(), sizeScale, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *devicePerTokenScale{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&devicePerTokenScale), sizePerTokenScale,
+        ACL_MEM_MALLOC_HUGE_FIRST));
+
+    uint8_t *deviceD{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceD), sizeD, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    layout::RowMajor layoutX{m, k};
+    layout::RowMajor layoutB{k, n};
+    layout::VectorLayout layoutScale{n};
+    layout::VectorLayout layoutPerTokenScale{m};
+    layout::RowMajor layoutD{m, n};
+
+    // Prepare FFTS address
+    uint64_t fftsAddr{0};
+    uint32_t fftsLen{0};
+    RT_CHECK(rtGetC2cCtrlAddr(&fftsAddr, &fftsLen));
+
+    LaunchDynamicQuantMatmul(stream, aicCoreNum, fftsAddr,
+        options.problemShape,
+        deviceX, layoutX,
+        deviceB, layoutB,
+        deviceScale, layoutScale,
+        devicePerTokenScale, layoutPerTokenScale,
+        deviceD, layoutD
+    );
+
+    std::vector<fp16_t> hostD(lenD);
+    ACL_CHECK(aclrtMemcpy(hostD.data(), sizeD, deviceD, sizeD, ACL_MEMCPY_DEVICE_TO_HOST));
+    std::vector<float> hostPerTokenScale(lenPerTokenScale);
+    ACL_CHECK(aclrtMemcpy(hostPerTokenScale.data(), sizePerTokenScale, devicePerTokenScale, sizePerTokenScale,
+        ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // The golden result over the activation quantized as the kernel does
+    std::vector<int8_t> hostA;
+    std::vector<float> hostGoldenPerTokenScale;
+    golden::QuantizeActivationPerToken(m, k, hostX, hostA, hostGoldenPerTokenScale);
+    std::vector<float> hostGolden;
+    golden::ComputeQuantMatmulPerGroup(m, n, k, k, hostA, hostB, hostScale, hostGoldenPerTokenScale, hostGolden);
+
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostD, hostGolden, k);
+    bool scaleMatched = true;
+    for (uint32_t i = 0; i < m; ++i) {
+        if (std::fabs(hostPerTokenScale[i] - hostGoldenPerTokenScale[i]) > hostGoldenPerTokenScale[i] * 1e-6f) {
+            scaleMatched = false;
+        }
+    }
+    if (!scaleMatched) {
+        std::cerr << "Compare failed. The per-token scales differ." << std::endl;
+    } else if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceX));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceScale));
+    ACL_CHECK(aclrtFree(devicePerTokenScale));
+    ACL_CHECK(aclrtFree(deviceD));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) == 0) {
+        Run(options);
+    }
+    return 0;
+}
\ No newline at end of file
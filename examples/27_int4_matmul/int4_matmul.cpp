@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+
+#include "helper.hpp"
+#include "golden.hpp"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/basic_matmul.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+
+using ArchTag = Arch::AtlasA2;
+using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<true>;
+// int4b_t tiles take half the bytes of int8_t ones, so k is twice as deep for the same L1 and L0 usage.
+using L1TileShape = GemmShape<128, 256, 1024>;
+using L0TileShape = GemmShape<128, 256, 256>;
+
+// Both operands are packed two per byte along k, so B is column major.
+using LayoutA = layout::RowMajor;
+using LayoutB = layout::ColumnMajor;
+using LayoutC = layout::RowMajor;
+using AType = Gemm::GemmType<AscendC::int4b_t, LayoutA>;
+using BType = Gemm::GemmType<AscendC::int4b_t, LayoutB>;
+using CType = Gemm::GemmType<int32_t, LayoutC>;
+
+using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+using BlockEpilogue = void;
+
+template <class BlockScheduler>
+void LaunchInt4Matmul(aclrtStream stream, uint32_t blockDim, GemmCoord problemShape,
+    uint8_t *deviceA, LayoutA layoutA, uint8_t *deviceB, LayoutB layoutB, uint8_t *deviceC, LayoutC layoutC)
+{
+    // kernel level
+    using MatmulKernel = Gemm::Kernel::BasicMatmul<BlockMmad, BlockEpilogue, BlockScheduler>;
+    // device level
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    typename MatmulKernel::Arguments arguments{problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC};
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+    // BasicMatmul needs no workspace.
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, nullptr, stream, blockDim) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+}
+
+struct Options {
+    const std::string HELPER = "27_int4_matmul m n k [device_id]";
+
+    GemmCoord problemShape{128, 128, 128};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        // Every row of A and column of B must be whole bytes.
+        if (problemShape.k() % 2 != 0) {
+            std::cerr << "k must be even." << std::endl;
+            return -1;
+        }
+        return 0;
+    }
+};
+
+void Run(Options const &options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenC = static_cast<size_t>(m) * n;
+
+    size_t sizeA = lenA / 2;
+    size_t sizeB = lenB / 2;
+    size_t sizeC = lenC * sizeof(int32_t);
+
+    layout::RowMajor layoutA{m, k};
+    layout::ColumnMajor layoutB{k, n};
+    layout::RowMajor layoutC{m, n};
+
+    // int4 values in [-8, 7], B given as a row major k x n matrix.
+    std::vector<int8_t> quantA(lenA);
+    std::vector<int8_t> quantB(lenB);
+    golden::FillRandomData<int8_t>(quantA, -8, 7);
+    golden::FillRandomData<int8_t>(quantB, -8, 7);
+    std::vector<int8_t> hostA = golden::PackInt4(m, k, quantA);
+    std::vector<int8_t> hostB = golden::PackInt4ColumnMajor(k, n, quantB);
+
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceC{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceC), sizeC, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    if (m > n) {
+        // Swizzle offset is 3 and direction is 0.
+        LaunchInt4Matmul<Gemm::Block::GemmIdentityBlockSwizzle<3, 0>>(
+            stream, aicCoreNum, options.problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC);
+    } else {
+        // Swizzle offset is 3 and direction is 1.
+        LaunchInt4Matmul<Gemm::Block::GemmIdentityBlockSwizzle<3, 1>>(
+            stream, aicCoreNum, options.problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC);
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+
+    std::vector<int32_t> hostC(lenC);
+    ACL_CHECK(aclrtMemcpy(hostC.data(), sizeC, deviceC, sizeC, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    // The golden unpacks the device operands, so it checks the packing as well.
+    std::vector<int32_t> hostGolden;
+    golden::ComputeMatmulInt4(m, n, k, hostA, hostB, hostGolden);
+
+    // Integer accumulation is exact.
+    uint64_t errorCount = 0;
+    for (size_t i = 0; i < lenC; ++i) {
+        if (hostC[i] != hostGolden[i]) {
+            ++errorCount;
+        }
+    }
+    if (errorCount == 0) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorCount << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceC));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
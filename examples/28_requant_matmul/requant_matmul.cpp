@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "helper.hpp"
+#include "golden.hpp"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/gemm/block/block_mmad.hpp"
+#include "catlass/gemm/block/block_swizzle.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemm/device/device_gemm.hpp"
+#include "catlass/gemm/kernel/requant_matmul.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/tile/fixpipe_quant_param.hpp"
+#include "catlass/gemm/tile/tile_copy.hpp"
+#include "catlass/layout/layout.hpp"
+
+using namespace Catlass;
+
+using ArchTag = Arch::AtlasA2;
+using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<true>;
+using L1TileShape = GemmShape<128, 256, 256>;
+using L0TileShape = GemmShape<128, 256, 64>;
+
+using LayoutA = layout::RowMajor;
+using LayoutB = layout::RowMajor;
+using LayoutC = layout::RowMajor;
+using AType = Gemm::GemmType<int8_t, LayoutA>;
+using BType = Gemm::GemmType<int8_t, LayoutB>;
+// The int32_t accumulator is requantized to int8_t by the fixpipe on its way out of L0C.
+using CType = Gemm::GemmType<int8_t, LayoutC>;
+
+template <Gemm::Tile::ScaleGranularity GRANULARITY, class BlockScheduler>
+void LaunchRequantMatmul(aclrtStream stream, uint32_t blockDim, GemmCoord problemShape,
+    uint8_t *deviceA, LayoutA layoutA, uint8_t *deviceB, LayoutB layoutB, uint8_t *deviceC, LayoutC layoutC,
+    uint64_t quantScalar, uint8_t *deviceQuant)
+{
+    // block level
+    using TileCopy = Gemm::Tile::QuantTileCopy<ArchTag, AType, BType, CType, GRANULARITY>;
+    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape,
+        AType, BType, CType, void, TileCopy>;
+    // kernel level
+    using MatmulKernel = Gemm::Kernel::RequantMatmul<BlockMmad, BlockScheduler>;
+    // device level
+    using MatmulAdapter = Gemm::Device::DeviceGemm<MatmulKernel>;
+
+    typename MatmulKernel::Arguments arguments{problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC,
+        quantScalar, deviceQuant};
+    if (MatmulAdapter::CanImplement(arguments) != Status::kSuccess) {
+        std::cerr << "Problem shape is not supported." << std::endl;
+        return;
+    }
+    // RequantMatmul needs no workspace.
+    MatmulAdapter matmulOp;
+    if (matmulOp(arguments, nullptr, stream, blockDim) != Status::kSuccess) {
+        std::cerr << "Failed to launch the kernel." << std::endl;
+    }
+}
+
+template <Gemm::Tile::ScaleGranularity GRANULARITY>
+void LaunchRequantMatmul(aclrtStream stream, uint32_t blockDim, GemmCoord problemShape,
+    uint8_t *deviceA, LayoutA layoutA, uint8_t *deviceB, LayoutB layoutB, uint8_t *deviceC, LayoutC layoutC,
+    uint64_t quantScalar, uint8_t *deviceQuant)
+{
+    if (problemShape.m() > problemShape.n()) {
+        // Swizzle offset is 3 and direction is 0.
+        LaunchRequantMatmul<GRANULARITY, Gemm::Block::GemmIdentityBlockSwizzle<3, 0>>(stream, blockDim,
+            problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC, quantScalar, deviceQuant);
+    } else {
+        // Swizzle offset is 3 and direction is 1.
+        LaunchRequantMatmul<GRANULARITY, Gemm::Block::GemmIdentityBlockSwizzle<3, 1>>(stream, blockDim,
+            problemShape, deviceA, layoutA, deviceB, layoutB, deviceC, layoutC, quantScalar, deviceQuant);
+    }
+}
+
+struct Options {
+    const std::string HELPER = "28_requant_matmul m n k [per_channel] [device_id]";
+
+    GemmCoord problemShape{128, 128, 128};
+    bool perChannel{true};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            K_INDEX,
+            PER_CHANNEL_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= K_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        problemShape.k() = std::atoi(argv[K_INDEX]);
+        if (argc > PER_CHANNEL_INDEX) {
+            perChannel = std::atoi(argv[PER_CHANNEL_INDEX]) != 0;
+        }
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        return 0;
+    }
+};
+
+void Run(Options const &options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+    uint32_t k = options.problemShape.k();
+
+    size_t lenA = static_cast<size_t>(m) * k;
+    size_t lenB = static_cast<size_t>(k) * n;
+    size_t lenC = static_cast<size_t>(m) * n;
+    // The per channel parameters are read in 32B blocks.
+    size_t lenQuant = RoundUp(static_cast<size_t>(n), static_cast<size_t>(4));
+
+    size_t sizeA = lenA * sizeof(int8_t);
+    size_t sizeB = lenB * sizeof(int8_t);
+    size_t sizeC = lenC * sizeof(int8_t);
+    size_t sizeQuant = lenQuant * sizeof(uint64_t);
+
+    layout::RowMajor layoutA{m, k};
+    layout::RowMajor layoutB{k, n};
+    layout::RowMajor layoutC{m, n};
+
+    std::vector<int8_t> hostA(lenA);
+    std::vector<int8_t> hostB(lenB);
+    golden::FillRandomData<int8_t>(hostA, -16, 16);
+    golden::FillRandomData<int8_t>(hostB, -16, 16);
+
+    // The accumulator has a standard deviation of about 90 * sqrt(k); map it onto a few tens of int8 steps so the
+    // outputs spread over the int8 range and the tails saturate.
+    float baseScale = 40.0f / (90.0f * std::sqrt(static_cast<float>(k)));
+    std::vector<uint64_t> hostQuant(lenQuant, 0);
+    uint64_t quantScalar = Gemm::Tile::FixpipeRequantParam::Encode(baseScale, 3);
+    for (uint32_t j = 0; j < n; ++j) {
+        float scale = baseScale * (0.5f + 0.25f * static_cast<float>(j % 7));
+        int32_t offset = static_cast<int32_t>(j % 11) - 5;
+        hostQuant[j] = Gemm::Tile::FixpipeRequantParam::Encode(scale, offset);
+    }
+
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceB{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceB), sizeB, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceB, sizeB, hostB.data(), sizeB, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceC{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceC), sizeC, ACL_MEM_MALLOC_HUGE_FIRST));
+
+    uint8_t *deviceQuant{nullptr};
+    if (options.perChannel) {
+        ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceQuant), sizeQuant, ACL_MEM_MALLOC_HUGE_FIRST));
+        ACL_CHECK(aclrtMemcpy(deviceQuant, sizeQuant, hostQuant.data(), sizeQuant, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
+    // Get the number of cube cores of the current hardware
+    auto aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
+
+    if (options.perChannel) {
+        LaunchRequantMatmul<Gemm::Tile::ScaleGranularity::PER_CHANNEL>(stream, aicCoreNum, options.problemShape,
+            deviceA, layoutA, deviceB, layoutB, deviceC, layoutC, quantScalar, deviceQuant);
+    } else {
+        LaunchRequantMatmul<Gemm::Tile::ScaleGranularity::PER_TENSOR>(stream, aicCoreNum, options.problemShape,
+            deviceA, layoutA, deviceB, layoutB, deviceC, layoutC, quantScalar, deviceQuant);
+    }
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+
+    std::vector<int8_t> hostC(lenC);
+    ACL_CHECK(aclrtMemcpy(hostC.data(), sizeC, deviceC, sizeC, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<int32_t> hostAccumulator;
+    golden::ComputeMatmulInt32Accumulate(m, n, k, hostA, hostB, hostAccumulator);
+    std::vector<uint64_t> goldenQuant{quantScalar};
+    if (options.perChannel) {
+        goldenQuant.assign(hostQuant.begin(), hostQuant.begin() + n);
+    }
+    std::vector<int8_t> hostGolden;
+    golden::ComputeRequant(m, n, hostAccumulator, goldenQuant, hostGolden);
+
+    // The requantization is bit exact.
+    uint64_t errorCount = 0;
+    for (size_t i = 0; i < lenC; ++i) {
+        if (hostC[i] != hostGolden[i]) {
+            ++errorCount;
+        }
+    }
+    if (errorCount == 0) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorCount << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceB));
+    ACL_CHECK(aclrtFree(deviceC));
+    if (deviceQuant != nullptr) {
+        ACL_CHECK(aclrtFree(deviceQuant));
+    }
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    Run(options);
+    return 0;
+}
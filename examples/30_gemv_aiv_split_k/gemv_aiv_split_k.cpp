@@ -0,0 +1,222 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+// By setting the K_MAX_SHAPE_DIM macro, the dimension of the AscendC Tensor's ShapeInfo is configured to 0,
+// optimizing stack space. If you need to use the ShapeInfo of the AscendC Tensor, please undefine this macro.
+#ifndef K_MAX_SHAPE_DIM
+#define K_MAX_SHAPE_DIM 0
+#endif
+
+#include <iostream>
+#include <vector>
+
+#include "helper.hpp"
+#include "golden.hpp"
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
+#include "catlass/gemm/dispatch_policy.hpp"
+#include "catlass/gemv/kernel/gemv_split_k_strategy.hpp"
+#include "catlass/gemv/kernel/kernel_gemv_aiv_split_k.hpp"
+#include "catlass/gemv/block/block_gemv.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemv/tile/tile_copy.hpp"
+#include "catlass/gemv/tile/tile_vmad.hpp"
+#include "catlass/gemv/tile/tile_vmuls.hpp"
+
+using namespace Catlass;
+
+// The column major TileVmad keeps one UB tile of x in scalar registers, at most 32 elements.
+template <class LayoutA>
+using UBTileShape = std::conditional_t<std::is_same_v<LayoutA, layout::RowMajor>,
+    GemvShape<32, 512>, GemvShape<512, 32>>;
+
+template <class LayoutA>
+using GemvKernel = Gemv::Kernel::KernelGemvAivSplitK<
+    Gemv::Block::BlockGemv<Gemm::GemvAtlasA2, UBTileShape<LayoutA>,
+        Gemm::GemmType<float, LayoutA>,
+        Gemm::GemmType<float, layout::VectorLayout>,
+        Gemm::GemmType<float, layout::VectorLayout>,
+        void,
+        Gemv::Tile::TileCopyGemvAivSplitK<Arch::AtlasA2, Gemm::GemmType<float, LayoutA>,
+            Gemm::GemmType<float, layout::VectorLayout>, Gemm::GemmType<float, layout::VectorLayout>>,
+        Gemv::Tile::TileVmad<Arch::AtlasA2, Gemm::GemmType<float, LayoutA>,
+            Gemm::GemmType<float, layout::VectorLayout>, Gemm::GemmType<float, layout::VectorLayout>>,
+        Gemv::Tile::TileVmuls<Arch::AtlasA2, Gemm::GemmType<float, layout::VectorLayout>>>,
+    void>;
+
+template <class LayoutA>
+CATLASS_GLOBAL
+void GemvAivSplitK(
+    GemvCoord problemShape,
+    GM_ADDR gmA, LayoutA layoutA,
+    GM_ADDR gmX, layout::VectorLayout layoutX,
+    GM_ADDR gmY, layout::VectorLayout layoutY,
+    GM_ADDR gmYCopy,
+    float alpha, float beta,
+    uint32_t splitK
+)
+{
+    using Kernel = GemvKernel<LayoutA>;
+    typename Kernel::Params params{problemShape, gmA, layoutA, gmX, layoutX, gmY, layoutY, gmYCopy,
+        alpha, beta, splitK};
+    Kernel gemv;
+    gemv(params);
+}
+
+struct Options {
+    const std::string HELPER = "30_gemv_aiv_split_k m n [trans_a] [device_id]";
+
+    GemvCoord problemShape{32, 65536};
+    bool transA{false};
+    int32_t deviceId{0};
+
+    Options() = default;
+
+    int Parse(int argc, const char **argv)
+    {
+        enum ArgsIndex {
+            M_INDEX = 1,
+            N_INDEX,
+            TRANS_A_INDEX,
+            DEVICE_ID_INDEX,
+            ARGS_MAX
+        };
+
+        if (argc > ARGS_MAX || argc <= N_INDEX) {
+            std::cerr << HELPER << std::endl;
+            return -1;
+        }
+
+        problemShape.m() = std::atoi(argv[M_INDEX]);
+        problemShape.n() = std::atoi(argv[N_INDEX]);
+        if (argc > TRANS_A_INDEX) {
+            transA = std::atoi(argv[TRANS_A_INDEX]) != 0;
+        }
+        if (argc == ARGS_MAX) {
+            deviceId = std::atoi(argv[DEVICE_ID_INDEX]);
+        }
+        return 0;
+    }
+};
+
+template <class LayoutA>
+void RunGemv(Options const &options)
+{
+    aclrtStream stream{nullptr};
+
+    ACL_CHECK(aclInit(nullptr));
+    ACL_CHECK(aclrtSetDevice(options.deviceId));
+    ACL_CHECK(aclrtCreateStream(&stream));
+
+    uint32_t m = options.problemShape.m();
+    uint32_t n = options.problemShape.n();
+
+    size_t lenA = static_cast<size_t>(m) * n;
+    size_t lenX = static_cast<size_t>(n);
+    size_t lenY = static_cast<size_t>(m);
+
+    size_t sizeA = lenA * sizeof(float);
+    size_t sizeX = lenX * sizeof(float);
+    size_t sizeY = lenY * sizeof(float);
+
+    LayoutA layoutA{m, n};
+    layout::VectorLayout layoutX{n};
+    layout::VectorLayout layoutY{m};
+
+    float alpha = 0.5f;
+    float beta = -1.5f;
+
+    std::vector<float> hostA(lenA);
+    std::vector<float> hostX(lenX);
+    std::vector<float> hostY(lenY);
+    golden::FillRandomData(hostA, -1.0f, 1.0f);
+    golden::FillRandomData(hostX, -1.0f, 1.0f);
+    golden::FillRandomData(hostY, -1.0f, 1.0f);
+
+    uint8_t *deviceA{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceA), sizeA, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceA, sizeA, hostA.data(), sizeA, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    uint8_t *deviceX{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceX), sizeX, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceX, sizeX, hostX.data(), sizeX, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    // The partial results are added to Y atomically, the input Y is read from a separate copy.
+    uint8_t *deviceYCopy{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceYCopy), sizeY, ACL_MEM_MALLOC_HUGE_FIRST));
+    ACL_CHECK(aclrtMemcpy(deviceYCopy, sizeY, hostY.data(), sizeY, ACL_MEMCPY_HOST_TO_DEVICE));
+
+    // For β = 0 the kernel does not read Y, which must start at zero.
+    uint8_t *deviceY{nullptr};
+    ACL_CHECK(aclrtMalloc(reinterpret_cast<void **>(&deviceY), sizeY, ACL_MEM_MALLOC_HUGE_FIRST));
+    if (beta == 0.0f) {
+        ACL_CHECK(aclrtMemset(deviceY, sizeY, 0, sizeY));
+    } else {
+        ACL_CHECK(aclrtMemcpy(deviceY, sizeY, hostY.data(), sizeY, ACL_MEMCPY_HOST_TO_DEVICE));
+    }
+
+    // Get the number of vector cores of the current hardware
+    auto aivCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAiv();
+
+    using Kernel = GemvKernel<LayoutA>;
+    uint32_t splitK = Gemv::Kernel::GemvSplitKPartition::SelectSplitK(m, n, Kernel::TILE_M, Kernel::K_ALIGN,
+        aivCoreNum);
+    std::cout << "splitK: " << splitK << std::endl;
+
+    GemvAivSplitK<LayoutA><<<aivCoreNum, nullptr, stream>>>(
+        options.problemShape,
+        deviceA, layoutA,
+        deviceX, layoutX,
+        deviceY, layoutY,
+        deviceYCopy,
+        alpha, beta,
+        splitK
+    );
+    ACL_CHECK(aclrtSynchronizeStream(stream));
+
+    std::vector<float> hostRes(lenY);
+    ACL_CHECK(aclrtMemcpy(hostRes.data(), sizeY, deviceY, sizeY, ACL_MEMCPY_DEVICE_TO_HOST));
+
+    std::vector<float> hostGolden(lenY);
+    golden::ComputeGemv(options.problemShape, alpha, beta, hostA, layoutA, hostX, layoutX, hostY, layoutY,
+        hostGolden, layoutY);
+    // The order of the atomic adds varies from run to run, so the result is compared within a tolerance.
+    std::vector<uint64_t> errorIndices = golden::CompareData(hostRes, hostGolden, n);
+    if (errorIndices.empty()) {
+        std::cout << "Compare success." << std::endl;
+    } else {
+        std::cerr << "Compare failed. Error count: " << errorIndices.size() << std::endl;
+    }
+
+    ACL_CHECK(aclrtFree(deviceA));
+    ACL_CHECK(aclrtFree(deviceX));
+    ACL_CHECK(aclrtFree(deviceY));
+    ACL_CHECK(aclrtFree(deviceYCopy));
+
+    ACL_CHECK(aclrtDestroyStream(stream));
+    ACL_CHECK(aclrtResetDevice(options.deviceId));
+    ACL_CHECK(aclFinalize());
+}
+
+int main(int argc, const char **argv)
+{
+    Options options;
+    if (options.Parse(argc, argv) != 0) {
+        return -1;
+    }
+    if (options.transA) {
+        RunGemv<layout::ColumnMajor>(options);
+    } else {
+        RunGemv<layout::RowMajor>(options);
+    }
+    return 0;
+}
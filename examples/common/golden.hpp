@@ -11,8 +11,17 @@
 #ifndef EXAMPLES_COMMON_GOLDEN_HPP
 #define EXAMPLES_COMMON_GOLDEN_HPP
 
+#include "golden/activation.hpp"
 #include "golden/compare_data.hpp"
+#include "golden/dynamic_quant.hpp"
+#include "golden/epilogue_visitor.hpp"
 #include "golden/fill_data.hpp"
+#include "golden/int4_matmul.hpp"
 #include "golden/matmul.hpp"
+#include "golden/mixed_precision.hpp"
+#include "golden/norm.hpp"
+#include "golden/quant_matmul_per_group.hpp"
+#include "golden/requant.hpp"
+#include "golden/weight_quant.hpp"
 
 #endif // EXAMPLES_COMMON_GOLDEN_HPP
\ No newline at end of file
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef EXAMPLES_COMMON_GOLDEN_ACTIVATION_HPP
+#define EXAMPLES_COMMON_GOLDEN_ACTIVATION_HPP
+
+#include <cmath>
+#include <cstdint>
+
+namespace Catlass::golden {
+
+// Activations of the epilogue tiles in catlass/epilogue/tile/tile_activation.hpp
+enum class ActivationType : uint32_t {
+    NONE = 0,
+    RELU,
+    GELU,       // tanh approximation
+    FAST_GELU,  // x * sigmoid(1.702 * x)
+    SILU
+};
+
+inline float ComputeActivation(ActivationType type, float x)
+{
+    constexpr float GELU_CUBIC_COEFF = 0.044715f;
+    constexpr float SQRT_2_OVER_PI = 0.7978845608f;
+    constexpr float FAST_GELU_SCALE = 1.702f;
+    switch (type) {
+        case ActivationType::RELU:
+            return x > 0.0f ? x : 0.0f;
+        case ActivationType::GELU:
+            return 0.5f * x * (1.0f + std::tanh(SQRT_2_OVER_PI * (x + GELU_CUBIC_COEFF * x * x * x)));
+        case ActivationType::FAST_GELU:
+            return x / (1.0f + std::exp(-FAST_GELU_SCALE * x));
+        case ActivationType::SILU:
+            return x / (1.0f + std::exp(-x));
+        default:
+            return x;
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_ACTIVATION_HPP
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_DYNAMIC_QUANT_HPP
+#define EXAMPLES_COMMON_GOLDEN_DYNAMIC_QUANT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Catlass::golden {
+
+// Per-token int8 quantization of a row major m x k activation, as done by PerTokenQuantMatrixBlock:
+//   scale = absmax / 127,  q = rint(x * (1 / scale))
+// in fp32, with the scale of an all zero row being 1. perTokenScale holds one scale per row.
+template<class Element>
+void QuantizeActivationPerToken(
+    uint32_t m, uint32_t k, const std::vector<Element> &activation,
+    std::vector<int8_t> &quant, std::vector<float> &perTokenScale
+)
+{
+    constexpr float quantMax = 127.0f;
+    quant.resize(static_cast<size_t>(m) * k);
+    perTokenScale.resize(m);
+    for (uint32_t i = 0; i < m; ++i) {
+        float absMax = 0.0f;
+        for (uint32_t p = 0; p < k; ++p) {
+            absMax = std::max(absMax, std::fabs(static_cast<float>(activation[static_cast<size_t>(i) * k + p])));
+        }
+        float scale = (absMax == 0.0f) ? 1.0f : absMax / quantMax;
+        float scaleInv = 1.0f / scale;
+        perTokenScale[i] = scale;
+        for (uint32_t p = 0; p < k; ++p) {
+            size_t idx = static_cast<size_t>(i) * k + p;
+            // Round half to even, as the vector cast does
+            float q = std::nearbyint(static_cast<float>(activation[idx]) * scaleInv);
+            quant[idx] = static_cast<int8_t>(std::min(std::max(q, -quantMax), quantMax));
+        }
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_DYNAMIC_QUANT_HPP
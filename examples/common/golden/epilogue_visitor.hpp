@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+#ifndef EXAMPLES_COMMON_GOLDEN_EPILOGUE_VISITOR_HPP
+#define EXAMPLES_COMMON_GOLDEN_EPILOGUE_VISITOR_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "catlass/epilogue/fusion/visitor_tree.hpp"
+#include "activation.hpp"
+
+namespace Catlass::golden {
+
+// Host interpreter of an epilogue visitor tree, the reference of Epilogue::Tile::TileVisitor. The tensor slots
+// hold host pointers of the element types named by the tree, m x n tensors are row major with leading
+// dimension ld.
+struct VisitorHostArguments {
+    std::array<void *, Epilogue::Fusion::VISITOR_MAX_TENSORS> tensors{};
+    std::array<int64_t, Epilogue::Fusion::VISITOR_MAX_TENSORS> ld{};
+    std::array<float, Epilogue::Fusion::VISITOR_MAX_SCALARS> scalars{};
+};
+
+template <class Op>
+struct HostVisitorOp;
+
+#define CATLASS_GOLDEN_VISITOR_BINARY_OP(OP, EXPR)                          \
+    template <>                                                             \
+    struct HostVisitorOp<Epilogue::Fusion::OP> {                            \
+        static float Apply(const VisitorHostArguments &, float a, float b)  \
+        {                                                                   \
+            return EXPR;                                                    \
+        }                                                                   \
+    }
+
+CATLASS_GOLDEN_VISITOR_BINARY_OP(OpAdd, a + b);
+CATLASS_GOLDEN_VISITOR_BINARY_OP(OpSub, a - b);
+CATLASS_GOLDEN_VISITOR_BINARY_OP(OpMul, a * b);
+CATLASS_GOLDEN_VISITOR_BINARY_OP(OpDiv, a / b);
+CATLASS_GOLDEN_VISITOR_BINARY_OP(OpMax, std::max(a, b));
+CATLASS_GOLDEN_VISITOR_BINARY_OP(OpMin, std::min(a, b));
+
+#undef CATLASS_GOLDEN_VISITOR_BINARY_OP
+
+#define CATLASS_GOLDEN_VISITOR_UNARY_OP(OP, EXPR)                  \
+    template <>                                                    \
+    struct HostVisitorOp<Epilogue::Fusion::OP> {                   \
+        static float Apply(const VisitorHostArguments &, float a)  \
+        {                                                          \
+            return EXPR;                                           \
+        }                                                          \
+    }
+
+CATLASS_GOLDEN_VISITOR_UNARY_OP(OpRelu, ComputeActivation(ActivationType::RELU, a));
+CATLASS_GOLDEN_VISITOR_UNARY_OP(OpExp, std::exp(a));
+CATLASS_GOLDEN_VISITOR_UNARY_OP(OpAbs, std::fabs(a));
+CATLASS_GOLDEN_VISITOR_UNARY_OP(OpSilu, ComputeActivation(ActivationType::SILU, a));
+CATLASS_GOLDEN_VISITOR_UNARY_OP(OpGelu, ComputeActivation(ActivationType::GELU, a));
+CATLASS_GOLDEN_VISITOR_UNARY_OP(OpFastGelu, ComputeActivation(ActivationType::FAST_GELU, a));
+
+#undef CATLASS_GOLDEN_VISITOR_UNARY_OP
+
+template <uint32_t SCALAR>
+struct HostVisitorOp<Epilogue::Fusion::OpScale<SCALAR>> {
+    static float Apply(const VisitorHostArguments &args, float a)
+    {
+        return a * args.scalars[SCALAR];
+    }
+};
+
+template <uint32_t SCALAR>
+struct HostVisitorOp<Epilogue::Fusion::OpAddScalar<SCALAR>> {
+    static float Apply(const VisitorHostArguments &args, float a)
+    {
+        return a + args.scalars[SCALAR];
+    }
+};
+
+// Visit returns the value of the node at (row, col), acc is the value of C there.
+template <class Node>
+struct HostVisitor;
+
+template <>
+struct HostVisitor<Epilogue::Fusion::Acc> {
+    static float Visit(const VisitorHostArguments &, float acc, uint32_t, uint32_t)
+    {
+        return acc;
+    }
+};
+
+template <uint32_t TENSOR, class Element>
+struct HostVisitor<Epilogue::Fusion::AuxLoad<TENSOR, Element>> {
+    static float Visit(const VisitorHostArguments &args, float, uint32_t row, uint32_t col)
+    {
+        auto *data = static_cast<const Element *>(args.tensors[TENSOR]);
+        return static_cast<float>(data[static_cast<int64_t>(row) * args.ld[TENSOR] + col]);
+    }
+};
+
+template <uint32_t TENSOR, class Element>
+struct HostVisitor<Epilogue::Fusion::RowBroadcast<TENSOR, Element>> {
+    static float Visit(const VisitorHostArguments &args, float, uint32_t, uint32_t col)
+    {
+        return static_cast<float>(static_cast<const Element *>(args.tensors[TENSOR])[col]);
+    }
+};
+
+template <uint32_t TENSOR, class Element>
+struct HostVisitor<Epilogue::Fusion::ColBroadcast<TENSOR, Element>> {
+    static float Visit(const VisitorHostArguments &args, float, uint32_t row, uint32_t)
+    {
+        return static_cast<float>(static_cast<const Element *>(args.tensors[TENSOR])[row]);
+    }
+};
+
+template <class Op, class Child>
+struct HostVisitor<Epilogue::Fusion::Compute<Op, Child>> {
+    static float Visit(const VisitorHostArguments &args, float acc, uint32_t row, uint32_t col)
+    {
+        return HostVisitorOp<Op>::Apply(args, HostVisitor<Child>::Visit(args, acc, row, col));
+    }
+};
+
+template <class Op, class Lhs, class Rhs>
+struct HostVisitor<Epilogue::Fusion::Compute<Op, Lhs, Rhs>> {
+    static float Visit(const VisitorHostArguments &args, float acc, uint32_t row, uint32_t col)
+    {
+        float lhs = HostVisitor<Lhs>::Visit(args, acc, row, col);
+        float rhs = HostVisitor<Rhs>::Visit(args, acc, row, col);
+        return HostVisitorOp<Op>::Apply(args, lhs, rhs);
+    }
+};
+
+template <uint32_t TENSOR, class Child>
+struct HostVisitor<Epilogue::Fusion::ColReduce<TENSOR, Child>> {
+    static float Visit(const VisitorHostArguments &args, float acc, uint32_t row, uint32_t col)
+    {
+        float value = HostVisitor<Child>::Visit(args, acc, row, col);
+        static_cast<float *>(args.tensors[TENSOR])[col] += value;
+        return value;
+    }
+};
+
+template <uint32_t TENSOR, class Element, class Child>
+struct HostVisitor<Epilogue::Fusion::Store<TENSOR, Element, Child>> {
+    static float Visit(const VisitorHostArguments &args, float acc, uint32_t row, uint32_t col)
+    {
+        float value = HostVisitor<Child>::Visit(args, acc, row, col);
+        static_cast<Element *>(args.tensors[TENSOR])[static_cast<int64_t>(row) * args.ld[TENSOR] + col] =
+            static_cast<Element>(value);
+        return value;
+    }
+};
+
+// Evaluates the tree on an m x n row major C. ColReduce outputs are accumulated into, zero fill them first.
+template <class Tree, class ElementC>
+void EvaluateVisitorTree(uint32_t m, uint32_t n, const std::vector<ElementC> &dataC,
+    const VisitorHostArguments &args)
+{
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            float acc = static_cast<float>(dataC[static_cast<size_t>(i) * n + j]);
+            HostVisitor<Tree>::Visit(args, acc, i, j);
+        }
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_EPILOGUE_VISITOR_HPP
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_INT4_MATMUL_HPP
+#define EXAMPLES_COMMON_GOLDEN_INT4_MATMUL_HPP
+
+#include <cstdint>
+#include <vector>
+
+#include "golden/mixed_precision.hpp"
+#include "golden/weight_quant.hpp"
+
+namespace Catlass::golden {
+
+// GM operands of the int4b_t cube matmul are packed two per byte along k, the even k in the low nibble: A is a row
+// major m x k matrix (PackInt4(m, k, a)), B a column major k x n matrix, i.e. n rows of k packed values.
+
+// Pack a row major k x n matrix of int4 values as a column major matrix, two per byte along k.
+inline std::vector<int8_t> PackInt4ColumnMajor(uint32_t k, uint32_t n, const std::vector<int8_t> &quant)
+{
+    std::vector<int8_t> transposed(static_cast<size_t>(k) * n);
+    for (uint32_t r = 0; r < k; ++r) {
+        for (uint32_t c = 0; c < n; ++c) {
+            transposed[static_cast<size_t>(c) * k + r] = quant[static_cast<size_t>(r) * n + c];
+        }
+    }
+    return PackInt4(n, k, transposed);
+}
+
+// Unpack a column major k x n matrix packed along k into a row major k x n matrix of int4 values.
+inline std::vector<int8_t> UnpackInt4ColumnMajor(uint32_t k, uint32_t n, const std::vector<int8_t> &packed)
+{
+    std::vector<int8_t> transposed = UnpackInt4(n, k, packed);
+    std::vector<int8_t> quant(static_cast<size_t>(k) * n);
+    for (uint32_t r = 0; r < k; ++r) {
+        for (uint32_t c = 0; c < n; ++c) {
+            quant[static_cast<size_t>(r) * n + c] = transposed[static_cast<size_t>(c) * k + r];
+        }
+    }
+    return quant;
+}
+
+// golden = A * B with int32_t accumulation, from the packed GM operands of the int4b_t matmul. k must be even.
+inline void ComputeMatmulInt4(
+    uint32_t m, uint32_t n, uint32_t k,
+    const std::vector<int8_t> &packedA, const std::vector<int8_t> &packedB,
+    std::vector<int32_t> &golden
+)
+{
+    ComputeMatmulInt32Accumulate(m, n, k, UnpackInt4(m, k, packedA), UnpackInt4ColumnMajor(k, n, packedB), golden);
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_INT4_MATMUL_HPP
@@ -15,6 +15,8 @@
 #include "catlass/layout/layout.hpp"
 #include "catlass/gemm_coord.hpp"
 #include "catlass/gemv_coord.hpp"
+#include "activation.hpp"
+#include "norm.hpp"
 
 namespace Catlass::golden {
 
@@ -234,6 +236,108 @@ void ComputeMatmulElemWiseAdd(
     }
 }
 
+// matmul bias activation, D = activation(A * B + bias), with bias broadcast to every row. An empty dataBias is
+// treated as a zero bias.
+template<
+    class ElementA, class LayoutA,
+    class ElementB, class LayoutB,
+    class ElementBias,
+    class ElementGolden, class LayoutGolden
+>
+void ComputeMatmulBiasActivation(
+    const GemmCoord &problemShape,
+    const std::vector<ElementA> &dataA, const LayoutA &layoutA,
+    const std::vector<ElementB> &dataB, const LayoutB &layoutB,
+    const std::vector<ElementBias> &dataBias, ActivationType activation,
+    std::vector<ElementGolden> &dataGolden, const LayoutGolden &layoutGolden
+)
+{
+    for (uint32_t i = 0; i < problemShape.m(); ++i) {
+        for (uint32_t j = 0; j < problemShape.n(); ++j) {
+            float accumulator = 0;
+            for (uint32_t k = 0; k < problemShape.k(); ++k) {
+                size_t offsetA = layoutA.GetOffset(MakeCoord(i, k));
+                size_t offsetB = layoutB.GetOffset(MakeCoord(k, j));
+                accumulator += static_cast<float>(dataA[offsetA]) * static_cast<float>(dataB[offsetB]);
+            }
+            if (!dataBias.empty()) {
+                accumulator += static_cast<float>(dataBias[j]);
+            }
+            size_t offsetGolden = layoutGolden.GetOffset(MakeCoord(i, j));
+            dataGolden[offsetGolden] = static_cast<ElementGolden>(ComputeActivation(activation, accumulator));
+        }
+    }
+}
+
+// sum = A * B + residual and dataGolden = gamma * norm(sum) (+ beta), for row major sum and golden
+template <
+    class ElementA, class LayoutA,
+    class ElementB, class LayoutB,
+    class ElementResidual, class ElementGolden
+>
+void ComputeMatmulResidualNorm(
+    const GemmCoord &problemShape,
+    const std::vector<ElementA> &dataA, const LayoutA &layoutA,
+    const std::vector<ElementB> &dataB, const LayoutB &layoutB,
+    const std::vector<ElementResidual> &dataResidual,
+    const std::vector<ElementResidual> &dataGamma, const std::vector<ElementResidual> &dataBeta,
+    NormType normType, float epsilon,
+    std::vector<ElementGolden> &dataSum, std::vector<ElementGolden> &dataGolden
+)
+{
+    uint32_t m = problemShape.m();
+    uint32_t n = problemShape.n();
+    std::vector<float> sum(static_cast<size_t>(m) * n);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            float accumulator = 0;
+            for (uint32_t k = 0; k < problemShape.k(); ++k) {
+                size_t offsetA = layoutA.GetOffset(MakeCoord(i, k));
+                size_t offsetB = layoutB.GetOffset(MakeCoord(k, j));
+                accumulator += static_cast<float>(dataA[offsetA]) * static_cast<float>(dataB[offsetB]);
+            }
+            size_t offset = static_cast<size_t>(i) * n + j;
+            sum[offset] = accumulator + static_cast<float>(dataResidual[offset]);
+            dataSum[offset] = static_cast<ElementGolden>(sum[offset]);
+        }
+    }
+    ComputeRowNorm(normType, m, n, sum, dataGamma, dataBeta, epsilon, dataGolden);
+}
+
+// Grouped expert FFN: dataGolden = SiLU(A * gate) * up for the rows of every group, with the row major k x n gate
+// and up weights of the groups stored one after another.
+template <class ElementGroupList, class ElementA, class ElementB, class ElementGolden>
+void ComputeGroupedMatmulSwiGlu(
+    const GemmCoord &problemShape, uint32_t problemCount, const std::vector<ElementGroupList> &groupList,
+    const std::vector<ElementA> &dataA, const std::vector<ElementB> &dataGate, const std::vector<ElementB> &dataUp,
+    std::vector<ElementGolden> &dataGolden
+)
+{
+    uint32_t n = problemShape.n();
+    uint32_t k = problemShape.k();
+    size_t groupOffsetB = 0;
+    uint32_t startRow = 0;
+    for (uint32_t groupIdx = 0; groupIdx < problemCount; ++groupIdx) {
+        uint32_t endRow = static_cast<uint32_t>(groupList[groupIdx]);
+        for (uint32_t i = startRow; i < endRow; ++i) {
+            for (uint32_t j = 0; j < n; ++j) {
+                float gate = 0;
+                float up = 0;
+                for (uint32_t l = 0; l < k; ++l) {
+                    float a = static_cast<float>(dataA[static_cast<size_t>(i) * k + l]);
+                    size_t offsetB = groupOffsetB + static_cast<size_t>(l) * n + j;
+                    gate += a * static_cast<float>(dataGate[offsetB]);
+                    up += a * static_cast<float>(dataUp[offsetB]);
+                }
+                dataGolden[static_cast<size_t>(i) * n + j] =
+                    static_cast<ElementGolden>(ComputeActivation(ActivationType::SILU, gate) * up);
+            }
+        }
+        groupOffsetB += static_cast<size_t>(k) * n;
+        startRow = endRow;
+    }
+}
+
 template <
     class ElementGroupList, class ElementScale,
     class LayoutB, class LayoutScale, class LayoutPerTokenScale
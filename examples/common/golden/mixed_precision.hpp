@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_MIXED_PRECISION_HPP
+#define EXAMPLES_COMMON_GOLDEN_MIXED_PRECISION_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Catlass::golden {
+
+// References of the cube matmul for the element combinations of Gemm::helper::CubeOperandSupport. Operands are row
+// major, A m x k and B k x n.
+//   A, B                     L0C       output (fixpipe)
+//   half, bf16, float        float     float (NoQuant), half (F322F16), bf16 (F322BF16)
+//   int8_t, int4b_t          int32_t   int32_t (NoQuant)
+// int4b_t operands are passed unpacked as int8_t values in [-8, 7].
+
+enum class FixpipeCast {
+    NO_CAST,
+    F322F16,
+    F322BF16
+};
+
+// Rounds to the nearest fp16 value, ties to even, returned as float
+inline float RoundToHalf(float value)
+{
+    if (std::isnan(value) || std::isinf(value)) {
+        return value;
+    }
+    constexpr float halfOverflow = 65520.0f;
+    constexpr int halfMinNormalExp = -14;
+    constexpr int halfMantissaBits = 10;
+    float absValue = std::fabs(value);
+    if (absValue >= halfOverflow) {
+        return std::copysign(INFINITY, value);
+    }
+    // Quantum of the binade of absValue, subnormals sharing the one of the smallest normal binade
+    int exp = 0;
+    std::frexp(absValue, &exp);
+    int quantumExp = ((exp - 1 < halfMinNormalExp) ? halfMinNormalExp : (exp - 1)) - halfMantissaBits;
+    float rounded = std::ldexp(std::nearbyint(std::ldexp(absValue, -quantumExp)), quantumExp);
+    return std::copysign(rounded, value);
+}
+
+// Rounds to the nearest bf16 value, ties to even, returned as float
+inline float RoundToBfloat16(float value)
+{
+    if (std::isnan(value)) {
+        return value;
+    }
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    uint32_t lsb = (bits >> 16) & 1U;
+    bits = (bits + 0x7FFFU + lsb) & 0xFFFF0000U;
+    float rounded = 0.0f;
+    std::memcpy(&rounded, &bits, sizeof(rounded));
+    return rounded;
+}
+
+inline float ApplyFixpipeCast(float value, FixpipeCast cast)
+{
+    switch (cast) {
+        case FixpipeCast::F322F16:
+            return RoundToHalf(value);
+        case FixpipeCast::F322BF16:
+            return RoundToBfloat16(value);
+        default:
+            return value;
+    }
+}
+
+// Floating point operands, fp32 accumulation and one rounding to the output element
+template<class ElementA, class ElementB>
+void ComputeMatmulFp32Accumulate(
+    uint32_t m, uint32_t n, uint32_t k,
+    const std::vector<ElementA> &a, const std::vector<ElementB> &b,
+    FixpipeCast cast, std::vector<float> &golden
+)
+{
+    golden.assign(static_cast<size_t>(m) * n, 0.0f);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            float accumulator = 0.0f;
+            for (uint32_t p = 0; p < k; ++p) {
+                accumulator += static_cast<float>(a[static_cast<size_t>(i) * k + p]) *
+                    static_cast<float>(b[static_cast<size_t>(p) * n + j]);
+            }
+            golden[static_cast<size_t>(i) * n + j] = ApplyFixpipeCast(accumulator, cast);
+        }
+    }
+}
+
+// Integer operands, exact int32 accumulation
+inline void ComputeMatmulInt32Accumulate(
+    uint32_t m, uint32_t n, uint32_t k,
+    const std::vector<int8_t> &a, const std::vector<int8_t> &b,
+    std::vector<int32_t> &golden
+)
+{
+    golden.assign(static_cast<size_t>(m) * n, 0);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            int32_t accumulator = 0;
+            for (uint32_t p = 0; p < k; ++p) {
+                accumulator += static_cast<int32_t>(a[static_cast<size_t>(i) * k + p]) *
+                    static_cast<int32_t>(b[static_cast<size_t>(p) * n + j]);
+            }
+            golden[static_cast<size_t>(i) * n + j] = accumulator;
+        }
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_MIXED_PRECISION_HPP
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_NORM_HPP
+#define EXAMPLES_COMMON_GOLDEN_NORM_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Catlass::golden {
+
+// Norms of the EpilogueAtlasA2ResidualNorm block epilogue
+enum class NormType : uint32_t {
+    RMS_NORM = 0,
+    LAYER_NORM
+};
+
+// out = gamma * norm(s) (+ beta) over every row of the row major m x n matrix s, accumulated in double:
+//   RMSNorm:   s / sqrt(sum(s^2) / n + epsilon)
+//   LayerNorm: (s - mean) / sqrt(sum((s - mean)^2) / n + epsilon), beta is skipped if it is empty
+template <class ElementParam, class ElementOut>
+void ComputeRowNorm(
+    NormType type, uint32_t m, uint32_t n, const std::vector<float> &s,
+    const std::vector<ElementParam> &gamma, const std::vector<ElementParam> &beta, float epsilon,
+    std::vector<ElementOut> &out
+)
+{
+    bool isLayerNorm = (type == NormType::LAYER_NORM);
+    for (uint32_t i = 0; i < m; ++i) {
+        const float *row = s.data() + static_cast<size_t>(i) * n;
+        double mean = 0.0;
+        if (isLayerNorm) {
+            for (uint32_t j = 0; j < n; ++j) {
+                mean += row[j];
+            }
+            mean /= n;
+        }
+        double squareSum = 0.0;
+        for (uint32_t j = 0; j < n; ++j) {
+            double centered = row[j] - mean;
+            squareSum += centered * centered;
+        }
+        double scale = 1.0 / std::sqrt(squareSum / n + epsilon);
+        for (uint32_t j = 0; j < n; ++j) {
+            double value = (row[j] - mean) * scale * static_cast<double>(gamma[j]);
+            if (isLayerNorm && !beta.empty()) {
+                value += static_cast<double>(beta[j]);
+            }
+            out[static_cast<size_t>(i) * n + j] = static_cast<ElementOut>(static_cast<float>(value));
+        }
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_NORM_HPP
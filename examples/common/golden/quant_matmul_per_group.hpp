@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_QUANT_MATMUL_PER_GROUP_HPP
+#define EXAMPLES_COMMON_GOLDEN_QUANT_MATMUL_PER_GROUP_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Catlass::golden {
+
+// Block-wise W8A8 recipe of QuantMatmulPerGroup. The k axis is split into groups of groupSize. A row major m x k
+// activation has one fp32 scale per row and group, stored as a row major groupNum x m matrix; a row major k x n
+// weight has one fp32 scale per column and group, stored as a row major groupNum x n matrix.
+
+constexpr int32_t INT8_MAX_VALUE = 127;
+
+// Symmetric int8 quantization of every 1 x groupSize block of the activation
+inline void QuantizeActivationPerGroup(
+    uint32_t m, uint32_t k, uint32_t groupSize, const std::vector<float> &activation,
+    std::vector<int8_t> &quant, std::vector<float> &perTokenScale
+)
+{
+    uint32_t groupNum = (k + groupSize - 1) / groupSize;
+    quant.resize(static_cast<size_t>(m) * k);
+    perTokenScale.resize(static_cast<size_t>(groupNum) * m);
+    for (uint32_t g = 0; g < groupNum; ++g) {
+        uint32_t colBegin = g * groupSize;
+        uint32_t colEnd = std::min(k, colBegin + groupSize);
+        for (uint32_t i = 0; i < m; ++i) {
+            float absMax = 0.0f;
+            for (uint32_t p = colBegin; p < colEnd; ++p) {
+                absMax = std::max(absMax, std::fabs(activation[static_cast<size_t>(i) * k + p]));
+            }
+            float s = (absMax == 0.0f) ? 1.0f : absMax / INT8_MAX_VALUE;
+            perTokenScale[static_cast<size_t>(g) * m + i] = s;
+            for (uint32_t p = colBegin; p < colEnd; ++p) {
+                size_t idx = static_cast<size_t>(i) * k + p;
+                float q = std::round(activation[idx] / s);
+                quant[idx] = static_cast<int8_t>(std::min(std::max(q, -127.0f), 127.0f));
+            }
+        }
+    }
+}
+
+// Symmetric int8 quantization of every groupSize x blockN block of the weight, the scale of a block being repeated
+// over its columns
+inline void QuantizeWeightPerBlock(
+    uint32_t k, uint32_t n, uint32_t groupSize, uint32_t blockN, const std::vector<float> &weight,
+    std::vector<int8_t> &quant, std::vector<float> &scale
+)
+{
+    uint32_t groupNum = (k + groupSize - 1) / groupSize;
+    quant.resize(static_cast<size_t>(k) * n);
+    scale.resize(static_cast<size_t>(groupNum) * n);
+    for (uint32_t g = 0; g < groupNum; ++g) {
+        uint32_t rowBegin = g * groupSize;
+        uint32_t rowEnd = std::min(k, rowBegin + groupSize);
+        for (uint32_t colBegin = 0; colBegin < n; colBegin += blockN) {
+            uint32_t colEnd = std::min(n, colBegin + blockN);
+            float absMax = 0.0f;
+            for (uint32_t p = rowBegin; p < rowEnd; ++p) {
+                for (uint32_t j = colBegin; j < colEnd; ++j) {
+                    absMax = std::max(absMax, std::fabs(weight[static_cast<size_t>(p) * n + j]));
+                }
+            }
+            float s = (absMax == 0.0f) ? 1.0f : absMax / INT8_MAX_VALUE;
+            for (uint32_t j = colBegin; j < colEnd; ++j) {
+                scale[static_cast<size_t>(g) * n + j] = s;
+            }
+            for (uint32_t p = rowBegin; p < rowEnd; ++p) {
+                for (uint32_t j = colBegin; j < colEnd; ++j) {
+                    size_t idx = static_cast<size_t>(p) * n + j;
+                    float q = std::round(weight[idx] / s);
+                    quant[idx] = static_cast<int8_t>(std::min(std::max(q, -127.0f), 127.0f));
+                }
+            }
+        }
+    }
+}
+
+// The fp32 accumulators of the kernel, with its rounding: the int32 partial sum of every group is exact, then
+//   t = (float(partial) * scale[g][j]) * perTokenScale[g][i],  acc = (g == 0) ? t : acc + t
+// every operation being rounded to fp32. D is the result rounded once to its element type.
+inline void ComputeQuantMatmulPerGroup(
+    uint32_t m, uint32_t n, uint32_t k, uint32_t groupSize,
+    const std::vector<int8_t> &a, const std::vector<int8_t> &b,
+    const std::vector<float> &scale, const std::vector<float> &perTokenScale,
+    std::vector<float> &golden
+)
+{
+    uint32_t groupNum = (k + groupSize - 1) / groupSize;
+    golden.assign(static_cast<size_t>(m) * n, 0.0f);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            float acc = 0.0f;
+            for (uint32_t g = 0; g < groupNum; ++g) {
+                uint32_t kBegin = g * groupSize;
+                uint32_t kEnd = std::min(k, kBegin + groupSize);
+                int32_t partial = 0;
+                for (uint32_t p = kBegin; p < kEnd; ++p) {
+                    partial += static_cast<int32_t>(a[static_cast<size_t>(i) * k + p]) *
+                        static_cast<int32_t>(b[static_cast<size_t>(p) * n + j]);
+                }
+                float t = static_cast<float>(partial) * scale[static_cast<size_t>(g) * n + j];
+                t = t * perTokenScale[static_cast<size_t>(g) * m + i];
+                acc = (g == 0) ? t : acc + t;
+            }
+            golden[static_cast<size_t>(i) * n + j] = acc;
+        }
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_QUANT_MATMUL_PER_GROUP_HPP
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_REQUANT_HPP
+#define EXAMPLES_COMMON_GOLDEN_REQUANT_HPP
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Catlass::golden {
+
+// Fixpipe requantization of int32_t accumulators to int8_t (REQ8 / VREQ8). The quant parameter is decoded from
+// its 64 bit encoding (Gemm::Tile::FixpipeRequantParam) the way the fixpipe reads it:
+// - the scale is the fp32 value of bits [31:13], i.e. the encoded scale truncated to 10 mantissa bits;
+// - the offset is the 9 bit signed integer of bits [45:37].
+// out = saturate(round(acc * scale) + offset), the product being exact and rounded half to even.
+// The field layout is the one documented for the uint64 quant parameter of the CANN quant matmul operators
+// (torch_npu.npu_trans_quant_param: the fp32 scale masked with 0xFFFFE000, the offset as 9 bits at bit 37, bit 46
+// set), which the Ascend C Fixpipe API takes as FixpipeParamsV220::deqScalar for QuantMode_t::REQ8 and per channel
+// from L1 for VREQ8. The rounding of the product and the order of the offset and the saturation are not documented
+// there; they are this model's assumption and pending validation on hardware.
+
+inline float DecodeRequantScale(uint64_t param)
+{
+    uint32_t bits = static_cast<uint32_t>(param) & 0xFFFFE000u;
+    float scale;
+    std::memcpy(&scale, &bits, sizeof(scale));
+    return scale;
+}
+
+inline int32_t DecodeRequantOffset(uint64_t param)
+{
+    int32_t offset = static_cast<int32_t>((param >> 37) & 0x1FF);
+    // Sign extend the 9 bit field
+    return (offset & 0x100) ? (offset - 0x200) : offset;
+}
+
+inline int8_t RequantInt32ToInt8(int32_t acc, uint64_t param)
+{
+    // An int32_t times a float with 11 significant bits is exact in double.
+    double scaled = std::nearbyint(static_cast<double>(acc) * static_cast<double>(DecodeRequantScale(param)));
+    double shifted = scaled + static_cast<double>(DecodeRequantOffset(param));
+    if (shifted > 127.0) {
+        return 127;
+    }
+    if (shifted < -128.0) {
+        return -128;
+    }
+    return static_cast<int8_t>(shifted);
+}
+
+// Requantize a row major m x n accumulator with one parameter (per tensor) or n parameters (per channel).
+inline void ComputeRequant(
+    uint32_t m, uint32_t n,
+    const std::vector<int32_t> &acc, const std::vector<uint64_t> &params,
+    std::vector<int8_t> &out
+)
+{
+    bool perChannel = params.size() > 1;
+    out.resize(static_cast<size_t>(m) * n);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            size_t idx = static_cast<size_t>(i) * n + j;
+            out[idx] = RequantInt32ToInt8(acc[idx], params[perChannel ? j : 0]);
+        }
+    }
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_REQUANT_HPP
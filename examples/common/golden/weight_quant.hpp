@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef EXAMPLES_COMMON_GOLDEN_WEIGHT_QUANT_HPP
+#define EXAMPLES_COMMON_GOLDEN_WEIGHT_QUANT_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace Catlass::golden {
+
+// Group-wise weight quantization of WeightOnlyQuantMatmul. A row major k x n weight W is quantized to signed
+// bits-wide integers Q with one scale and one zero point per column and group of groupSize rows along k, stored as
+// row major ceil(k / groupSize) x n matrices: W[r][c] ~ (Q[r][c] - zero[r / groupSize][c]) * scale[r / groupSize][c].
+// Symmetric weights have no zero points.
+
+inline int32_t QuantMin(uint32_t bits)
+{
+    return -(1 << (bits - 1));
+}
+
+inline int32_t QuantMax(uint32_t bits)
+{
+    return (1 << (bits - 1)) - 1;
+}
+
+template <class ElementScale>
+void QuantizeWeightPerGroup(
+    uint32_t k, uint32_t n, uint32_t groupSize, uint32_t bits, bool symmetric,
+    const std::vector<float> &weight, std::vector<int8_t> &quant,
+    std::vector<ElementScale> &scale, std::vector<ElementScale> &zero
+)
+{
+    uint32_t groupNum = (k + groupSize - 1) / groupSize;
+    int32_t qMin = QuantMin(bits);
+    int32_t qMax = QuantMax(bits);
+    quant.resize(static_cast<size_t>(k) * n);
+    scale.resize(static_cast<size_t>(groupNum) * n);
+    zero.resize(symmetric ? 0 : static_cast<size_t>(groupNum) * n);
+    for (uint32_t g = 0; g < groupNum; ++g) {
+        uint32_t rowBegin = g * groupSize;
+        uint32_t rowEnd = std::min(k, rowBegin + groupSize);
+        for (uint32_t j = 0; j < n; ++j) {
+            float minValue = 0.0f;
+            float maxValue = 0.0f;
+            for (uint32_t i = rowBegin; i < rowEnd; ++i) {
+                float w = weight[static_cast<size_t>(i) * n + j];
+                minValue = std::min(minValue, w);
+                maxValue = std::max(maxValue, w);
+            }
+            float s;
+            float z = 0.0f;
+            if (symmetric) {
+                s = std::max(std::fabs(minValue), std::fabs(maxValue)) / static_cast<float>(qMax);
+            } else {
+                s = (maxValue - minValue) / static_cast<float>(qMax - qMin);
+            }
+            if (s == 0.0f) {
+                s = 1.0f;
+            }
+            // Quantize with the scale as stored, so that dequantization only rounds once
+            ElementScale storedScale = static_cast<ElementScale>(s);
+            s = static_cast<float>(storedScale);
+            scale[static_cast<size_t>(g) * n + j] = storedScale;
+            if (!symmetric) {
+                z = std::round(static_cast<float>(qMin) - minValue / s);
+                z = std::min(std::max(z, static_cast<float>(qMin)), static_cast<float>(qMax));
+                zero[static_cast<size_t>(g) * n + j] = static_cast<ElementScale>(z);
+            }
+            for (uint32_t i = rowBegin; i < rowEnd; ++i) {
+                size_t idx = static_cast<size_t>(i) * n + j;
+                float q = std::round(weight[idx] / s + z);
+                q = std::min(std::max(q, static_cast<float>(qMin)), static_cast<float>(qMax));
+                quant[idx] = static_cast<int8_t>(q);
+            }
+        }
+    }
+}
+
+// out[r][c] = (Q[r][c] - zero) * scale in float, rounded once to ElementOut. An empty zero means symmetric weights.
+template <class ElementScale, class ElementOut>
+void DequantizeWeightPerGroup(
+    uint32_t k, uint32_t n, uint32_t groupSize, const std::vector<int8_t> &quant,
+    const std::vector<ElementScale> &scale, const std::vector<ElementScale> &zero,
+    std::vector<ElementOut> &out
+)
+{
+    out.resize(static_cast<size_t>(k) * n);
+    for (uint32_t i = 0; i < k; ++i) {
+        size_t groupOffset = static_cast<size_t>(i / groupSize) * n;
+        for (uint32_t j = 0; j < n; ++j) {
+            float s = static_cast<float>(scale[groupOffset + j]);
+            float z = zero.empty() ? 0.0f : static_cast<float>(zero[groupOffset + j]);
+            size_t idx = static_cast<size_t>(i) * n + j;
+            out[idx] = static_cast<ElementOut>((static_cast<float>(quant[idx]) - z) * s);
+        }
+    }
+}
+
+// Pack the int4 values of a row major k x n matrix two per byte along n, the even column in the low nibble.
+inline std::vector<int8_t> PackInt4(uint32_t k, uint32_t n, const std::vector<int8_t> &quant)
+{
+    std::vector<int8_t> packed(static_cast<size_t>(k) * n / 2);
+    for (size_t idx = 0; idx < packed.size(); ++idx) {
+        uint8_t low = static_cast<uint8_t>(quant[idx * 2]) & 0xF;
+        uint8_t high = static_cast<uint8_t>(quant[idx * 2 + 1]) & 0xF;
+        packed[idx] = static_cast<int8_t>(static_cast<uint8_t>(low | (high << 4)));
+    }
+    return packed;
+}
+
+inline std::vector<int8_t> UnpackInt4(uint32_t k, uint32_t n, const std::vector<int8_t> &packed)
+{
+    std::vector<int8_t> quant(static_cast<size_t>(k) * n);
+    for (size_t idx = 0; idx < packed.size(); ++idx) {
+        uint8_t byte = static_cast<uint8_t>(packed[idx]);
+        // Sign extend every nibble
+        quant[idx * 2] = static_cast<int8_t>(static_cast<int8_t>(byte << 4) >> 4);
+        quant[idx * 2 + 1] = static_cast<int8_t>(static_cast<int8_t>(byte) >> 4);
+    }
+    return quant;
+}
+
+} // namespace Catlass::golden
+
+#endif // EXAMPLES_COMMON_GOLDEN_WEIGHT_QUANT_HPP
@@ -206,14 +206,18 @@ std::vector<at::Tensor> RunGroupedMatmul(const std::vector<at::Tensor> &mat1, co
         kernelInfo.split = KernelInfo::GMMSplit::SPLIT_M;
     }
     const size_t problemCount = kernelInfo.groupList.size();
+    aclrtStream stream = c10_npu::getCurrentNPUStream().stream(false);
 
-    // allocate contiguous memory for matA, B, C
-    uint8_t *deviceA{nullptr};
-    uint8_t *deviceB{nullptr};
-    uint8_t *deviceC{nullptr};
-    aclrtMalloc(reinterpret_cast<void **>(&deviceA), totalSizeList[0], ACL_MEM_MALLOC_HUGE_FIRST);
-    aclrtMalloc(reinterpret_cast<void **>(&deviceB), totalSizeList[1], ACL_MEM_MALLOC_HUGE_FIRST);
-    aclrtMalloc(reinterpret_cast<void **>(&deviceC), totalSizeList[2], ACL_MEM_MALLOC_HUGE_FIRST);
+    // allocate contiguous memory for matA, B, C from the stream ordered pool, every copy below runs on the same stream
+    uint8_t *deviceA = AllocateStreamMemory(totalSizeList[0], stream);
+    uint8_t *deviceB = AllocateStreamMemory(totalSizeList[1], stream);
+    uint8_t *deviceC = AllocateStreamMemory(totalSizeList[2], stream);
+    if (deviceA == nullptr || deviceB == nullptr || deviceC == nullptr) {
+        FreeStreamMemory(deviceA);
+        FreeStreamMemory(deviceB);
+        FreeStreamMemory(deviceC);
+        throw std::runtime_error("out of device memory");
+    }
 
     // copy non contiguous tensors to allocated contiguous memory, reserve the origin address for kernel execution
     uint8_t *baseDeviceA{deviceA};
@@ -226,10 +230,10 @@ std::vector<at::Tensor> RunGroupedMatmul(const std::vector<at::Tensor> &mat1, co
         at::Tensor currentMat2 = mat2[i];
         int64_t currentMat1Size = currentMat1.nbytes();
         int64_t currentMat2Size = currentMat2.nbytes();
-        aclrtMemcpy(deviceA, currentMat1Size, currentMat1.storage().data(), currentMat1Size,
-                    ACL_MEMCPY_DEVICE_TO_DEVICE);
-        aclrtMemcpy(deviceB, currentMat2Size, currentMat2.storage().data(), currentMat2Size,
-                    ACL_MEMCPY_DEVICE_TO_DEVICE);
+        aclrtMemcpyAsync(deviceA, currentMat1Size, currentMat1.storage().data(), currentMat1Size,
+                         ACL_MEMCPY_DEVICE_TO_DEVICE, stream);
+        aclrtMemcpyAsync(deviceB, currentMat2Size, currentMat2.storage().data(), currentMat2Size,
+                         ACL_MEMCPY_DEVICE_TO_DEVICE, stream);
         deviceA += currentMat1Size;
         deviceB += currentMat2Size;
     }
@@ -240,15 +244,14 @@ std::vector<at::Tensor> RunGroupedMatmul(const std::vector<at::Tensor> &mat1, co
     kernelInfo.inputAddr[1] = baseDeviceB;
     kernelInfo.outputAddr.resize(1);
     kernelInfo.outputAddr[0] = baseDeviceC;
-    aclrtStream stream = c10_npu::getCurrentNPUStream().stream(false);
     uint32_t aicCoreNum = platform_ascendc::PlatformAscendCManager::GetInstance()->GetCoreNumAic();
 
     // execution
     GroupedMatmul(aicCoreNum, stream, kernelInfo);
 
-    // after execution, the contiguous memory of input will not be used anymore, can be free
-    aclrtFree(baseDeviceA);
-    aclrtFree(baseDeviceB);
+    // the contiguous memory of input is not used by later work, it goes back to the pool without waiting for the kernel
+    FreeStreamMemory(baseDeviceA);
+    FreeStreamMemory(baseDeviceB);
 
     // allocate output tensor memory
     torch::Dtype outputDataType = TypeStrToTorchDtype(outDType, mat1.at(0).scalar_type());
@@ -262,13 +265,13 @@ std::vector<at::Tensor> RunGroupedMatmul(const std::vector<at::Tensor> &mat1, co
 
         resultList.push_back(result);
         int64_t resultSize = result.nbytes();
-        aclrtMemcpy(const_cast<void *>(result.storage().data()), resultSize, deviceC, resultSize,
-                    ACL_MEMCPY_DEVICE_TO_DEVICE);
+        aclrtMemcpyAsync(const_cast<void *>(result.storage().data()), resultSize, deviceC, resultSize,
+                         ACL_MEMCPY_DEVICE_TO_DEVICE, stream);
         deviceC += resultSize;
     }
 
     // free
-    aclrtFree(baseDeviceC);
+    FreeStreamMemory(baseDeviceC);
     return resultList;
 }
 
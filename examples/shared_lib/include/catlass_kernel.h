@@ -14,6 +14,7 @@
 
 #include <acl/acl.h>
 
+#include <string>
 #include <vector>
 
 namespace CatlassKernel {
@@ -29,6 +30,8 @@ struct KernelInfo {
     uint32_t k = 1;
     bool transA = false;
     bool transB = false;
+    // B (inputAddr[1]) is pre-packed by PackWeight, currently supported by BasicMatmul.
+    bool packedB = false;
     std::vector<int32_t> groupList;
     GMMSplit split = GMMSplit::SPLIT_M;
     std::vector<uint8_t *> inputAddr;
@@ -38,6 +41,75 @@ struct KernelInfo {
 void BasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo);
 void GroupedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo);
 void OptimizedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo);
+// OptimizedMatmul keeps a plan with its padding workspace per shape and stream, and runs asynchronously on the
+// stream. If the workspace of a new plan can not be allocated, nothing is launched and an error is printed.
+// Drop the cached plans, their workspaces go back to the stream memory pool.
+void ClearOptimizedMatmulPlans();
+
+// Stream ordered memory pool used for every transient device buffer of the library. A block freed after enqueuing
+// the work that uses it is cached per stream and size class, and handed out again only for the same stream, so
+// neither free nor reuse waits for the device. Use it for staging buffers around the ops as well.
+uint8_t *AllocateStreamMemory(size_t size, aclrtStream stream);
+void FreeStreamMemory(uint8_t *ptr);
+// Give the cached blocks (of one stream, e.g. before destroying it) back to the device, after synchronizing their
+// streams. Call it with ClearOptimizedMatmulPlans before resetting the device.
+void ReleaseStreamMemory();
+void ReleaseStreamMemory(aclrtStream stream);
+
+// Small per launch metadata (group lists, sequence lengths, block tables) goes through a ring of pinned host memory
+// with a device mirror: StageMetadata copies the data into the ring, enqueues its upload on the stream and returns
+// the device address to pass to the kernel. Call CommitMetadata on the stream after enqueuing the launches that read
+// the staged data, the ring reuses a slot only once the work before its commit has finished. StageMetadata returns
+// nullptr if the data does not fit (the ring holds CATLASS_STAGING_RING_SIZE bytes, 1MB by default, 0 disables it),
+// upload it another way then.
+uint8_t *StageMetadata(void const *data, size_t size, aclrtStream stream);
+void CommitMetadata(aclrtStream stream);
+
+// Offline weight packing for BasicMatmul: PackWeight reorders the host k x n B (row major, or column major if
+// transB is set) into the fractal format the cube reads it in from L1 (zN, or nZ if transB is set), so that the
+// kernel loads it with contiguous copies. The result does not depend on the tile configuration. Copy the
+// GetPackedWeightSize bytes to the device and set packedB. UnpackWeight restores the original bytes exactly.
+// Both return false if the input dtype can not be packed.
+size_t GetPackedWeightSize(KernelInfo const &kernelInfo);
+bool PackWeight(KernelInfo const &kernelInfo, void const *hostB, void *hostPacked);
+bool UnpackWeight(KernelInfo const &kernelInfo, void const *hostPacked, void *hostB);
+
+// Benchmark every compiled BasicMatmul configuration on the given problem and record the fastest one
+// for its shape bucket. The candidates write into a scratch output from the stream memory pool, outputAddr is
+// neither read nor written. Only fp16 problems with row major A and B (transA and transB unset, packedB unset) are
+// tunable, the function returns false for any other problem. The records are keyed by layout as well, so
+// BasicMatmul calls with a transposed or packed operand never hit them and use the shape class selection.
+bool TuneBasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo, uint32_t repeat = 10);
+
+// Registered ops (currently "basic_matmul") hold several precompiled kernels and pick one by dtype, layout
+// and shape class of the problem.
+// QueryKernel returns the name of the kernel the op would run, or an empty string if none matches.
+std::string QueryKernel(const char *op, KernelInfo const &kernelInfo);
+std::vector<std::string> ListKernels(const char *op);
+// Force the named kernel for its op whenever it supports the dtype and layouts of the problem.
+bool OverrideKernel(const char *name);
+void ClearKernelOverride(const char *op);
+
+// The tuning database is also loaded once from CATLASS_TUNING_DB_PATH on first use.
+bool LoadTuningDatabase(const char *path);
+bool SaveTuningDatabase(const char *path);
+
+// The kernels of each op live in a separate library (libcatlass_kernel_<group>.so, next to libcatlass_kernel.so or
+// in CATLASS_KERNEL_LIB_DIR) that is loaded on the first call of the op. Preload the named groups ("basic_matmul",
+// "grouped_matmul", "optimized_matmul"), or all of them if the list is empty, to move that cost to startup.
+// Returns the number of groups that are loaded.
+size_t PreloadKernelGroups(std::vector<std::string> const &groups = {});
+std::vector<std::string> LoadedKernelGroups();
+
+// Optional shape JIT for BasicMatmul: once a shape has run hotThreshold times on the default kernel, a copy of the
+// kernel with that shape as compile time constants is built with bisheng in the background and cached in cacheDir
+// (reused across processes). Calls use the generic kernel until the specialized binary is ready.
+// It is also enabled on first use if CATLASS_JIT_CACHE_DIR (and optionally CATLASS_JIT_HOT_THRESHOLD) is set.
+// Returns false if the JIT is already enabled with another directory.
+bool EnableShapeJit(const char *cacheDir, uint32_t hotThreshold = 16);
+void DisableShapeJit();
+// Wait until every pending specialization is built, e.g. at the end of a warm up.
+void WaitShapeJit();
 
 }
 
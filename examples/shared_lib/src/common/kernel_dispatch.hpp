@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_COMMON_KERNEL_DISPATCH_HPP
+#define SHARED_LIB_COMMON_KERNEL_DISPATCH_HPP
+
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "registry/kernel_registry.hpp"
+
+namespace CatlassKernel {
+
+using KernelLauncher = void (*)(uint32_t blockNum, aclrtStream stream, KernelInfo const &kernelInfo);
+using KernelRegistry = Registry::KernelRegistry<KernelLauncher>;
+
+/// Process wide registry, every op registers its kernels when its kernel group is loaded.
+KernelRegistry &GetKernelRegistry();
+
+/// Pick the kernel of the op for the problem. The tuning database record, if any, is passed as the preferred kernel.
+KernelRegistry::Entry const *SelectKernel(const char *op, KernelInfo const &kernelInfo);
+
+void RegisterBasicMatmulKernels(KernelRegistry &registry);
+
+inline Registry::KernelQuery MakeKernelQuery(const char *op, KernelInfo const &kernelInfo)
+{
+    return Registry::KernelQuery{op, static_cast<uint32_t>(kernelInfo.inputDataType),
+        kernelInfo.transA, kernelInfo.transB, kernelInfo.m, kernelInfo.n, kernelInfo.k};
+}
+
+} // namespace CatlassKernel
+
+#endif // SHARED_LIB_COMMON_KERNEL_DISPATCH_HPP
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_COMMON_KERNEL_GROUP_HPP
+#define SHARED_LIB_COMMON_KERNEL_GROUP_HPP
+
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "loader/kernel_group_loader.hpp"
+
+namespace CatlassKernel {
+
+// Implementations of the public entries, each defined in the library of its kernel group
+// (libcatlass_kernel_<group>.so). The functions of catlass_kernel.h load the group on first call and forward here.
+namespace Impl {
+void BasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo);
+bool TuneBasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo, uint32_t repeat);
+void GroupedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo);
+void OptimizedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo);
+void ClearOptimizedMatmulPlans();
+} // namespace Impl
+
+struct KernelGroupInfo {
+    const char *name;
+    std::vector<std::string> kernelIds;
+};
+
+/// Kernel groups of the library and the kernel IDs (entry names) each one exports.
+/// A group named after an op also registers the kernels of that op in the KernelRegistry when it is loaded.
+inline std::vector<KernelGroupInfo> const &KernelGroups()
+{
+    static const std::vector<KernelGroupInfo> GROUPS = {
+        {"basic_matmul", {"BasicMatmul", "TuneBasicMatmul"}},
+        {"grouped_matmul", {"GroupedMatmul"}},
+        {"optimized_matmul", {"OptimizedMatmul", "ClearOptimizedMatmulPlans"}},
+    };
+    return GROUPS;
+}
+
+/// Process wide loader with every group of KernelGroups() declared.
+Loader::KernelGroupLoader &GetKernelGroupLoader();
+
+/// Entry of the kernel ID cast to the type of its Impl function, loading its group on first use,
+/// e.g. FindKernelEntry<decltype(&Impl::GroupedMatmul)>("GroupedMatmul").
+template <class Func>
+Func FindKernelEntry(const char *kernelId)
+{
+    return reinterpret_cast<Func>(GetKernelGroupLoader().Find(kernelId));
+}
+
+} // namespace CatlassKernel
+
+#define CATLASS_KERNEL_ENTRY(FUNC) \
+    CatlassKernel::Loader::KernelEntry{#FUNC, reinterpret_cast<void *>(&CatlassKernel::Impl::FUNC)}
+
+/// Export the entries of a kernel group, e.g.
+/// CATLASS_KERNEL_GROUP(grouped_matmul, CATLASS_KERNEL_ENTRY(GroupedMatmul))
+#define CATLASS_KERNEL_GROUP(GROUP, ...)                                                            \
+    extern "C" __attribute__((visibility("default")))                                              \
+    CatlassKernel::Loader::KernelEntry const *CatlassKernelGroup_##GROUP(size_t *entryNum)         \
+    {                                                                                               \
+        static const CatlassKernel::Loader::KernelEntry ENTRIES[] = {__VA_ARGS__};                  \
+        *entryNum = sizeof(ENTRIES) / sizeof(ENTRIES[0]);                                           \
+        return ENTRIES;                                                                             \
+    }
+
+#endif // SHARED_LIB_COMMON_KERNEL_GROUP_HPP
@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_COMMON_SHAPE_JIT_HPP
+#define SHARED_LIB_COMMON_SHAPE_JIT_HPP
+
+#include <string>
+
+#include <acl/acl.h>
+
+#include "jit/shape_codegen.hpp"
+
+namespace CatlassKernel {
+
+/// Host launcher exported by every JIT binary as Jit::JIT_LAUNCH_SYMBOL.
+using JitLauncher = void (*)(uint32_t blockNum, aclrtStream stream, uint8_t *gmA, uint8_t *gmB, uint8_t *gmC);
+
+/// Spec of a kernel body defined in one of the headers under src/, stamped with the fingerprint of this build.
+Jit::JitKernelSpec MakeJitKernelSpec(std::string const &op, std::string const &header, std::string const &body);
+
+/// Launcher specialized for the shape, or nullptr while the shape JIT is disabled, the shape is not hot yet or
+/// its binary is still being built. The caller then runs the generic kernel.
+JitLauncher FindJitLauncher(Jit::JitKernelSpec const &spec, Jit::JitShape const &shape);
+
+} // namespace CatlassKernel
+
+#endif // SHARED_LIB_COMMON_SHAPE_JIT_HPP
@@ -1,25 +1,246 @@
 #include "kernel/basic_matmul.hpp"
 
+#include <array>
+#include <iostream>
+#include <string>
+#include <type_traits>
+#include <utility>
+
 #include <acl/acl.h>
 
 #include "catlass_kernel.h"
 #include "common.hpp"
+#include "kernel_dispatch.hpp"
+#include "kernel_group.hpp"
+#include "shape_jit.hpp"
+#include "registry/basic_matmul_kernels.hpp"
+#include "tuning/autotuner.hpp"
+#include "tuning/basic_matmul_configs.hpp"
 
 namespace CatlassKernel {
 using namespace Catlass;
 
+namespace {
+using LayoutC = layout::RowMajor;
+using InDType = half;
+using OutDType = half;
+
+GemmCoord MakeProblemShape(KernelInfo const &kernelInfo)
+{
+    return GemmCoord{kernelInfo.m, kernelInfo.n, kernelInfo.k};
+}
+
+template <bool TRANS_A, bool TRANS_B>
+void LaunchBasicMatmulDefault(uint32_t blockNum, aclrtStream stream, KernelInfo const &kernelInfo)
+{
+    using LayoutA = typename Transpose2Layout<TRANS_A>::layout;
+    using LayoutB = typename Transpose2Layout<TRANS_B>::layout;
+    basic_matmul<LayoutA, LayoutB, LayoutC, InDType, OutDType><<<blockNum, nullptr, stream>>>(
+        MakeProblemShape(kernelInfo), kernelInfo.inputAddr.at(0), kernelInfo.inputAddr.at(1),
+        kernelInfo.outputAddr.at(0));
+}
+
+template <bool TRANS_A, bool TRANS_B>
+void LaunchBasicMatmulPreload(uint32_t blockNum, aclrtStream stream, KernelInfo const &kernelInfo)
+{
+    using LayoutA = typename Transpose2Layout<TRANS_A>::layout;
+    using LayoutB = typename Transpose2Layout<TRANS_B>::layout;
+    basic_matmul_preload<LayoutA, LayoutB, LayoutC, InDType, OutDType><<<blockNum, nullptr, stream>>>(
+        MakeProblemShape(kernelInfo), kernelInfo.inputAddr.at(0), kernelInfo.inputAddr.at(1),
+        kernelInfo.outputAddr.at(0));
+}
+
+// B packed offline by PackWeight into the format it has in L1, zN for a row major B and nZ for a column major one.
+template <bool TRANS_A, bool TRANS_B>
+void LaunchBasicMatmulPacked(uint32_t blockNum, aclrtStream stream, KernelInfo const &kernelInfo)
+{
+    using LayoutA = typename Transpose2Layout<TRANS_A>::layout;
+    using LayoutB = std::conditional_t<TRANS_B, layout::nZ, layout::zN>;
+    basic_matmul<LayoutA, LayoutB, LayoutC, InDType, OutDType><<<blockNum, nullptr, stream>>>(
+        MakeProblemShape(kernelInfo), kernelInfo.inputAddr.at(0), kernelInfo.inputAddr.at(1),
+        kernelInfo.outputAddr.at(0));
+}
+
+template <size_t CONFIG_IDX>
+void LaunchBasicMatmulConfig(uint32_t blockNum, aclrtStream stream, KernelInfo const &kernelInfo)
+{
+    using LayoutA = layout::RowMajor;
+    using LayoutB = layout::RowMajor;
+    constexpr Tuning::TileConfig config = Tuning::BASIC_MATMUL_CONFIGS[CONFIG_IDX];
+    basic_matmul_tuned<LayoutA, LayoutB, LayoutC, InDType, OutDType, config.l1M, config.l1N, config.l1K, config.l0K,
+        config.swizzleOffset, config.swizzleDirection><<<blockNum, nullptr, stream>>>(
+        MakeProblemShape(kernelInfo), kernelInfo.inputAddr.at(0), kernelInfo.inputAddr.at(1),
+        kernelInfo.outputAddr.at(0));
+}
+
+template <size_t... CONFIG_IDX>
+constexpr std::array<KernelLauncher, sizeof...(CONFIG_IDX)> MakeConfigLaunchers(std::index_sequence<CONFIG_IDX...>)
+{
+    return {LaunchBasicMatmulConfig<CONFIG_IDX>...};
+}
+
+struct BasicMatmulLauncherTable {
+    // Indexed by transA * 2 + transB.
+    static constexpr std::array<KernelLauncher, 4> DEFAULT_LAUNCHERS = {
+        LaunchBasicMatmulDefault<false, false>, LaunchBasicMatmulDefault<false, true>,
+        LaunchBasicMatmulDefault<true, false>, LaunchBasicMatmulDefault<true, true>};
+    static constexpr std::array<KernelLauncher, 4> PRELOAD_LAUNCHERS = {
+        LaunchBasicMatmulPreload<false, false>, LaunchBasicMatmulPreload<false, true>,
+        LaunchBasicMatmulPreload<true, false>, LaunchBasicMatmulPreload<true, true>};
+    static constexpr std::array<KernelLauncher, 4> PACKED_LAUNCHERS = {
+        LaunchBasicMatmulPacked<false, false>, LaunchBasicMatmulPacked<false, true>,
+        LaunchBasicMatmulPacked<true, false>, LaunchBasicMatmulPacked<true, true>};
+    // One launcher per entry of Tuning::BASIC_MATMUL_CONFIGS, in the same order.
+    static constexpr auto CONFIG_LAUNCHERS =
+        MakeConfigLaunchers(std::make_index_sequence<Tuning::BASIC_MATMUL_CONFIG_NUM>{});
+
+    KernelLauncher Default(bool transA, bool transB) const
+    {
+        return DEFAULT_LAUNCHERS[transA * 2 + transB];
+    }
+
+    KernelLauncher Preload(bool transA, bool transB) const
+    {
+        return PRELOAD_LAUNCHERS[transA * 2 + transB];
+    }
+
+    KernelLauncher Packed(bool transA, bool transB) const
+    {
+        return PACKED_LAUNCHERS[transA * 2 + transB];
+    }
+
+    KernelLauncher Config(size_t idx) const
+    {
+        return CONFIG_LAUNCHERS[idx];
+    }
+};
+
+// The shape JIT specializes the default kernels, the body is the one basic_matmul runs.
+JitLauncher FindBasicMatmulJitLauncher(KernelInfo const &kernelInfo)
+{
+    static const std::array<Jit::JitKernelSpec, 4> SPECS = []() {
+        std::array<Jit::JitKernelSpec, 4> specs;
+        for (uint32_t i = 0; i < specs.size(); ++i) {
+            std::string layoutA = (i / 2 == 0) ? "Catlass::layout::RowMajor" : "Catlass::layout::ColumnMajor";
+            std::string layoutB = (i % 2 == 0) ? "Catlass::layout::RowMajor" : "Catlass::layout::ColumnMajor";
+            specs[i] = MakeJitKernelSpec(Tuning::BASIC_MATMUL_OP_NAME, "kernel/basic_matmul.hpp",
+                "Catlass::BasicMatmulBody<" + layoutA + ", " + layoutB + ", Catlass::layout::RowMajor, half, half>");
+        }
+        return specs;
+    }();
+    return FindJitLauncher(SPECS[kernelInfo.transA * 2 + kernelInfo.transB],
+        Jit::JitShape{kernelInfo.m, kernelInfo.n, kernelInfo.k});
+}
+
+bool IsTunableBasicMatmul(KernelInfo const &kernelInfo)
+{
+    return kernelInfo.inputDataType == ACL_FLOAT16 && kernelInfo.outputDataType == ACL_FLOAT16 &&
+        !kernelInfo.transA && !kernelInfo.transB && !kernelInfo.packedB;
+}
+} // namespace
+
+void RegisterBasicMatmulKernels(KernelRegistry &registry)
+{
+    Registry::RegisterBasicMatmulKernels(registry, ACL_FLOAT16, BasicMatmulLauncherTable{});
+}
+
+namespace {
+// The kernels are registered when the group is loaded, i.e. on the first basic_matmul dispatch.
+const bool BASIC_MATMUL_KERNELS_REGISTERED = (RegisterBasicMatmulKernels(GetKernelRegistry()), true);
+} // namespace
+
+namespace Impl {
 void BasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo)
 {
-    if (kernelInfo.inputDataType == ACL_FLOAT16 && kernelInfo.outputDataType == ACL_FLOAT16 && !kernelInfo.transA &&
-        !kernelInfo.transB) {
-        using LayoutA = layout::RowMajor;
-        using LayoutB = layout::RowMajor;
-        using LayoutC = layout::RowMajor;
-        using InDType = half;
-        using OutDType = half;
-        GemmCoord problemShape{kernelInfo.m, kernelInfo.n, kernelInfo.k};
-        basic_matmul<LayoutA, LayoutB, LayoutC, InDType, OutDType><<<blockNum, nullptr, stream>>>(
-            problemShape, kernelInfo.inputAddr.at(0), kernelInfo.inputAddr.at(1), kernelInfo.outputAddr.at(0));
+    if (kernelInfo.outputDataType != ACL_FLOAT16) {
+        return;
+    }
+    // A packed B is already in its L1 format, so one kernel serves every shape class and no tuning applies.
+    if (kernelInfo.packedB) {
+        if (kernelInfo.inputDataType == ACL_FLOAT16) {
+            BasicMatmulLauncherTable{}.Packed(kernelInfo.transA, kernelInfo.transB)(blockNum, stream, kernelInfo);
+        }
+        return;
+    }
+    KernelRegistry::Entry const *entry = SelectKernel(Tuning::BASIC_MATMUL_OP_NAME, kernelInfo);
+    if (entry == nullptr) {
+        return;
+    }
+    if (entry->launcher == BasicMatmulLauncherTable{}.Default(kernelInfo.transA, kernelInfo.transB)) {
+        JitLauncher jitLauncher = FindBasicMatmulJitLauncher(kernelInfo);
+        if (jitLauncher != nullptr) {
+            jitLauncher(blockNum, stream, kernelInfo.inputAddr.at(0), kernelInfo.inputAddr.at(1),
+                kernelInfo.outputAddr.at(0));
+            return;
+        }
     }
+    entry->launcher(blockNum, stream, kernelInfo);
 }
-} // namespace CatlassKernel
\ No newline at end of file
+
+bool TuneBasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo, uint32_t repeat)
+{
+    if (!IsTunableBasicMatmul(kernelInfo) || repeat == 0) {
+        return false;
+    }
+
+    // The candidates write into a scratch C, the caller's output is left untouched.
+    size_t sizeC = static_cast<size_t>(kernelInfo.m) * kernelInfo.n * sizeof(OutDType);
+    uint8_t *scratchC = AllocateStreamMemory(sizeC, stream);
+    if (scratchC == nullptr) {
+        std::cerr << "TuneBasicMatmul: failed to allocate the scratch output for m=" << kernelInfo.m <<
+            ", n=" << kernelInfo.n << std::endl;
+        return false;
+    }
+    kernelInfo.outputAddr = {scratchC};
+
+    aclrtEvent start{nullptr};
+    aclrtEvent end{nullptr};
+    if (aclrtCreateEvent(&start) != ACL_SUCCESS) {
+        FreeStreamMemory(scratchC);
+        return false;
+    }
+    if (aclrtCreateEvent(&end) != ACL_SUCCESS) {
+        aclrtDestroyEvent(start);
+        FreeStreamMemory(scratchC);
+        return false;
+    }
+
+    auto measure = [&](Tuning::TileConfig const &config) -> double {
+        KernelLauncher launcher = nullptr;
+        for (size_t i = 0; i < Tuning::BASIC_MATMUL_CONFIG_NUM; ++i) {
+            if (Tuning::BASIC_MATMUL_CONFIGS[i] == config) {
+                launcher = BasicMatmulLauncherTable{}.Config(i);
+            }
+        }
+        if (launcher == nullptr) {
+            return -1.0;
+        }
+        // warm up, so that the first launch overhead is not measured
+        launcher(blockNum, stream, kernelInfo);
+        aclrtRecordEvent(start, stream);
+        for (uint32_t i = 0; i < repeat; ++i) {
+            launcher(blockNum, stream, kernelInfo);
+        }
+        aclrtRecordEvent(end, stream);
+        float elapsedMs = 0.0f;
+        if (aclrtSynchronizeEvent(end) != ACL_SUCCESS || aclrtEventElapsedTime(&elapsedMs, start, end) != ACL_SUCCESS) {
+            return -1.0;
+        }
+        return static_cast<double>(elapsedMs) * 1000.0 / repeat;
+    };
+
+    std::vector<Tuning::TileConfig> candidates(
+        Tuning::BASIC_MATMUL_CONFIGS, Tuning::BASIC_MATMUL_CONFIGS + Tuning::BASIC_MATMUL_CONFIG_NUM);
+    auto key = Tuning::MakeTuningKey(Tuning::BASIC_MATMUL_OP_NAME, kernelInfo.inputDataType,
+        kernelInfo.transA, kernelInfo.transB, kernelInfo.m, kernelInfo.n, kernelInfo.k);
+    auto best = Tuning::TuneAndRecord(Tuning::GetTuningDatabase(), key, candidates, measure);
+
+    aclrtDestroyEvent(start);
+    aclrtDestroyEvent(end);
+    FreeStreamMemory(scratchC);
+    return best.has_value();
+}
+} // namespace Impl
+} // namespace CatlassKernel
+
+CATLASS_KERNEL_GROUP(basic_matmul, CATLASS_KERNEL_ENTRY(BasicMatmul), CATLASS_KERNEL_ENTRY(TuneBasicMatmul))
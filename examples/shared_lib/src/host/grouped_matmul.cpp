@@ -1,11 +1,15 @@
+#include <iostream>
+
 #include <acl/acl.h>
 
 #include "catlass_kernel.h"
+#include "kernel_group.hpp"
 #include "kernel/grouped_matmul_slice_k.hpp"
 #include "kernel/grouped_matmul_slice_m.hpp"
 
 namespace CatlassKernel {
 using namespace Catlass;
+namespace Impl {
 void GroupedMatmul(uint32_t blockNum, aclrtStream stream,
                    KernelInfo kernelInfo) {
   const uint32_t problemCount = kernelInfo.groupList.size();
@@ -24,15 +28,34 @@ void GroupedMatmul(uint32_t blockNum, aclrtStream stream,
   LayoutB layoutB{k, n};
   LayoutC layoutC{m, n};
 
-  // layout and shape malloc and copy
-  uint8_t *groupListDevice{nullptr};
+  // The group list goes through the pinned staging ring, its upload is
+  // ordered on the stream of the launch and the host does not wait for it.
   typename std::decay<decltype(groupList)>::type::value_type elemGroupList = 0;
   size_t sizeGroupListDevice =
       groupList.size() * sizeof(decltype(elemGroupList));
-  aclrtMalloc(reinterpret_cast<void **>(&groupListDevice), sizeGroupListDevice,
-              ACL_MEM_MALLOC_HUGE_FIRST);
-  aclrtMemcpy(groupListDevice, sizeGroupListDevice, groupList.data(),
-              sizeGroupListDevice, ACL_MEMCPY_HOST_TO_DEVICE);
+  uint8_t *groupListDevice =
+      StageMetadata(groupList.data(), sizeGroupListDevice, stream);
+  bool staged = groupListDevice != nullptr;
+  if (!staged) {
+    groupListDevice = AllocateStreamMemory(sizeGroupListDevice, stream);
+    if (groupListDevice == nullptr) {
+      return;
+    }
+    // The pool block may still be read by earlier work on the stream, and a
+    // synchronous copy is not ordered with it, so wait for the stream first.
+    // This path is only taken when the list does not fit the staging ring.
+    aclError ret = aclrtSynchronizeStream(stream);
+    if (ret == ACL_SUCCESS) {
+      ret = aclrtMemcpy(groupListDevice, sizeGroupListDevice, groupList.data(),
+                        sizeGroupListDevice, ACL_MEMCPY_HOST_TO_DEVICE);
+    }
+    if (ret != ACL_SUCCESS) {
+      std::cerr << "GroupedMatmul: failed to upload the group list, aclError:"
+                << ret << ", nothing is launched." << std::endl;
+      FreeStreamMemory(groupListDevice);
+      return;
+    }
+  }
 
   // execution
   if (kernelInfo.split == KernelInfo::GMMSplit::SPLIT_M) {
@@ -48,6 +71,16 @@ void GroupedMatmul(uint32_t blockNum, aclrtStream stream,
             kernelInfo.inputAddr.at(0), layoutA, kernelInfo.inputAddr.at(1),
             layoutB, kernelInfo.outputAddr.at(0), layoutC);
   }
-  aclrtFree(groupListDevice);
+  // The kernel may still read the group list: the ring slot is reused once
+  // the fence recorded behind the launch completes, the pool block only by
+  // later work on the same stream.
+  if (staged) {
+    CommitMetadata(stream);
+  } else {
+    FreeStreamMemory(groupListDevice);
+  }
 }
-}  // namespace CatlassKernel
\ No newline at end of file
+}  // namespace Impl
+}  // namespace CatlassKernel
+
+CATLASS_KERNEL_GROUP(grouped_matmul, CATLASS_KERNEL_ENTRY(GroupedMatmul))
\ No newline at end of file
@@ -0,0 +1,141 @@
+#include <cstdlib>
+#include <map>
+#include <string>
+
+#include <dlfcn.h>
+
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "kernel_group.hpp"
+
+#ifdef CATLASS_KERNEL_STATIC_GROUPS
+extern "C" {
+CatlassKernel::Loader::KernelEntry const *CatlassKernelGroup_basic_matmul(size_t *entryNum);
+CatlassKernel::Loader::KernelEntry const *CatlassKernelGroup_grouped_matmul(size_t *entryNum);
+CatlassKernel::Loader::KernelEntry const *CatlassKernelGroup_optimized_matmul(size_t *entryNum);
+}
+#endif
+
+namespace CatlassKernel {
+
+namespace {
+#ifdef CATLASS_KERNEL_STATIC_GROUPS
+// libcatlass_kernel.a links every group in, so "loading" a group only resolves its entries.
+Loader::KernelGroupLoader *MakeKernelGroupLoader()
+{
+    static const std::map<std::string, void *> SYMBOLS = {
+        {Loader::KernelGroupSymbol("basic_matmul"), reinterpret_cast<void *>(&CatlassKernelGroup_basic_matmul)},
+        {Loader::KernelGroupSymbol("grouped_matmul"), reinterpret_cast<void *>(&CatlassKernelGroup_grouped_matmul)},
+        {Loader::KernelGroupSymbol("optimized_matmul"),
+            reinterpret_cast<void *>(&CatlassKernelGroup_optimized_matmul)},
+    };
+    return new Loader::KernelGroupLoader(
+        [](std::string const &) -> void * { return const_cast<std::map<std::string, void *> *>(&SYMBOLS); },
+        [](void *, std::string const &symbol) -> void * {
+            auto it = SYMBOLS.find(symbol);
+            return (it == SYMBOLS.end()) ? nullptr : it->second;
+        });
+}
+
+std::string KernelGroupLibrary(const char *group)
+{
+    return group;
+}
+#else
+// Group libraries are looked up in CATLASS_KERNEL_LIB_DIR if set, otherwise next to libcatlass_kernel.so.
+std::string KernelGroupLibraryDir()
+{
+    const char *dir = std::getenv("CATLASS_KERNEL_LIB_DIR");
+    if (dir != nullptr) {
+        return dir;
+    }
+    Dl_info info;
+    if (dladdr(reinterpret_cast<void *>(&GetKernelGroupLoader), &info) != 0 && info.dli_fname != nullptr) {
+        std::string path = info.dli_fname;
+        size_t pos = path.rfind('/');
+        if (pos != std::string::npos) {
+            return path.substr(0, pos);
+        }
+    }
+    return ".";
+}
+
+std::string KernelGroupLibrary(const char *group)
+{
+    return KernelGroupLibraryDir() + "/libcatlass_kernel_" + group + ".so";
+}
+
+// The handles are never closed: the kernels stay registered with the runtime until the process exits.
+Loader::KernelGroupLoader *MakeKernelGroupLoader()
+{
+    return new Loader::KernelGroupLoader(
+        [](std::string const &library) { return dlopen(library.c_str(), RTLD_NOW | RTLD_LOCAL); },
+        [](void *handle, std::string const &symbol) { return dlsym(handle, symbol.c_str()); });
+}
+#endif
+} // namespace
+
+Loader::KernelGroupLoader &GetKernelGroupLoader()
+{
+    // Leaked on purpose, entries may still be called while other statics are destroyed.
+    static Loader::KernelGroupLoader *loader = []() {
+        Loader::KernelGroupLoader *groupLoader = MakeKernelGroupLoader();
+        for (auto const &group : KernelGroups()) {
+            groupLoader->AddGroup(group.name, KernelGroupLibrary(group.name), group.kernelIds);
+        }
+        return groupLoader;
+    }();
+    return *loader;
+}
+
+size_t PreloadKernelGroups(std::vector<std::string> const &groups)
+{
+    return GetKernelGroupLoader().Preload(groups);
+}
+
+std::vector<std::string> LoadedKernelGroups()
+{
+    return GetKernelGroupLoader().LoadedGroups();
+}
+
+void BasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo)
+{
+    auto func = FindKernelEntry<decltype(&Impl::BasicMatmul)>("BasicMatmul");
+    if (func != nullptr) {
+        func(blockNum, stream, std::move(kernelInfo));
+    }
+}
+
+bool TuneBasicMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo, uint32_t repeat)
+{
+    auto func = FindKernelEntry<decltype(&Impl::TuneBasicMatmul)>("TuneBasicMatmul");
+    return (func != nullptr) && func(blockNum, stream, std::move(kernelInfo), repeat);
+}
+
+void GroupedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo)
+{
+    auto func = FindKernelEntry<decltype(&Impl::GroupedMatmul)>("GroupedMatmul");
+    if (func != nullptr) {
+        func(blockNum, stream, std::move(kernelInfo));
+    }
+}
+
+void OptimizedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo)
+{
+    auto func = FindKernelEntry<decltype(&Impl::OptimizedMatmul)>("OptimizedMatmul");
+    if (func != nullptr) {
+        func(blockNum, stream, std::move(kernelInfo));
+    }
+}
+
+void ClearOptimizedMatmulPlans()
+{
+    // Nothing is cached before the group is loaded, so clearing must not load it.
+    auto func = reinterpret_cast<decltype(&Impl::ClearOptimizedMatmulPlans)>(
+        GetKernelGroupLoader().FindLoaded("ClearOptimizedMatmulPlans"));
+    if (func != nullptr) {
+        func();
+    }
+}
+} // namespace CatlassKernel
@@ -0,0 +1,79 @@
+#include <string>
+
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "kernel_dispatch.hpp"
+#include "kernel_group.hpp"
+#include "tuning/tuning_db.hpp"
+
+namespace CatlassKernel {
+
+KernelRegistry &GetKernelRegistry()
+{
+    // Each kernel group registers its kernels when it is loaded.
+    static KernelRegistry registry;
+    return registry;
+}
+
+namespace {
+// Make sure the kernels of the op are registered, the group of an op carries the name of the op.
+void LoadOpKernels(const char *op)
+{
+    GetKernelGroupLoader().Load(op);
+}
+} // namespace
+
+KernelRegistry::Entry const *SelectKernel(const char *op, KernelInfo const &kernelInfo)
+{
+    Registry::KernelQuery query = MakeKernelQuery(op, kernelInfo);
+    auto record = Tuning::GetTuningDatabase().Find(
+        Tuning::MakeTuningKey(op, query.dtype, query.transA, query.transB, query.m, query.n, query.k));
+    std::string preferred = record.has_value() ? Tuning::TileConfigKernelName(op, record->config) : "";
+    return GetKernelRegistry().Select(query, preferred);
+}
+
+std::string QueryKernel(const char *op, KernelInfo const &kernelInfo)
+{
+    LoadOpKernels(op);
+    KernelRegistry::Entry const *entry = SelectKernel(op, kernelInfo);
+    return (entry == nullptr) ? std::string() : entry->spec.name;
+}
+
+std::vector<std::string> ListKernels(const char *op)
+{
+    LoadOpKernels(op);
+    std::vector<std::string> names;
+    for (auto const &spec : GetKernelRegistry().List(op)) {
+        names.push_back(spec.name);
+    }
+    return names;
+}
+
+bool OverrideKernel(const char *name)
+{
+    // Kernel names start with their op, e.g. "basic_matmul_preload_nn".
+    std::string kernelName = name;
+    for (auto const &group : KernelGroups()) {
+        if (kernelName.rfind(group.name, 0) == 0) {
+            LoadOpKernels(group.name);
+        }
+    }
+    return GetKernelRegistry().SetOverride(name);
+}
+
+void ClearKernelOverride(const char *op)
+{
+    GetKernelRegistry().ClearOverride(op);
+}
+
+bool LoadTuningDatabase(const char *path)
+{
+    return Tuning::GetTuningDatabase().Load(path);
+}
+
+bool SaveTuningDatabase(const char *path)
+{
+    return Tuning::GetTuningDatabase().Save(path);
+}
+} // namespace CatlassKernel
@@ -0,0 +1,45 @@
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "memory/stream_memory_pool.hpp"
+
+namespace CatlassKernel {
+
+namespace {
+Memory::StreamMemoryPool &GetStreamMemoryPool()
+{
+    // Never destroyed: giving the blocks back at exit could run after the runtime is finalized.
+    static auto *pool = new Memory::StreamMemoryPool(
+        [](size_t size) -> void * {
+            void *ptr{nullptr};
+            if (aclrtMalloc(&ptr, size, ACL_MEM_MALLOC_HUGE_FIRST) != ACL_SUCCESS) {
+                return nullptr;
+            }
+            return ptr;
+        },
+        [](void *ptr) { aclrtFree(ptr); },
+        [](uint64_t stream) { aclrtSynchronizeStream(reinterpret_cast<aclrtStream>(stream)); });
+    return *pool;
+}
+} // namespace
+
+uint8_t *AllocateStreamMemory(size_t size, aclrtStream stream)
+{
+    return static_cast<uint8_t *>(GetStreamMemoryPool().Allocate(size, reinterpret_cast<uint64_t>(stream)));
+}
+
+void FreeStreamMemory(uint8_t *ptr)
+{
+    GetStreamMemoryPool().Free(ptr);
+}
+
+void ReleaseStreamMemory()
+{
+    GetStreamMemoryPool().Release();
+}
+
+void ReleaseStreamMemory(aclrtStream stream)
+{
+    GetStreamMemoryPool().ReleaseStream(reinterpret_cast<uint64_t>(stream));
+}
+} // namespace CatlassKernel
@@ -1,95 +1,97 @@
 #include "kernel/optimized_matmul.hpp"
 
+#include <array>
+#include <iostream>
+
 #include <acl/acl.h>
 #include <runtime/rt_ffts.h>
 
 #include "catlass_kernel.h"
+#include "kernel_group.hpp"
+#include "plan/optimized_matmul_plan.hpp"
 
 namespace CatlassKernel {
 using namespace Catlass;
-void OptimizedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo)
-{
-    uint32_t m = kernelInfo.m;
-    uint32_t n = kernelInfo.n;
-    uint32_t k = kernelInfo.k;
 
-    GemmCoord problemShape{kernelInfo.m, kernelInfo.n, kernelInfo.k};
+namespace {
+using LayoutA = layout::RowMajor;
+using LayoutB = layout::RowMajor;
+using LayoutC = layout::RowMajor;
+using ElementA = bfloat16_t;
+using ElementB = bfloat16_t;
+using ElementC = bfloat16_t;
+using AType = Gemm::GemmType<ElementA, LayoutA>;
+using BType = Gemm::GemmType<ElementB, LayoutB>;
+using CType = Gemm::GemmType<ElementC, LayoutC>;
 
-    using LayoutA = layout::RowMajor;
-    using LayoutB = layout::RowMajor;
-    using LayoutC = layout::RowMajor;
-    using ElementA = bfloat16_t;
-    using ElementB = bfloat16_t;
-    using ElementC = bfloat16_t;
-    using AType = Gemm::GemmType<ElementA, LayoutA>;
-    using BType = Gemm::GemmType<ElementB, LayoutB>;
-    using CType = Gemm::GemmType<ElementC, LayoutC>;
-    LayoutA layoutA{m, k};
-    LayoutB layoutB{k, n};
-    LayoutC layoutC{m, n};
-    constexpr uint32_t alignByByte = 512;
-    constexpr uint32_t alignByElement = alignByByte / sizeof(ElementA);
+using OptimizedMatmulLauncher = void (*)(uint32_t, aclrtStream, uint64_t, GemmCoord, uint8_t *, uint8_t *, uint8_t *,
+    uint8_t *, uint8_t *);
 
-    bool isNeedPaddingA = IsNeedPadding(layoutA, alignByElement);
-    bool isNeedPaddingB = IsNeedPadding(layoutB, alignByElement);
+template <bool PADDING_A, bool PADDING_B>
+void LaunchOptimizedMatmul(uint32_t blockNum, aclrtStream stream, uint64_t fftsAddr, GemmCoord problemShape,
+    uint8_t *deviceA, uint8_t *deviceB, uint8_t *deviceC, uint8_t *deviceWA, uint8_t *deviceWB)
+{
+    optimized_matmul<AType, BType, CType, PADDING_A, PADDING_B>
+        <<<blockNum, nullptr, stream>>>(fftsAddr, problemShape, deviceA, deviceB, deviceC, deviceWA, deviceWB);
+}
 
-    // if LayoutA and LayoutB is both ColumnMajor,
-    // L1TileShape using GemmShape<256, 128, 256> can achieve better performance.
-    using L1TileShape =
-        std::conditional_t<std::is_same_v<LayoutA, layout::ColumnMajor> && std::is_same_v<LayoutB, layout::ColumnMajor>,
-                           GemmShape<256, 128, 256>, GemmShape<128, 256, 256>>;
+// Indexed by Plan::OptimizedMatmulPlan::KernelIdx().
+constexpr std::array<OptimizedMatmulLauncher, 4> OPTIMIZED_MATMUL_LAUNCHERS = {
+    LaunchOptimizedMatmul<false, false>, LaunchOptimizedMatmul<false, true>,
+    LaunchOptimizedMatmul<true, false>, LaunchOptimizedMatmul<true, true>};
 
+Plan::OptimizedMatmulPlanCache &GetOptimizedMatmulPlanCache()
+{
+    // Never destroyed: releasing workspaces at exit could run after the runtime is finalized.
+    static auto *cache = new Plan::OptimizedMatmulPlanCache(
+        Plan::OPTIMIZED_MATMUL_PLAN_CACHE_CAPACITY,
+        [](Plan::OptimizedMatmulPlanKey const &key, size_t size) {
+            return AllocateStreamMemory(size, reinterpret_cast<aclrtStream>(key.stream));
+        },
+        [](Plan::OptimizedMatmulPlanKey const &, Plan::OptimizedMatmulPlan const &plan) {
+            // Launches of the plan may still be in flight, the pool only reuses the block on the same stream.
+            FreeStreamMemory(plan.workspace);
+        });
+    return *cache;
+}
+} // namespace
+
+namespace Impl {
+void OptimizedMatmul(uint32_t blockNum, aclrtStream stream, KernelInfo kernelInfo)
+{
+    GemmCoord problemShape{kernelInfo.m, kernelInfo.n, kernelInfo.k};
     uint8_t *deviceA = kernelInfo.inputAddr.at(0);
     uint8_t *deviceB = kernelInfo.inputAddr.at(1);
     uint8_t *deviceC = kernelInfo.outputAddr.at(0);
 
-    size_t sizeWA = GetWorkspaceLen(layoutA, L1TileShape::M, L1TileShape::K) * sizeof(ElementA);
-    size_t sizeWB = GetWorkspaceLen(layoutB, L1TileShape::K, L1TileShape::N) * sizeof(ElementB);
-
-    uint8_t *deviceWA{nullptr};
-    if (isNeedPaddingA) {
-        aclrtMalloc(reinterpret_cast<void **>(&deviceWA), sizeWA, ACL_MEM_MALLOC_HUGE_FIRST);
-    } else {
-        // no need to padding A
-        deviceWA = deviceA;
-    }
-
-    uint8_t *deviceWB{nullptr};
-    // If layoutWB has the same stride with layoutB, no need to padding B
-    if (isNeedPaddingB) {
-        aclrtMalloc(reinterpret_cast<void **>(&deviceWB), sizeWB, ACL_MEM_MALLOC_HUGE_FIRST);
-    } else {
-        // no need to padding B
-        deviceWB = deviceB;
-    }
-
     // Prepare FFTS address
     uint64_t fftsAddr{0};
     uint32_t fftsLen{0};
     rtGetC2cCtrlAddr(&fftsAddr, &fftsLen);
-    if (isNeedPaddingA && isNeedPaddingB) {
-        optimized_matmul<AType, BType, CType, true, true>
-            <<<blockNum, nullptr, stream>>>(fftsAddr, problemShape, deviceA, deviceB, deviceC, deviceWA, deviceWB);
-    }
-    if (!isNeedPaddingA && isNeedPaddingB) {
-        optimized_matmul<AType, BType, CType, false, true>
-            <<<blockNum, nullptr, stream>>>(fftsAddr, problemShape, deviceA, deviceB, deviceC, deviceWA, deviceWB);
-    }
-    if (isNeedPaddingA && !isNeedPaddingB) {
-        optimized_matmul<AType, BType, CType, true, false>
-            <<<blockNum, nullptr, stream>>>(fftsAddr, problemShape, deviceA, deviceB, deviceC, deviceWA, deviceWB);
-    }
-    if (!isNeedPaddingA && !isNeedPaddingB) {
-        optimized_matmul<AType, BType, CType, false, false>
-            <<<blockNum, nullptr, stream>>>(fftsAddr, problemShape, deviceA, deviceB, deviceC, deviceWA, deviceWB);
-    }
 
-    aclrtSynchronizeStream(stream);
-    if (isNeedPaddingA) {
-        aclrtFree(deviceWA);
-    }
-    if (isNeedPaddingB) {
-        aclrtFree(deviceWB);
+    // The library instantiates row major A and B only, so the plan is made for that layout.
+    Plan::OptimizedMatmulPlanKey key{kernelInfo.m, kernelInfo.n, kernelInfo.k,
+        static_cast<uint32_t>(ACL_BF16), false, false, reinterpret_cast<uint64_t>(stream)};
+    auto launch = [&](Plan::OptimizedMatmulPlan const &plan) {
+        // Without padding the kernel reads A and B in place.
+        uint8_t *deviceWA = plan.paddingA ? plan.workspace : deviceA;
+        uint8_t *deviceWB = plan.paddingB ? plan.workspace + plan.OffsetWB() : deviceB;
+        OPTIMIZED_MATMUL_LAUNCHERS[plan.KernelIdx()](
+            blockNum, stream, fftsAddr, problemShape, deviceA, deviceB, deviceC, deviceWA, deviceWB);
+    };
+    if (!GetOptimizedMatmulPlanCache().Execute(key, sizeof(ElementA), launch)) {
+        // Only the allocation of the padding workspace can fail, C is left unwritten.
+        std::cerr << "OptimizedMatmul: failed to allocate the padding workspace for m=" << kernelInfo.m <<
+            " n=" << kernelInfo.n << " k=" << kernelInfo.k << ", nothing is launched." << std::endl;
     }
 }
-} // namespace CatlassKernel
\ No newline at end of file
+
+void ClearOptimizedMatmulPlans()
+{
+    GetOptimizedMatmulPlanCache().Clear();
+}
+} // namespace Impl
+} // namespace CatlassKernel
+
+CATLASS_KERNEL_GROUP(optimized_matmul, CATLASS_KERNEL_ENTRY(OptimizedMatmul),
+    CATLASS_KERNEL_ENTRY(ClearOptimizedMatmulPlans))
@@ -0,0 +1,158 @@
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <mutex>
+#include <sstream>
+#include <string>
+
+#include <dlfcn.h>
+
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "shape_jit.hpp"
+#include "jit/shape_jit_cache.hpp"
+
+#define CATLASS_JIT_STRINGIFY_IMPL(x) #x
+#define CATLASS_JIT_STRINGIFY(x) CATLASS_JIT_STRINGIFY_IMPL(x)
+
+namespace CatlassKernel {
+
+namespace {
+constexpr uint32_t DEFAULT_HOT_THRESHOLD = 16;
+
+std::string GetEnv(const char *name, std::string const &fallback = "")
+{
+    const char *value = std::getenv(name);
+    return (value == nullptr) ? fallback : std::string(value);
+}
+
+// Sources of the library and of catlass, as seen when the library was built. Override with CATLASS_JIT_SOURCE_DIR
+// and CATLASS_JIT_INCLUDE_DIR if the library is used on another machine.
+std::string JitSourceDir()
+{
+#ifdef CATLASS_JIT_SOURCE_DIR
+    return GetEnv("CATLASS_JIT_SOURCE_DIR", CATLASS_JIT_STRINGIFY(CATLASS_JIT_SOURCE_DIR));
+#else
+    return GetEnv("CATLASS_JIT_SOURCE_DIR", ".");
+#endif
+}
+
+std::string JitIncludeDir()
+{
+#ifdef CATLASS_JIT_INCLUDE_DIR
+    return GetEnv("CATLASS_JIT_INCLUDE_DIR", CATLASS_JIT_STRINGIFY(CATLASS_JIT_INCLUDE_DIR));
+#else
+    return GetEnv("CATLASS_JIT_INCLUDE_DIR", ".");
+#endif
+}
+
+// Same options as the library itself, see BISHENG_COMPILER_OPTIONS in CMakeLists.txt.
+bool CompileWithBisheng(std::string const &sourcePath, std::string const &binaryPath)
+{
+    std::string ascend = GetEnv("ASCEND_HOME_PATH");
+    if (ascend.empty()) {
+        return false;
+    }
+    std::string source = JitSourceDir();
+    std::ostringstream command;
+    command << GetEnv("CATLASS_JIT_CXX", "bisheng") << " --cce-aicore-arch=dav-c220 -O2 -std=c++17 -xcce -fPIC"
+        << " -mllvm -cce-aicore-stack-size=0x8000 -mllvm -cce-aicore-function-stack-size=0x8000"
+        << " -mllvm -cce-aicore-record-overflow=true -mllvm -cce-aicore-addr-transform"
+        << " -mllvm -cce-aicore-dcci-insert-for-scalar=false -DL2_CACHE_HINT -DTILING_KEY_VAR"
+        << " -I" << ascend << "/compiler/tikcpp -I" << ascend << "/compiler/tikcpp/tikcfw"
+        << " -I" << ascend << "/compiler/tikcpp/tikcfw/impl -I" << ascend << "/compiler/tikcpp/tikcfw/interface"
+        << " -I" << ascend << "/include -I" << ascend << "/include/experiment/runtime"
+        << " -I" << ascend << "/include/experiment/msprof"
+        << " -I" << source << " -I" << source << "/common -I" << source << "/../include -I" << JitIncludeDir()
+        << " -Wno-macro-redefined -Wno-ignored-attributes " << GetEnv("CATLASS_JIT_FLAGS")
+        << " " << sourcePath << " --cce-fatobj-link --shared -o " << binaryPath
+        << " -L" << ascend << "/lib64 -lruntime -lascendcl"
+        << " > " << binaryPath << ".log 2>&1";
+    return std::system(command.str().c_str()) == 0;
+}
+
+// The handles are never closed, launchers stay valid until the process exits.
+void *LoadJitBinary(std::string const &binaryPath)
+{
+    void *handle = dlopen(binaryPath.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if (handle == nullptr) {
+        return nullptr;
+    }
+    return dlsym(handle, Jit::JIT_LAUNCH_SYMBOL);
+}
+
+std::mutex jitMutex;
+std::atomic<Jit::ShapeJitCache *> jitCache{nullptr};
+std::atomic<bool> jitEnabled{false};
+
+// Leaked on purpose, the background compile may still run while other statics are destroyed.
+bool CreateJitCache(std::string const &cacheDir, uint32_t hotThreshold)
+{
+    std::lock_guard<std::mutex> lock(jitMutex);
+    Jit::ShapeJitCache *cache = jitCache.load();
+    if (cache == nullptr) {
+        cache = new Jit::ShapeJitCache(cacheDir, CompileWithBisheng, LoadJitBinary, hotThreshold);
+        jitCache.store(cache);
+    } else if (cache->CacheDir() != cacheDir) {
+        return false;
+    }
+    jitEnabled.store(true);
+    return true;
+}
+
+Jit::ShapeJitCache *GetJitCache()
+{
+    static std::once_flag envFlag;
+    std::call_once(envFlag, []() {
+        std::string cacheDir = GetEnv("CATLASS_JIT_CACHE_DIR");
+        if (!cacheDir.empty()) {
+            uint32_t hotThreshold = static_cast<uint32_t>(
+                std::strtoul(GetEnv("CATLASS_JIT_HOT_THRESHOLD", std::to_string(DEFAULT_HOT_THRESHOLD)).c_str(),
+                    nullptr, 10));
+            CreateJitCache(cacheDir, hotThreshold);
+        }
+    });
+    return jitEnabled.load() ? jitCache.load() : nullptr;
+}
+} // namespace
+
+Jit::JitKernelSpec MakeJitKernelSpec(std::string const &op, std::string const &header, std::string const &body)
+{
+    // Binaries built from another version of the header, or by another build of the library, must not be reused.
+    std::ifstream file(JitSourceDir() + "/" + header);
+    std::stringstream content;
+    content << file.rdbuf();
+    std::string fingerprint = std::string(__DATE__ " " __TIME__ " ") +
+        std::to_string(Jit::HashString(content.str()));
+    return Jit::JitKernelSpec{op, header, body, fingerprint};
+}
+
+JitLauncher FindJitLauncher(Jit::JitKernelSpec const &spec, Jit::JitShape const &shape)
+{
+    Jit::ShapeJitCache *cache = GetJitCache();
+    if (cache == nullptr) {
+        return nullptr;
+    }
+    return reinterpret_cast<JitLauncher>(cache->Lookup(spec, shape));
+}
+
+bool EnableShapeJit(const char *cacheDir, uint32_t hotThreshold)
+{
+    GetJitCache();
+    return CreateJitCache(cacheDir, hotThreshold);
+}
+
+void DisableShapeJit()
+{
+    jitEnabled.store(false);
+}
+
+void WaitShapeJit()
+{
+    Jit::ShapeJitCache *cache = jitCache.load();
+    if (cache != nullptr) {
+        cache->WaitIdle();
+    }
+}
+} // namespace CatlassKernel
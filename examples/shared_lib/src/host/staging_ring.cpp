@@ -0,0 +1,89 @@
+#include <cstdlib>
+#include <string>
+
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "memory/host_staging_ring.hpp"
+
+namespace CatlassKernel {
+
+namespace {
+constexpr size_t DEFAULT_STAGING_RING_SIZE = 1024 * 1024;
+
+size_t StagingRingSize()
+{
+    const char *size = std::getenv("CATLASS_STAGING_RING_SIZE");
+    if (size == nullptr) {
+        return DEFAULT_STAGING_RING_SIZE;
+    }
+    return static_cast<size_t>(std::strtoull(size, nullptr, 10));
+}
+
+Memory::HostStagingRing *CreateStagingRing()
+{
+    size_t capacity = StagingRingSize();
+    if (capacity == 0) {
+        return nullptr;
+    }
+    void *host{nullptr};
+    void *device{nullptr};
+    if (aclrtMallocHost(&host, capacity) != ACL_SUCCESS) {
+        return nullptr;
+    }
+    if (aclrtMalloc(&device, capacity, ACL_MEM_MALLOC_HUGE_FIRST) != ACL_SUCCESS) {
+        aclrtFreeHost(host);
+        return nullptr;
+    }
+    Memory::HostStagingRing::FenceOps fenceOps{
+        [](uint64_t stream) -> void * {
+            aclrtEvent event{nullptr};
+            if (aclrtCreateEvent(&event) != ACL_SUCCESS) {
+                return nullptr;
+            }
+            if (aclrtRecordEvent(event, reinterpret_cast<aclrtStream>(stream)) != ACL_SUCCESS) {
+                aclrtDestroyEvent(event);
+                return nullptr;
+            }
+            return event;
+        },
+        [](void *fence) {
+            aclrtEventRecordedStatus status = ACL_EVENT_RECORDED_STATUS_NOT_READY;
+            return aclrtQueryEventStatus(static_cast<aclrtEvent>(fence), &status) == ACL_SUCCESS &&
+                status == ACL_EVENT_RECORDED_STATUS_COMPLETE;
+        },
+        [](void *fence) { aclrtSynchronizeEvent(static_cast<aclrtEvent>(fence)); },
+        [](void *fence) { aclrtDestroyEvent(static_cast<aclrtEvent>(fence)); }};
+    return new Memory::HostStagingRing(static_cast<uint8_t *>(host), static_cast<uint8_t *>(device), capacity,
+        [](uint8_t *dst, uint8_t const *src, size_t size, uint64_t stream) {
+            return aclrtMemcpyAsync(dst, size, src, size, ACL_MEMCPY_HOST_TO_DEVICE,
+                reinterpret_cast<aclrtStream>(stream)) == ACL_SUCCESS;
+        },
+        fenceOps);
+}
+
+Memory::HostStagingRing *GetStagingRing()
+{
+    // Never destroyed: its fences and buffers must not be released after the runtime is finalized.
+    static auto *ring = CreateStagingRing();
+    return ring;
+}
+} // namespace
+
+uint8_t *StageMetadata(void const *data, size_t size, aclrtStream stream)
+{
+    auto *ring = GetStagingRing();
+    if (ring == nullptr) {
+        return nullptr;
+    }
+    return ring->Stage(data, size, reinterpret_cast<uint64_t>(stream));
+}
+
+void CommitMetadata(aclrtStream stream)
+{
+    auto *ring = GetStagingRing();
+    if (ring != nullptr) {
+        ring->Commit(reinterpret_cast<uint64_t>(stream));
+    }
+}
+} // namespace CatlassKernel
@@ -0,0 +1,41 @@
+#include <acl/acl.h>
+
+#include "catlass_kernel.h"
+#include "pack/weight_pack.hpp"
+
+namespace CatlassKernel {
+
+namespace {
+Pack::FractalLayout MakeWeightLayout(KernelInfo const &kernelInfo)
+{
+    return Pack::MakeFractalLayout(Pack::PackedFormatOfB(kernelInfo.transB), kernelInfo.k, kernelInfo.n,
+        static_cast<uint32_t>(aclDataTypeSize(kernelInfo.inputDataType)));
+}
+} // namespace
+
+size_t GetPackedWeightSize(KernelInfo const &kernelInfo)
+{
+    return MakeWeightLayout(kernelInfo).SizeInBytes();
+}
+
+bool PackWeight(KernelInfo const &kernelInfo, void const *hostB, void *hostPacked)
+{
+    Pack::FractalLayout layout = MakeWeightLayout(kernelInfo);
+    if (layout.elementBytes == 0 || hostB == nullptr || hostPacked == nullptr) {
+        return false;
+    }
+    Pack::PackFractal(hostB, kernelInfo.transB, layout, hostPacked);
+    return true;
+}
+
+bool UnpackWeight(KernelInfo const &kernelInfo, void const *hostPacked, void *hostB)
+{
+    Pack::FractalLayout layout = MakeWeightLayout(kernelInfo);
+    if (layout.elementBytes == 0 || hostPacked == nullptr || hostB == nullptr) {
+        return false;
+    }
+    Pack::UnpackFractal(hostPacked, layout, kernelInfo.transB, hostB);
+    return true;
+}
+
+} // namespace CatlassKernel
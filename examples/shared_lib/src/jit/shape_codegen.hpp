@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_JIT_SHAPE_CODEGEN_HPP
+#define SHARED_LIB_JIT_SHAPE_CODEGEN_HPP
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <tuple>
+
+namespace CatlassKernel::Jit {
+
+struct JitShape {
+    uint32_t m{0};
+    uint32_t n{0};
+    uint32_t k{0};
+
+    auto Tie() const
+    {
+        return std::tie(m, n, k);
+    }
+
+    bool operator<(JitShape const &other) const
+    {
+        return Tie() < other.Tie();
+    }
+
+    bool operator==(JitShape const &other) const
+    {
+        return Tie() == other.Tie();
+    }
+};
+
+/// A kernel template that can be specialized for a fixed shape.
+struct JitKernelSpec {
+    /// Op name, the prefix of the binary name.
+    std::string op;
+    /// Header that defines the body, as included from the generated source.
+    std::string header;
+    /// Device function called by the generated kernel as body(GemmCoord, gmA, gmB, gmC).
+    std::string body;
+    /// Identifies the library build that generates the source. Binaries of another build are not reused.
+    std::string fingerprint;
+};
+
+/// Name of the host launcher every generated binary exports, see JitLauncher.
+constexpr const char *JIT_LAUNCH_SYMBOL = "CatlassJitLaunch";
+
+/// FNV-1a, stable across processes and builds, so it can name files of an on-disk cache.
+inline uint64_t HashString(std::string const &str, uint64_t hash = 0xcbf29ce484222325ULL)
+{
+    for (unsigned char c : str) {
+        hash ^= c;
+        hash *= 0x100000001b3ULL;
+    }
+    return hash;
+}
+
+/// Translation unit that wraps the body of the spec in a kernel with the shape as compile time constants.
+inline std::string GenerateShapeSource(JitKernelSpec const &spec, JitShape const &shape)
+{
+    std::string m = std::to_string(shape.m);
+    std::string n = std::to_string(shape.n);
+    std::string k = std::to_string(shape.k);
+    return "// Generated by the catlass shape JIT for " + spec.op + " " + m + "x" + n + "x" + k + ", do not edit.\n"
+        "// fingerprint: " + spec.fingerprint + "\n"
+        "#include \"" + spec.header + "\"\n"
+        "\n"
+        "namespace {\n"
+        "constexpr uint32_t JIT_M = " + m + ";\n"
+        "constexpr uint32_t JIT_N = " + n + ";\n"
+        "constexpr uint32_t JIT_K = " + k + ";\n"
+        "}\n"
+        "\n"
+        "CATLASS_GLOBAL void catlass_jit_kernel(GM_ADDR gmA, GM_ADDR gmB, GM_ADDR gmC)\n"
+        "{\n"
+        "    " + spec.body + "(Catlass::GemmCoord{JIT_M, JIT_N, JIT_K}, gmA, gmB, gmC);\n"
+        "}\n"
+        "\n"
+        "extern \"C\" __attribute__((visibility(\"default\")))\n"
+        "void " + JIT_LAUNCH_SYMBOL + "(uint32_t blockNum, aclrtStream stream, uint8_t *gmA, uint8_t *gmB, "
+        "uint8_t *gmC)\n"
+        "{\n"
+        "    catlass_jit_kernel<<<blockNum, nullptr, stream>>>(gmA, gmB, gmC);\n"
+        "}\n";
+}
+
+/// File name of the binary, e.g. "basic_matmul_1x4096x4096_0123456789abcdef.so". The hash covers the source, so
+/// it changes with the body and the fingerprint.
+inline std::string JitBinaryName(JitKernelSpec const &spec, JitShape const &shape, std::string const &source)
+{
+    char hash[17];
+    std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(HashString(source)));
+    return spec.op + "_" + std::to_string(shape.m) + "x" + std::to_string(shape.n) + "x" + std::to_string(shape.k) +
+        "_" + hash + ".so";
+}
+
+} // namespace CatlassKernel::Jit
+
+#endif // SHARED_LIB_JIT_SHAPE_CODEGEN_HPP
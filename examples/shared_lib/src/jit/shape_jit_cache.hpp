@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_JIT_SHAPE_JIT_CACHE_HPP
+#define SHARED_LIB_JIT_SHAPE_JIT_CACHE_HPP
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include <unistd.h>
+
+#include "jit/shape_codegen.hpp"
+
+namespace CatlassKernel::Jit {
+
+struct ShapeJitStats {
+    /// Lookups answered by a specialized binary.
+    size_t hits{0};
+    /// Lookups that fell back to the generic kernel.
+    size_t fallbacks{0};
+    /// Binaries built by the compiler.
+    size_t compiles{0};
+    /// Binaries found in the cache directory, no compile needed.
+    size_t diskHits{0};
+    /// Specializations that failed to compile or load, they keep using the generic kernel.
+    size_t failures{0};
+};
+
+/// Shape specializations of kernel templates, built in the background and cached on disk.
+/// A shape is specialized once it has been looked up hotThreshold times. Until its binary is ready, Lookup returns
+/// nullptr and the caller runs the generic kernel, so a call never waits for the compiler.
+/// Binaries are stored in the cache directory under JitBinaryName, i.e. keyed by shape and source hash, and are
+/// reused by later processes. The compiler and the loader are passed in, so the cache itself is pure host code.
+class ShapeJitCache {
+public:
+    /// Build the binary from the source file, returns false on failure.
+    using CompileFunc = std::function<bool(std::string const &sourcePath, std::string const &binaryPath)>;
+    /// Load the binary and return its JIT_LAUNCH_SYMBOL, or nullptr.
+    using LoadFunc = std::function<void *(std::string const &binaryPath)>;
+
+    ShapeJitCache(std::string cacheDir, CompileFunc compile, LoadFunc load, uint32_t hotThreshold = 1)
+        : cacheDir(std::move(cacheDir)), compile(std::move(compile)), load(std::move(load)),
+          hotThreshold(hotThreshold == 0 ? 1 : hotThreshold) {}
+
+    ShapeJitCache(ShapeJitCache const &) = delete;
+    ShapeJitCache &operator=(ShapeJitCache const &) = delete;
+
+    ~ShapeJitCache()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        queueCond.notify_all();
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    /// Launcher of the specialized binary if it is ready, nullptr otherwise. Never blocks on a compile.
+    void *Lookup(JitKernelSpec const &spec, JitShape const &shape)
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        auto &entry = entries[std::make_pair(spec.body, shape)];
+        if (entry == nullptr) {
+            entry = std::make_unique<Entry>();
+            entry->spec = spec;
+            entry->shape = shape;
+        }
+        void *launcher = entry->launcher;
+        if (launcher != nullptr) {
+            ++stats.hits;
+            return launcher;
+        }
+        ++stats.fallbacks;
+        if (entry->state == State::COLD && ++entry->calls >= hotThreshold) {
+            entry->state = State::QUEUED;
+            queue.push_back(entry.get());
+            StartWorker();
+            lock.unlock();
+            queueCond.notify_one();
+        }
+        return nullptr;
+    }
+
+    /// Block until every queued specialization is built or has failed, e.g. for a warm start or in tests.
+    void WaitIdle()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        idleCond.wait(lock, [this]() { return queue.empty() && !busy; });
+    }
+
+    ShapeJitStats Stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+    std::string const &CacheDir() const
+    {
+        return cacheDir;
+    }
+
+private:
+    enum class State { COLD, QUEUED, READY, FAILED };
+
+    struct Entry {
+        JitKernelSpec spec;
+        JitShape shape;
+        uint32_t calls{0};
+        State state{State::COLD};
+        void *launcher{nullptr};
+    };
+
+    void StartWorker()
+    {
+        if (!worker.joinable()) {
+            worker = std::thread([this]() { WorkerLoop(); });
+        }
+    }
+
+    void WorkerLoop()
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        while (true) {
+            queueCond.wait(lock, [this]() { return stopping || !queue.empty(); });
+            if (stopping) {
+                return;
+            }
+            Entry *entry = queue.front();
+            queue.pop_front();
+            busy = true;
+            JitKernelSpec spec = entry->spec;
+            JitShape shape = entry->shape;
+            lock.unlock();
+
+            bool fromDisk = false;
+            bool compiled = false;
+            void *launcher = Build(spec, shape, fromDisk, compiled);
+
+            lock.lock();
+            entry->launcher = launcher;
+            entry->state = (launcher != nullptr) ? State::READY : State::FAILED;
+            stats.diskHits += fromDisk ? 1 : 0;
+            stats.compiles += compiled ? 1 : 0;
+            stats.failures += (launcher == nullptr) ? 1 : 0;
+            busy = false;
+            if (queue.empty()) {
+                idleCond.notify_all();
+            }
+        }
+    }
+
+    void *Build(JitKernelSpec const &spec, JitShape const &shape, bool &fromDisk, bool &compiled)
+    {
+        std::string source = GenerateShapeSource(spec, shape);
+        std::string binaryName = JitBinaryName(spec, shape, source);
+        std::filesystem::path binaryPath = std::filesystem::path(cacheDir) / binaryName;
+
+        std::error_code error;
+        if (std::filesystem::exists(binaryPath, error)) {
+            fromDisk = true;
+            return load(binaryPath.string());
+        }
+
+        std::filesystem::create_directories(cacheDir, error);
+        std::filesystem::path sourcePath = binaryPath;
+        sourcePath.replace_extension(".cpp");
+        {
+            std::ofstream file(sourcePath, std::ios::trunc);
+            file << source;
+            if (!file) {
+                return nullptr;
+            }
+        }
+        // Build into a private file and publish it with a rename, so that another process sharing the cache
+        // directory never loads a partly written binary.
+        std::filesystem::path tmpPath = binaryPath;
+        tmpPath += ".tmp" + std::to_string(getpid());
+        compiled = compile(sourcePath.string(), tmpPath.string());
+        if (!compiled) {
+            std::filesystem::remove(tmpPath, error);
+            return nullptr;
+        }
+        std::filesystem::rename(tmpPath, binaryPath, error);
+        if (error) {
+            std::filesystem::remove(tmpPath, error);
+            return nullptr;
+        }
+        return load(binaryPath.string());
+    }
+
+    std::string cacheDir;
+    CompileFunc compile;
+    LoadFunc load;
+    uint32_t hotThreshold;
+
+    mutable std::mutex mutex;
+    std::condition_variable queueCond;
+    std::condition_variable idleCond;
+    std::map<std::pair<std::string, JitShape>, std::unique_ptr<Entry>> entries;
+    std::deque<Entry *> queue;
+    ShapeJitStats stats;
+    bool busy{false};
+    bool stopping{false};
+    std::thread worker;
+};
+
+} // namespace CatlassKernel::Jit
+
+#endif // SHARED_LIB_JIT_SHAPE_JIT_CACHE_HPP
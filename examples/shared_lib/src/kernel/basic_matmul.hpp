@@ -25,12 +25,26 @@
 #include "catlass/gemm/dispatch_policy.hpp"
 #include "catlass/gemm/gemm_type.hpp"
 #include "catlass/gemm/kernel/basic_matmul.hpp"
+#include "catlass/gemm/kernel/optimized_matmul.hpp"
 #include "catlass/layout/layout.hpp"
 
 namespace Catlass {
 
+/// Layout of a rows x cols operand in GM. Fractal layouts (an offline packed B) are padded to whole fractals.
+template<class Layout, class Element>
+CATLASS_DEVICE Layout MakeOperandLayout(uint32_t rows, uint32_t cols)
+{
+    if constexpr (std::is_same_v<Layout, layout::zN> || std::is_same_v<Layout, layout::nZ>) {
+        return Layout::template MakeLayout<Element>(rows, cols);
+    } else {
+        return Layout(rows, cols);
+    }
+}
+
+/// Body of basic_matmul. The shape JIT calls it from a generated kernel with a constant problem shape, so that
+/// the loop bounds, tails and swizzle arithmetic are folded at compile time.
 template<class LayoutA, class LayoutB, class LayoutC, class InDType, class OutDType>
-CATLASS_GLOBAL void basic_matmul(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gmB, GM_ADDR gmC)
+CATLASS_DEVICE void BasicMatmulBody(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gmB, GM_ADDR gmC)
 {
     using ArchTag = Arch::AtlasA2;
     using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<true>;
@@ -45,7 +59,7 @@ CATLASS_GLOBAL void basic_matmul(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gm
     using BlockEpilogue = void;
 
     LayoutA layoutA(problemShape.m(), problemShape.k());
-    LayoutB layoutB(problemShape.k(), problemShape.n());
+    auto layoutB = MakeOperandLayout<LayoutB, InDType>(problemShape.k(), problemShape.n());
     LayoutC layoutC(problemShape.m(), problemShape.n());
 
     if (problemShape.m() > problemShape.n()) {
@@ -74,5 +88,82 @@ CATLASS_GLOBAL void basic_matmul(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gm
         matmul(params);
     }
 }
+
+template<class LayoutA, class LayoutB, class LayoutC, class InDType, class OutDType>
+CATLASS_GLOBAL void basic_matmul(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gmB, GM_ADDR gmC)
+{
+    BasicMatmulBody<LayoutA, LayoutB, LayoutC, InDType, OutDType>(problemShape, gmA, gmB, gmC);
+}
+
+/// Instantiation with an explicit tile and swizzle configuration, used by the tuned dispatch.
+template<class LayoutA, class LayoutB, class LayoutC, class InDType, class OutDType,
+    uint32_t L1_M, uint32_t L1_N, uint32_t L1_K, uint32_t L0_K, uint32_t SWIZZLE_OFFSET, uint32_t SWIZZLE_DIRECTION>
+CATLASS_GLOBAL void basic_matmul_tuned(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gmB, GM_ADDR gmC)
+{
+    using ArchTag = Arch::AtlasA2;
+    using DispatchPolicy = Gemm::MmadAtlasA2Pingpong<true>;
+    using L1TileShape = GemmShape<L1_M, L1_N, L1_K>;
+    using L0TileShape = GemmShape<L1_M, L1_N, L0_K>;
+
+    using AType = Gemm::GemmType<InDType, LayoutA>;
+    using BType = Gemm::GemmType<InDType, LayoutB>;
+    using CType = Gemm::GemmType<OutDType, LayoutC>;
+
+    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+    using BlockEpilogue = void;
+    using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<SWIZZLE_OFFSET, SWIZZLE_DIRECTION>;
+
+    // kernel level
+    using MatmulKernel = Gemm::Kernel::BasicMatmul<BlockMmad, BlockEpilogue, BlockScheduler>;
+
+    LayoutA layoutA(problemShape.m(), problemShape.k());
+    LayoutB layoutB(problemShape.k(), problemShape.n());
+    LayoutC layoutC(problemShape.m(), problemShape.n());
+    typename MatmulKernel::Params params{problemShape, gmA, layoutA, gmB, layoutB, gmC, layoutC};
+
+    // call a kernel
+    MatmulKernel matmul;
+    matmul(params);
+}
+
+/// Preload dispatch policy without padding prologues, the next block is loaded while the current one is computed.
+/// Suited for large problems where each core runs many blocks.
+template<class LayoutA, class LayoutB, class LayoutC, class InDType, class OutDType>
+CATLASS_GLOBAL void basic_matmul_preload(GemmCoord problemShape, GM_ADDR gmA, GM_ADDR gmB, GM_ADDR gmC)
+{
+    using ArchTag = Arch::AtlasA2;
+    constexpr bool enableUnitFlag = true;
+    constexpr bool enableShuffleK = true;
+    using DispatchPolicy = Gemm::MmadAtlasA2Preload<enableUnitFlag, enableShuffleK>;
+    using L1TileShape = GemmShape<128, 256, 256>;
+    using L0TileShape = GemmShape<128, 256, 64>;
+
+    using AType = Gemm::GemmType<InDType, LayoutA>;
+    using BType = Gemm::GemmType<InDType, LayoutB>;
+    using CType = Gemm::GemmType<OutDType, LayoutC>;
+
+    using BlockMmad = Gemm::Block::BlockMmad<DispatchPolicy, L1TileShape, L0TileShape, AType, BType, CType>;
+    using BlockEpilogue = void;
+
+    LayoutA layoutA(problemShape.m(), problemShape.k());
+    LayoutB layoutB(problemShape.k(), problemShape.n());
+    LayoutC layoutC(problemShape.m(), problemShape.n());
+
+    if (problemShape.m() > problemShape.n()) {
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 0>;
+        using MatmulKernel = Gemm::Kernel::OptimizedMatmul<void, void, BlockMmad, BlockEpilogue, BlockScheduler>;
+        typename MatmulKernel::Params params{
+            problemShape, gmA, layoutA, gmB, layoutB, gmC, layoutC, gmA, layoutA, gmB, layoutB};
+        MatmulKernel matmul;
+        matmul(params);
+    } else {
+        using BlockScheduler = typename Gemm::Block::GemmIdentityBlockSwizzle<3, 1>;
+        using MatmulKernel = Gemm::Kernel::OptimizedMatmul<void, void, BlockMmad, BlockEpilogue, BlockScheduler>;
+        typename MatmulKernel::Params params{
+            problemShape, gmA, layoutA, gmB, layoutB, gmC, layoutC, gmA, layoutA, gmB, layoutB};
+        MatmulKernel matmul;
+        matmul(params);
+    }
+}
 } // namespace Catlass
 #endif // SHARED_LIB_IMPL_BASIC_MATMUL_H
\ No newline at end of file
@@ -37,19 +37,14 @@ template <
     class CType,
     /// GemmType type for Bias operand
     class BiasType = void>
-struct TileCopyOpt : public Catlass::Gemm::Tile::TileCopy<ArchTag, AType, BType, CType, BiasType> {
-    using Base = Catlass::Gemm::Tile::TileCopy<ArchTag, AType, BType, CType, BiasType>;
+struct TileCopyOpt : public Catlass::Gemm::Tile::TileCopyAdaptive<ArchTag, AType, BType, CType, BiasType> {
+    using Base = Catlass::Gemm::Tile::TileCopyAdaptive<ArchTag, AType, BType, CType, BiasType>;
     using ElementA = typename Base::ElementA;
     using ElementB = typename Base::ElementB;
     using ElementAccumulator = typename Base::ElementAccumulator;
 
-    // When matrix A is row-major, if the number of rows in matrix A is less than 16,
-    // using the CopyGmToL1IntervalDataCopy method can improve the transfer efficiency.
-    // The situation is similar for matrix B. If the above conditions are met,
-    // please uncomment the following and comment out the original matrix A transfer method
-
-    // using CopyGmToL1A = Gemm::Tile::CopyGmToL1IntervalDataCopy<ArchTag, AType>;
-
+    // TileCopyAdaptive switches to CopyGmToL1IntervalDataCopy per tile when the tile has few rows (A row-major)
+    // or few columns (B column-major), and for strides the padding cost model leaves in place.
     using CopyGmToL1A = typename Base::CopyGmToL1A;
     using CopyGmToL1B = typename Base::CopyGmToL1B;
 
@@ -77,28 +72,6 @@ template <class Layout> size_t GetWorkspaceLen(Layout layout, size_t blockRows,
            RoundUp(static_cast<size_t>(layout.shape(1)), blockCols);
 }
 
-bool IsNeedPadding(layout::RowMajor layout, uint32_t align)
-{
-    // If the stride is greater than 65536, padding is required to reduce the
-    // stride.
-    if (layout.stride(0) < 65536) {
-        return layout.stride(0) % align != 0;
-    } else {
-        return true;
-    }
-}
-
-bool IsNeedPadding(layout::ColumnMajor layout, uint32_t align)
-{
-    // If the stride is greater than 65536, padding is required to reduce the
-    // stride.
-    if (layout.stride(1) < 65536) {
-        return layout.stride(1) % align != 0;
-    } else {
-        return true;
-    }
-}
-
 // common val
 
 template <class Type, bool PADDING> struct PaddingHelper {
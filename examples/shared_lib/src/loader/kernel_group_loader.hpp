@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_LOADER_KERNEL_GROUP_LOADER_HPP
+#define SHARED_LIB_LOADER_KERNEL_GROUP_LOADER_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CatlassKernel::Loader {
+
+/// One host entry exported by a kernel group, e.g. {"BasicMatmul", <function address>}.
+struct KernelEntry {
+    const char *name;
+    void *func;
+};
+
+/// Every kernel group library exports one C function of this type, named by KernelGroupSymbol.
+using KernelGroupEntriesFunc = KernelEntry const *(*)(size_t *entryNum);
+
+inline std::string KernelGroupSymbol(std::string const &group)
+{
+    return "CatlassKernelGroup_" + group;
+}
+
+/// Kernels are split into groups, one loadable binary per group. Loading a group is what registers its
+/// device binaries with the runtime, so it is deferred until one of the kernel IDs of the group is dispatched.
+/// Each group is loaded at most once, also under concurrent dispatch. A group that fails to load is not retried.
+/// The runtime is passed in (dlopen/dlsym for the shared library), so the loader itself is pure host code.
+class KernelGroupLoader {
+public:
+    using OpenFunc = std::function<void *(std::string const &library)>;
+    using SymbolFunc = std::function<void *(void *handle, std::string const &symbol)>;
+    using CloseFunc = std::function<void(void *handle)>;
+
+    KernelGroupLoader(OpenFunc open, SymbolFunc symbol, CloseFunc close = nullptr)
+        : open(std::move(open)), symbol(std::move(symbol)), close(std::move(close)) {}
+
+    KernelGroupLoader(KernelGroupLoader const &) = delete;
+    KernelGroupLoader &operator=(KernelGroupLoader const &) = delete;
+
+    ~KernelGroupLoader()
+    {
+        if (!close) {
+            return;
+        }
+        for (auto &item : groups) {
+            if (item.second->handle != nullptr) {
+                close(item.second->handle);
+            }
+        }
+    }
+
+    /// Declare a group and the kernel IDs it exports. Nothing is loaded. Returns false if the group or
+    /// one of the kernel IDs is already declared.
+    bool AddGroup(std::string const &name, std::string const &library, std::vector<std::string> const &kernelIds)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (groups.count(name) != 0) {
+            return false;
+        }
+        for (auto const &kernelId : kernelIds) {
+            if (owners.count(kernelId) != 0) {
+                return false;
+            }
+        }
+        auto group = std::make_unique<Group>();
+        group->name = name;
+        group->library = library;
+        group->kernelIds = kernelIds;
+        for (auto const &kernelId : kernelIds) {
+            owners[kernelId] = group.get();
+        }
+        groups[name] = std::move(group);
+        return true;
+    }
+
+    /// Load the group unless it is loaded already. Returns whether the group is usable.
+    bool Load(std::string const &name)
+    {
+        Group *group = FindGroup(name);
+        return (group != nullptr) && LoadGroup(*group);
+    }
+
+    /// Load the given groups, or every declared group if the list is empty, e.g. for a warm start.
+    /// Returns the number of groups that are usable afterwards.
+    size_t Preload(std::vector<std::string> const &names = {})
+    {
+        std::vector<std::string> targets = names.empty() ? Groups() : names;
+        size_t loaded = 0;
+        for (auto const &name : targets) {
+            loaded += Load(name) ? 1 : 0;
+        }
+        return loaded;
+    }
+
+    /// Entry of the kernel ID, loading its group on first use. Returns nullptr if the kernel ID is unknown
+    /// or its group fails to load.
+    void *Find(std::string const &kernelId)
+    {
+        Group *group = FindOwner(kernelId);
+        if (group == nullptr || !LoadGroup(*group)) {
+            return nullptr;
+        }
+        return group->Entry(kernelId);
+    }
+
+    /// Entry of the kernel ID if its group is loaded already, never loads.
+    void *FindLoaded(std::string const &kernelId) const
+    {
+        Group *group = FindOwner(kernelId);
+        if (group == nullptr || group->state.load(std::memory_order_acquire) != State::LOADED) {
+            return nullptr;
+        }
+        return group->Entry(kernelId);
+    }
+
+    bool IsLoaded(std::string const &name) const
+    {
+        Group *group = FindGroup(name);
+        return (group != nullptr) && (group->state.load(std::memory_order_acquire) == State::LOADED);
+    }
+
+    std::vector<std::string> Groups() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> names;
+        for (auto const &item : groups) {
+            names.push_back(item.first);
+        }
+        return names;
+    }
+
+    /// Names of the groups that are loaded, sorted by name.
+    std::vector<std::string> LoadedGroups() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<std::string> names;
+        for (auto const &item : groups) {
+            if (item.second->state.load(std::memory_order_acquire) == State::LOADED) {
+                names.push_back(item.first);
+            }
+        }
+        return names;
+    }
+
+private:
+    enum class State { UNLOADED, LOADED, FAILED };
+
+    struct Group {
+        std::string name;
+        std::string library;
+        std::vector<std::string> kernelIds;
+        std::mutex loadMutex;
+        std::atomic<State> state{State::UNLOADED};
+        void *handle{nullptr};
+        // Written once under loadMutex before state becomes LOADED, read only afterwards.
+        std::map<std::string, void *> entries;
+
+        void *Entry(std::string const &kernelId) const
+        {
+            auto it = entries.find(kernelId);
+            return (it == entries.end()) ? nullptr : it->second;
+        }
+    };
+
+    Group *FindGroup(std::string const &name) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = groups.find(name);
+        return (it == groups.end()) ? nullptr : it->second.get();
+    }
+
+    Group *FindOwner(std::string const &kernelId) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = owners.find(kernelId);
+        return (it == owners.end()) ? nullptr : it->second;
+    }
+
+    bool LoadGroup(Group &group)
+    {
+        State state = group.state.load(std::memory_order_acquire);
+        if (state != State::UNLOADED) {
+            return state == State::LOADED;
+        }
+        std::lock_guard<std::mutex> lock(group.loadMutex);
+        state = group.state.load(std::memory_order_acquire);
+        if (state != State::UNLOADED) {
+            return state == State::LOADED;
+        }
+        bool loaded = OpenGroup(group);
+        group.state.store(loaded ? State::LOADED : State::FAILED, std::memory_order_release);
+        return loaded;
+    }
+
+    bool OpenGroup(Group &group)
+    {
+        void *handle = open(group.library);
+        if (handle == nullptr) {
+            return false;
+        }
+        auto entriesFunc = reinterpret_cast<KernelGroupEntriesFunc>(symbol(handle, KernelGroupSymbol(group.name)));
+        size_t entryNum = 0;
+        KernelEntry const *entries = (entriesFunc == nullptr) ? nullptr : entriesFunc(&entryNum);
+        if (entries != nullptr) {
+            for (size_t i = 0; i < entryNum; ++i) {
+                group.entries[entries[i].name] = entries[i].func;
+            }
+        }
+        // The library must provide every kernel ID it was declared with.
+        for (auto const &kernelId : group.kernelIds) {
+            if (group.Entry(kernelId) == nullptr) {
+                group.entries.clear();
+                if (close) {
+                    close(handle);
+                }
+                return false;
+            }
+        }
+        group.handle = handle;
+        return true;
+    }
+
+    OpenFunc open;
+    SymbolFunc symbol;
+    CloseFunc close;
+    mutable std::mutex mutex;
+    std::map<std::string, std::unique_ptr<Group>> groups;
+    std::map<std::string, Group *> owners;
+};
+
+} // namespace CatlassKernel::Loader
+
+#endif // SHARED_LIB_LOADER_KERNEL_GROUP_LOADER_HPP
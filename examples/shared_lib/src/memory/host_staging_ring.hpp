@@ -0,0 +1,216 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_MEMORY_HOST_STAGING_RING_HPP
+#define SHARED_LIB_MEMORY_HOST_STAGING_RING_HPP
+
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace CatlassKernel::Memory {
+
+struct HostStagingRingStats {
+    /// Uploads staged through the ring.
+    size_t uploads{0};
+    /// Uploads that had to wait for the fence of an older slot.
+    size_t fenceWaits{0};
+    /// Uploads the ring could not take (too large, or full of slots that are not committed yet).
+    size_t rejects{0};
+};
+
+/// Ring of small metadata uploads (group lists, sequence lengths, block tables) for asynchronous launches.
+/// The ring owns a pinned host buffer and a device buffer of the same size, a slot is the same range in both.
+/// Stage copies the data into the host slot and enqueues the host to device copy on the launch stream, so the
+/// host never waits for the device. After the launches that read the slot are enqueued, Commit records a fence on
+/// the stream; the slot is reused only after that fence has completed, i.e. after the kernels consumed it.
+/// Buffers, copies and fences are injected, so the ring runs without a device in tests.
+class HostStagingRing {
+public:
+    /// Enqueue the copy of size bytes from the pinned host pointer to the device pointer on the stream.
+    using CopyFunc = std::function<bool(uint8_t *device, uint8_t const *host, size_t size, uint64_t stream)>;
+    /// Record a fence on the stream, returns nullptr on failure.
+    using RecordFunc = std::function<void *(uint64_t stream)>;
+    /// Whether all work before the fence is done.
+    using QueryFunc = std::function<bool(void *fence)>;
+    /// Block until all work before the fence is done.
+    using WaitFunc = std::function<void(void *fence)>;
+    using DestroyFunc = std::function<void(void *fence)>;
+
+    struct FenceOps {
+        RecordFunc record;
+        QueryFunc query;
+        WaitFunc wait;
+        DestroyFunc destroy;
+    };
+
+    static constexpr size_t SLOT_ALIGN = 64;
+
+    HostStagingRing(uint8_t *hostBuffer, uint8_t *deviceBuffer, size_t capacity, CopyFunc copy, FenceOps fenceOps)
+        : hostBuffer(hostBuffer), deviceBuffer(deviceBuffer), capacity(capacity), copy(std::move(copy)),
+          fenceOps(std::move(fenceOps)) {}
+
+    HostStagingRing(HostStagingRing const &) = delete;
+    HostStagingRing &operator=(HostStagingRing const &) = delete;
+
+    /// Waits for the fences still pending, the buffers may be freed afterwards.
+    ~HostStagingRing()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (!slots.empty()) {
+            if (slots.front().fence != nullptr) {
+                fenceOps.wait(slots.front().fence.get());
+            }
+            slots.pop_front();
+        }
+    }
+
+    /// Upload the data for the next launch on the stream, returns its device address. Returns nullptr if the ring
+    /// can not take it, the caller then falls back to a synchronous upload.
+    uint8_t *Stage(void const *data, size_t size, uint64_t stream)
+    {
+        if (size == 0) {
+            return nullptr;
+        }
+        size_t alignedSize = (size + SLOT_ALIGN - 1) / SLOT_ALIGN * SLOT_ALIGN;
+        std::lock_guard<std::mutex> lock(mutex);
+        size_t offset = 0;
+        while (!FindRoom(alignedSize, offset)) {
+            if (!ReclaimOldest()) {
+                ++stats.rejects;
+                return nullptr;
+            }
+        }
+        std::memcpy(hostBuffer + offset, data, size);
+        if (!copy(deviceBuffer + offset, hostBuffer + offset, size, stream)) {
+            ++stats.rejects;
+            return nullptr;
+        }
+        slots.push_back(Slot{offset, alignedSize, stream, nullptr});
+        ++stats.uploads;
+        return deviceBuffer + offset;
+    }
+
+    /// Fence every slot staged on the stream since its last commit. Call it after enqueuing the launches that read
+    /// them. Returns false if the fence could not be recorded, the slots are then reclaimed only by waiting for the
+    /// stream in Drain.
+    bool Commit(uint64_t stream)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::shared_ptr<void> fence;
+        for (auto &slot : slots) {
+            if (slot.stream != stream || slot.fence != nullptr) {
+                continue;
+            }
+            if (fence == nullptr) {
+                void *handle = fenceOps.record(stream);
+                if (handle == nullptr) {
+                    return false;
+                }
+                fence = std::shared_ptr<void>(handle, fenceOps.destroy);
+            }
+            slot.fence = fence;
+        }
+        return true;
+    }
+
+    /// Reclaim every committed slot whose fence has completed, without waiting.
+    void Poll()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        while (!slots.empty() && slots.front().fence != nullptr && fenceOps.query(slots.front().fence.get())) {
+            slots.pop_front();
+        }
+    }
+
+    size_t PendingSlots() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return slots.size();
+    }
+
+    HostStagingRingStats Stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+private:
+    struct Slot {
+        size_t offset;
+        size_t size;
+        uint64_t stream;
+        // Shared by the slots of one commit, destroyed with the last of them.
+        std::shared_ptr<void> fence;
+    };
+
+    bool FindRoom(size_t size, size_t &offset) const
+    {
+        if (size > capacity) {
+            return false;
+        }
+        if (slots.empty()) {
+            offset = 0;
+            return true;
+        }
+        size_t oldest = slots.front().offset;
+        size_t newestEnd = slots.back().offset + slots.back().size;
+        bool wrapped = slots.back().offset < oldest;
+        if (!wrapped) {
+            if (newestEnd + size <= capacity) {
+                offset = newestEnd;
+                return true;
+            }
+            // The tail of the buffer is too short, the slot starts over at the front.
+            if (size <= oldest) {
+                offset = 0;
+                return true;
+            }
+            return false;
+        }
+        if (newestEnd + size <= oldest) {
+            offset = newestEnd;
+            return true;
+        }
+        return false;
+    }
+
+    /// Free the oldest slot, waiting for its fence if needed. Returns false if it is not committed yet.
+    bool ReclaimOldest()
+    {
+        if (slots.empty() || slots.front().fence == nullptr) {
+            return false;
+        }
+        void *fence = slots.front().fence.get();
+        if (!fenceOps.query(fence)) {
+            ++stats.fenceWaits;
+            fenceOps.wait(fence);
+        }
+        slots.pop_front();
+        return true;
+    }
+
+    uint8_t *hostBuffer;
+    uint8_t *deviceBuffer;
+    size_t capacity;
+    CopyFunc copy;
+    FenceOps fenceOps;
+    mutable std::mutex mutex;
+    std::deque<Slot> slots;
+    HostStagingRingStats stats;
+};
+
+} // namespace CatlassKernel::Memory
+
+#endif // SHARED_LIB_MEMORY_HOST_STAGING_RING_HPP
@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_MEMORY_STREAM_MEMORY_POOL_HPP
+#define SHARED_LIB_MEMORY_STREAM_MEMORY_POOL_HPP
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace CatlassKernel::Memory {
+
+constexpr size_t POOL_MIN_BLOCK_SIZE = 512;
+constexpr size_t POOL_SMALL_SIZE_LIMIT = 1024 * 1024;
+constexpr size_t POOL_LARGE_ROUND_SIZE = 2 * 1024 * 1024;
+
+/// Size class of a request: powers of two from 512B up to 1MB, multiples of 2MB above.
+/// Blocks are only reused within their class, which bounds the waste to half a block for small requests.
+inline size_t PoolSizeClass(size_t size)
+{
+    if (size <= POOL_MIN_BLOCK_SIZE) {
+        return POOL_MIN_BLOCK_SIZE;
+    }
+    if (size <= POOL_SMALL_SIZE_LIMIT) {
+        size_t sizeClass = POOL_MIN_BLOCK_SIZE;
+        while (sizeClass < size) {
+            sizeClass <<= 1;
+        }
+        return sizeClass;
+    }
+    return (size + POOL_LARGE_ROUND_SIZE - 1) / POOL_LARGE_ROUND_SIZE * POOL_LARGE_ROUND_SIZE;
+}
+
+struct StreamMemoryPoolStats {
+    /// Blocks obtained from the device allocator.
+    size_t deviceAllocs{0};
+    /// Blocks returned to the device allocator.
+    size_t deviceFrees{0};
+    /// Allocations served from a free list.
+    size_t reuses{0};
+    size_t allocatedBytes{0};
+    size_t cachedBytes{0};
+};
+
+/// Caching allocator for transient device memory, stream ordered: a block freed on a stream goes to the free list
+/// of that stream and is handed out again only for work on the same stream, which the stream runs after every
+/// launch that used the block before. No synchronization is needed on free or reuse.
+/// Cached blocks go back to the device allocator only in Release, or when the device allocator runs out of memory,
+/// after synchronizing their stream. The device calls are injected, so the pool runs without a device in tests.
+class StreamMemoryPool {
+public:
+    using MallocFunc = std::function<void *(size_t size)>;
+    using FreeFunc = std::function<void(void *ptr)>;
+    /// Wait until all work enqueued on the stream is done.
+    using SyncFunc = std::function<void(uint64_t stream)>;
+
+    StreamMemoryPool(MallocFunc deviceMalloc, FreeFunc deviceFree, SyncFunc syncStream)
+        : deviceMalloc(std::move(deviceMalloc)), deviceFree(std::move(deviceFree)),
+          syncStream(std::move(syncStream)) {}
+
+    StreamMemoryPool(StreamMemoryPool const &) = delete;
+    StreamMemoryPool &operator=(StreamMemoryPool const &) = delete;
+
+    /// Returns nullptr for a zero size or if the device is out of memory even after releasing the cache.
+    void *Allocate(size_t size, uint64_t stream)
+    {
+        if (size == 0) {
+            return nullptr;
+        }
+        size_t sizeClass = PoolSizeClass(size);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = freeLists.find(std::make_pair(stream, sizeClass));
+        if (it != freeLists.end() && !it->second.empty()) {
+            void *ptr = it->second.back();
+            it->second.pop_back();
+            stats.cachedBytes -= sizeClass;
+            stats.allocatedBytes += sizeClass;
+            ++stats.reuses;
+            blocks[ptr] = Block{sizeClass, stream};
+            return ptr;
+        }
+
+        void *ptr = deviceMalloc(sizeClass);
+        if (ptr == nullptr && stats.cachedBytes > 0) {
+            // Out of memory, give the cached blocks of every stream back and retry once.
+            ReleaseLocked(nullptr);
+            ptr = deviceMalloc(sizeClass);
+        }
+        if (ptr == nullptr) {
+            return nullptr;
+        }
+        ++stats.deviceAllocs;
+        stats.allocatedBytes += sizeClass;
+        blocks[ptr] = Block{sizeClass, stream};
+        return ptr;
+    }
+
+    /// Return a block to the free list of the stream it was allocated for. Work already enqueued on that stream may
+    /// still use it. Returns false if the pointer was not allocated by the pool.
+    bool Free(void *ptr)
+    {
+        if (ptr == nullptr) {
+            return true;
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = blocks.find(ptr);
+        if (it == blocks.end()) {
+            return false;
+        }
+        Block block = it->second;
+        blocks.erase(it);
+        freeLists[std::make_pair(block.stream, block.sizeClass)].push_back(ptr);
+        stats.allocatedBytes -= block.sizeClass;
+        stats.cachedBytes += block.sizeClass;
+        return true;
+    }
+
+    /// Give the cached blocks of the stream back to the device, e.g. before the stream is destroyed.
+    void ReleaseStream(uint64_t stream)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ReleaseLocked(&stream);
+    }
+
+    /// Give every cached block back to the device. Blocks in use are not affected.
+    void Release()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        ReleaseLocked(nullptr);
+    }
+
+    StreamMemoryPoolStats Stats() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return stats;
+    }
+
+private:
+    struct Block {
+        size_t sizeClass;
+        uint64_t stream;
+    };
+
+    using FreeListKey = std::pair<uint64_t, size_t>;
+
+    void ReleaseLocked(uint64_t const *stream)
+    {
+        std::set<uint64_t> synced;
+        for (auto it = freeLists.begin(); it != freeLists.end();) {
+            uint64_t listStream = it->first.first;
+            if (stream != nullptr && listStream != *stream) {
+                ++it;
+                continue;
+            }
+            // The last launches on the stream may still use the blocks.
+            if (!it->second.empty() && synced.insert(listStream).second && syncStream) {
+                syncStream(listStream);
+            }
+            for (void *ptr : it->second) {
+                deviceFree(ptr);
+                ++stats.deviceFrees;
+                stats.cachedBytes -= it->first.second;
+            }
+            it = freeLists.erase(it);
+        }
+    }
+
+    MallocFunc deviceMalloc;
+    FreeFunc deviceFree;
+    SyncFunc syncStream;
+    mutable std::mutex mutex;
+    std::map<void *, Block> blocks;
+    std::map<FreeListKey, std::vector<void *>> freeLists;
+    StreamMemoryPoolStats stats;
+};
+
+} // namespace CatlassKernel::Memory
+
+#endif // SHARED_LIB_MEMORY_STREAM_MEMORY_POOL_HPP
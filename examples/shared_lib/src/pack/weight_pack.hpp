@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_PACK_WEIGHT_PACK_HPP
+#define SHARED_LIB_PACK_WEIGHT_PACK_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "catlass/detail/constants.hpp"
+
+namespace CatlassKernel::Pack {
+
+using Catlass::BYTE_PER_C0;
+using Catlass::BYTE_PER_FRACTAL;
+using Catlass::C0_NUM_PER_FRACTAL;
+
+enum class FractalFormat : uint32_t {
+    // Row major inside a fractal, fractals column major (layout::zN).
+    ZN = 0,
+    // Column major inside a fractal, fractals row major (layout::nZ).
+    NZ = 1,
+};
+
+/// The format the cube loads a k x n B operand into L1: zN for a row major B and nZ for a transposed one.
+/// Packing into the same format keeps the L1 contents, and so the results, of the unpacked kernel.
+inline FractalFormat PackedFormatOfB(bool transB)
+{
+    return transB ? FractalFormat::NZ : FractalFormat::ZN;
+}
+
+/// Host mirror of layout::zN::MakeLayout<Element> and layout::nZ::MakeLayout<Element> for a rows x cols matrix.
+/// The padding up to whole fractals is zero filled, so every L1 tile of any tile shape is a single DataCopy with
+/// one contiguous run per fractal column (zN) or fractal row (nZ).
+struct FractalLayout {
+    FractalFormat format{FractalFormat::ZN};
+    uint32_t rows{0};
+    uint32_t cols{0};
+    uint32_t elementBytes{0};
+    uint32_t rowsRound{0};
+    uint32_t colsRound{0};
+
+    uint32_t EleNumPerC0() const
+    {
+        return BYTE_PER_C0 / elementBytes;
+    }
+
+    size_t Size() const
+    {
+        return static_cast<size_t>(rowsRound) * colsRound;
+    }
+
+    size_t SizeInBytes() const
+    {
+        return Size() * elementBytes;
+    }
+
+    /// Element offset of (row, col), same as GetOffset of the device layout.
+    size_t Offset(uint32_t row, uint32_t col) const
+    {
+        size_t c0 = EleNumPerC0();
+        size_t fractal = BYTE_PER_FRACTAL / elementBytes;
+        if (format == FractalFormat::ZN) {
+            return row / C0_NUM_PER_FRACTAL * fractal + col / c0 * (rowsRound * c0) +
+                row % C0_NUM_PER_FRACTAL * c0 + col % c0;
+        }
+        return row / c0 * (colsRound * c0) + col / C0_NUM_PER_FRACTAL * fractal +
+            row % c0 + col % C0_NUM_PER_FRACTAL * c0;
+    }
+};
+
+inline uint32_t RoundUpU32(uint32_t value, uint32_t align)
+{
+    return (value + align - 1) / align * align;
+}
+
+/// Returns a layout with elementBytes 0 if the element size does not divide a C0 block.
+inline FractalLayout MakeFractalLayout(FractalFormat format, uint32_t rows, uint32_t cols, uint32_t elementBytes)
+{
+    FractalLayout layout;
+    if (elementBytes == 0 || BYTE_PER_C0 % elementBytes != 0) {
+        return layout;
+    }
+    uint32_t c0 = BYTE_PER_C0 / elementBytes;
+    layout.format = format;
+    layout.rows = rows;
+    layout.cols = cols;
+    layout.elementBytes = elementBytes;
+    if (format == FractalFormat::ZN) {
+        layout.rowsRound = RoundUpU32(rows, C0_NUM_PER_FRACTAL);
+        layout.colsRound = RoundUpU32(cols, c0);
+    } else {
+        layout.rowsRound = RoundUpU32(rows, c0);
+        layout.colsRound = RoundUpU32(cols, C0_NUM_PER_FRACTAL);
+    }
+    return layout;
+}
+
+/// Pack a rows x cols matrix, stored row major (srcColumnMajor false) or column major, into the fractal layout.
+/// Elements are copied bytewise, so any element type of layout.elementBytes bytes is packed bit exact.
+inline void PackFractal(void const *src, bool srcColumnMajor, FractalLayout const &layout, void *dst)
+{
+    auto const *srcBytes = static_cast<uint8_t const *>(src);
+    auto *dstBytes = static_cast<uint8_t *>(dst);
+    std::memset(dstBytes, 0, layout.SizeInBytes());
+    for (uint32_t row = 0; row < layout.rows; ++row) {
+        for (uint32_t col = 0; col < layout.cols; ++col) {
+            size_t srcIdx = srcColumnMajor ? static_cast<size_t>(col) * layout.rows + row :
+                static_cast<size_t>(row) * layout.cols + col;
+            std::memcpy(dstBytes + layout.Offset(row, col) * layout.elementBytes,
+                srcBytes + srcIdx * layout.elementBytes, layout.elementBytes);
+        }
+    }
+}
+
+/// Inverse of PackFractal, the padding is dropped.
+inline void UnpackFractal(void const *packed, FractalLayout const &layout, bool dstColumnMajor, void *dst)
+{
+    auto const *srcBytes = static_cast<uint8_t const *>(packed);
+    auto *dstBytes = static_cast<uint8_t *>(dst);
+    for (uint32_t row = 0; row < layout.rows; ++row) {
+        for (uint32_t col = 0; col < layout.cols; ++col) {
+            size_t dstIdx = dstColumnMajor ? static_cast<size_t>(col) * layout.rows + row :
+                static_cast<size_t>(row) * layout.cols + col;
+            std::memcpy(dstBytes + dstIdx * layout.elementBytes,
+                srcBytes + layout.Offset(row, col) * layout.elementBytes, layout.elementBytes);
+        }
+    }
+}
+
+} // namespace CatlassKernel::Pack
+
+#endif // SHARED_LIB_PACK_WEIGHT_PACK_HPP
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_PLAN_LRU_CACHE_HPP
+#define SHARED_LIB_PLAN_LRU_CACHE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <list>
+#include <map>
+#include <utility>
+
+namespace CatlassKernel::Plan {
+
+/// Least recently used cache. The eviction callback runs for every value that leaves the cache,
+/// either by eviction or by Clear, so values owning resources can release them. Not thread safe.
+template <class Key, class Value>
+class LruCache {
+public:
+    using EvictFunc = std::function<void(Key const &, Value &)>;
+
+    explicit LruCache(size_t capacity_, EvictFunc onEvict_ = nullptr)
+        : capacity(capacity_ == 0 ? 1 : capacity_), onEvict(std::move(onEvict_)) {}
+
+    LruCache(LruCache const &) = delete;
+    LruCache &operator=(LruCache const &) = delete;
+
+    ~LruCache()
+    {
+        Clear();
+    }
+
+    /// Returns nullptr on a miss. A hit becomes the most recently used entry.
+    Value *Find(Key const &key)
+    {
+        auto it = index.find(key);
+        if (it == index.end()) {
+            return nullptr;
+        }
+        items.splice(items.begin(), items, it->second);
+        return &it->second->second;
+    }
+
+    /// Insert or replace the value of the key, evicting the least recently used entry when full.
+    Value &Insert(Key const &key, Value value)
+    {
+        auto it = index.find(key);
+        if (it != index.end()) {
+            Release(*it->second);
+            items.erase(it->second);
+            index.erase(it);
+        } else if (items.size() >= capacity) {
+            Release(items.back());
+            index.erase(items.back().first);
+            items.pop_back();
+        }
+        items.emplace_front(key, std::move(value));
+        index[key] = items.begin();
+        return items.front().second;
+    }
+
+    void Clear()
+    {
+        for (auto &item : items) {
+            Release(item);
+        }
+        items.clear();
+        index.clear();
+    }
+
+    size_t Size() const
+    {
+        return items.size();
+    }
+
+    size_t Capacity() const
+    {
+        return capacity;
+    }
+
+private:
+    using Item = std::pair<Key, Value>;
+
+    void Release(Item &item)
+    {
+        if (onEvict) {
+            onEvict(item.first, item.second);
+        }
+    }
+
+    size_t capacity;
+    EvictFunc onEvict;
+    std::list<Item> items;
+    std::map<Key, typename std::list<Item>::iterator> index;
+};
+
+} // namespace CatlassKernel::Plan
+
+#endif // SHARED_LIB_PLAN_LRU_CACHE_HPP
@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_PLAN_OPTIMIZED_MATMUL_PLAN_HPP
+#define SHARED_LIB_PLAN_OPTIMIZED_MATMUL_PLAN_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <tuple>
+
+#include "catlass/gemm/tile/copy_gm_to_l1_strategy.hpp"
+#include "plan/lru_cache.hpp"
+
+namespace CatlassKernel::Plan {
+
+constexpr size_t WORKSPACE_ALIGN_BYTE = 512;
+constexpr size_t OPTIMIZED_MATMUL_PLAN_CACHE_CAPACITY = 64;
+
+inline size_t RoundUpSize(size_t value, size_t align)
+{
+    return (value + align - 1) / align * align;
+}
+
+inline uint32_t CeilDivU32(uint32_t value, uint32_t divisor)
+{
+    return (value + divisor - 1) / divisor;
+}
+
+/// Whether the padding prologue is cheaper than loading the operand in place, see OperandPaddingCostModel.
+/// lineCount and lineLen describe one L1 tile of the operand, reuseCount is how often each tile is loaded.
+inline bool IsNeedPadding(uint32_t lineCount, uint32_t lineLen, uint32_t stride, uint32_t elementBytes,
+    uint32_t reuseCount)
+{
+    return Catlass::Gemm::Tile::OperandPaddingCostModel::NeedPadding(
+        lineCount, lineLen, stride, elementBytes, reuseCount);
+}
+
+/// Padding decisions are per shape, dtype and layout. The stream is part of the key, because the workspace
+/// of a plan may only be reused by launches that are ordered after each other.
+struct OptimizedMatmulPlanKey {
+    uint32_t m{0};
+    uint32_t n{0};
+    uint32_t k{0};
+    uint32_t dtype{0};
+    bool transA{false};
+    bool transB{false};
+    uint64_t stream{0};
+
+    auto Tie() const
+    {
+        return std::tie(m, n, k, dtype, transA, transB, stream);
+    }
+
+    bool operator<(OptimizedMatmulPlanKey const &other) const
+    {
+        return Tie() < other.Tie();
+    }
+};
+
+struct OptimizedMatmulPlan {
+    bool paddingA{false};
+    bool paddingB{false};
+    uint32_t l1M{0};
+    uint32_t l1N{0};
+    uint32_t l1K{0};
+    size_t sizeWA{0};
+    size_t sizeWB{0};
+    // Single device allocation holding WA at offset 0 and WB at OffsetWB(), nullptr if no padding is needed.
+    uint8_t *workspace{nullptr};
+
+    size_t OffsetWB() const
+    {
+        return RoundUpSize(sizeWA, WORKSPACE_ALIGN_BYTE);
+    }
+
+    size_t WorkspaceSize() const
+    {
+        return (sizeWB == 0) ? sizeWA : OffsetWB() + sizeWB;
+    }
+
+    /// Index of the padding instantiation, paddingA * 2 + paddingB.
+    uint32_t KernelIdx() const
+    {
+        return static_cast<uint32_t>(paddingA) * 2 + static_cast<uint32_t>(paddingB);
+    }
+};
+
+/// Host side planning of OptimizedMatmul, mirrors the tile and workspace choices of the kernel.
+inline OptimizedMatmulPlan MakeOptimizedMatmulPlan(OptimizedMatmulPlanKey const &key, uint32_t elementBytes)
+{
+    OptimizedMatmulPlan plan;
+    // Column major A and B use the transposed tile shape, see optimized_matmul in kernel/optimized_matmul.hpp.
+    bool bothColumnMajor = key.transA && key.transB;
+    plan.l1M = bothColumnMajor ? 256 : 128;
+    plan.l1N = bothColumnMajor ? 128 : 256;
+    plan.l1K = 256;
+
+    // The leading stride is the row length of a row major matrix and the column length of a column major one.
+    // A tile of A is loaded once per N tile and a tile of B once per M tile.
+    uint32_t strideA = key.transA ? key.m : key.k;
+    uint32_t strideB = key.transB ? key.k : key.n;
+    plan.paddingA = key.transA ?
+        IsNeedPadding(plan.l1K, plan.l1M, strideA, elementBytes, CeilDivU32(key.n, plan.l1N)) :
+        IsNeedPadding(plan.l1M, plan.l1K, strideA, elementBytes, CeilDivU32(key.n, plan.l1N));
+    plan.paddingB = key.transB ?
+        IsNeedPadding(plan.l1N, plan.l1K, strideB, elementBytes, CeilDivU32(key.m, plan.l1M)) :
+        IsNeedPadding(plan.l1K, plan.l1N, strideB, elementBytes, CeilDivU32(key.m, plan.l1M));
+    if (plan.paddingA) {
+        plan.sizeWA = RoundUpSize(key.m, plan.l1M) * RoundUpSize(key.k, plan.l1K) * elementBytes;
+    }
+    if (plan.paddingB) {
+        plan.sizeWB = RoundUpSize(key.k, plan.l1K) * RoundUpSize(key.n, plan.l1N) * elementBytes;
+    }
+    return plan;
+}
+
+/// LRU of OptimizedMatmul plans, each plan owns its workspace. Allocation and release are injected, so the cache
+/// runs without a device in tests. Release must not hand the workspace to other work before the last launch using
+/// it is done, e.g. by synchronizing the stream of the plan first, or by returning it to a stream ordered pool.
+class OptimizedMatmulPlanCache {
+public:
+    using AllocFunc = std::function<uint8_t *(OptimizedMatmulPlanKey const &, size_t)>;
+    using ReleaseFunc = std::function<void(OptimizedMatmulPlanKey const &, OptimizedMatmulPlan const &)>;
+
+    OptimizedMatmulPlanCache(size_t capacity, AllocFunc alloc_, ReleaseFunc release_)
+        : alloc(std::move(alloc_)), release(std::move(release_)),
+          plans(capacity, [this](OptimizedMatmulPlanKey const &key, OptimizedMatmulPlan &plan) {
+              if (plan.workspace != nullptr) {
+                  release(key, plan);
+                  plan.workspace = nullptr;
+              }
+          }) {}
+
+    /// Look up or create the plan of the key and call launch(plan) while the plan is pinned, so that the
+    /// workspace can not be released by another thread before the launch is enqueued.
+    /// Returns false if the workspace allocation failed, launch is not called then.
+    template <class LaunchFunc>
+    bool Execute(OptimizedMatmulPlanKey const &key, uint32_t elementBytes, LaunchFunc &&launch)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        OptimizedMatmulPlan *plan = plans.Find(key);
+        if (plan != nullptr) {
+            ++hits;
+        } else {
+            ++misses;
+            OptimizedMatmulPlan created = MakeOptimizedMatmulPlan(key, elementBytes);
+            size_t workspaceSize = created.WorkspaceSize();
+            if (workspaceSize > 0) {
+                created.workspace = alloc(key, workspaceSize);
+                if (created.workspace == nullptr) {
+                    return false;
+                }
+            }
+            plan = &plans.Insert(key, created);
+        }
+        launch(static_cast<OptimizedMatmulPlan const &>(*plan));
+        return true;
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        plans.Clear();
+    }
+
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return plans.Size();
+    }
+
+    size_t Hits() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return hits;
+    }
+
+    size_t Misses() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return misses;
+    }
+
+private:
+    AllocFunc alloc;
+    ReleaseFunc release;
+    mutable std::mutex mutex;
+    LruCache<OptimizedMatmulPlanKey, OptimizedMatmulPlan> plans;
+    size_t hits{0};
+    size_t misses{0};
+};
+
+} // namespace CatlassKernel::Plan
+
+#endif // SHARED_LIB_PLAN_OPTIMIZED_MATMUL_PLAN_HPP
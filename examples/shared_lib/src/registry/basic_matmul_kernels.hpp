@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_REGISTRY_BASIC_MATMUL_KERNELS_HPP
+#define SHARED_LIB_REGISTRY_BASIC_MATMUL_KERNELS_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#include "registry/kernel_registry.hpp"
+#include "tuning/basic_matmul_configs.hpp"
+
+namespace CatlassKernel::Registry {
+
+inline std::string LayoutSuffix(bool transA, bool transB)
+{
+    return std::string("_") + (transA ? "t" : "n") + (transB ? "t" : "n");
+}
+
+/// Register the BasicMatmul instantiations of one dtype. LauncherTable provides the launcher of each kernel:
+///   Default(transA, transB): pingpong policy with the default tile, covers every shape;
+///   Preload(transA, transB): preload policy with shuffled K, preferred for large square problems;
+///   Config(idx):             pingpong policy with Tuning::BASIC_MATMUL_CONFIGS[idx], row major only.
+/// A configuration whose M (N) tile is no larger than the small M (skinny N) bound is preferred for that
+/// shape class, the others are only reachable by name.
+template <class Launcher, class LauncherTable>
+void RegisterBasicMatmulKernels(KernelRegistry<Launcher> &registry, uint32_t dtype, LauncherTable const &table)
+{
+    const std::string op = Tuning::BASIC_MATMUL_OP_NAME;
+    for (uint32_t layoutIdx = 0; layoutIdx < 4; ++layoutIdx) {
+        bool transA = (layoutIdx & 0b10) != 0;
+        bool transB = (layoutIdx & 0b01) != 0;
+        std::string suffix = LayoutSuffix(transA, transB);
+        registry.Register(KernelSpec{op + "_default" + suffix, op, dtype, transA, transB, {ShapeClass::GENERAL}, 0},
+            table.Default(transA, transB));
+        registry.Register(KernelSpec{op + "_preload" + suffix, op, dtype, transA, transB,
+            {ShapeClass::LARGE_SQUARE}, 1}, table.Preload(transA, transB));
+    }
+    for (size_t i = 0; i < Tuning::BASIC_MATMUL_CONFIG_NUM; ++i) {
+        Tuning::TileConfig const &config = Tuning::BASIC_MATMUL_CONFIGS[i];
+        KernelSpec spec{Tuning::TileConfigKernelName(op, config), op, dtype, false, false, {}, 1};
+        if (config.l1M <= SMALL_M_MAX) {
+            spec.shapeClasses.push_back(ShapeClass::SMALL_M);
+        }
+        if (config.l1N <= SKINNY_N_MAX) {
+            spec.shapeClasses.push_back(ShapeClass::SKINNY_N);
+        }
+        registry.Register(spec, table.Config(i));
+    }
+}
+
+} // namespace CatlassKernel::Registry
+
+#endif // SHARED_LIB_REGISTRY_BASIC_MATMUL_KERNELS_HPP
@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_REGISTRY_KERNEL_REGISTRY_HPP
+#define SHARED_LIB_REGISTRY_KERNEL_REGISTRY_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace CatlassKernel::Registry {
+
+enum class ShapeClass : uint32_t {
+    GENERAL = 0,
+    SMALL_M,
+    SKINNY_N,
+    LARGE_SQUARE,
+};
+
+constexpr uint32_t SMALL_M_MAX = 64;
+constexpr uint32_t SKINNY_N_MAX = 64;
+constexpr uint32_t LARGE_SQUARE_MIN = 2048;
+constexpr uint32_t LARGE_SQUARE_MAX_RATIO = 2;
+
+/// Classify a problem by the edges that decide its tiling. Small M takes precedence over skinny N,
+/// since a problem that is small on both edges is bounded by the M loop.
+inline ShapeClass ClassifyShape(uint32_t m, uint32_t n, uint32_t k)
+{
+    (void)k;
+    if (m <= SMALL_M_MAX) {
+        return ShapeClass::SMALL_M;
+    }
+    if (n <= SKINNY_N_MAX) {
+        return ShapeClass::SKINNY_N;
+    }
+    uint32_t minEdge = std::min(m, n);
+    uint32_t maxEdge = std::max(m, n);
+    if (minEdge >= LARGE_SQUARE_MIN && maxEdge <= static_cast<uint64_t>(minEdge) * LARGE_SQUARE_MAX_RATIO) {
+        return ShapeClass::LARGE_SQUARE;
+    }
+    return ShapeClass::GENERAL;
+}
+
+struct KernelQuery {
+    std::string op;
+    uint32_t dtype{0};
+    bool transA{false};
+    bool transB{false};
+    uint32_t m{1};
+    uint32_t n{1};
+    uint32_t k{1};
+};
+
+/// Static description of one precompiled instantiation. A kernel without shape classes is never
+/// picked automatically, it can only be chosen by name (override or tuning record).
+struct KernelSpec {
+    std::string name;
+    std::string op;
+    uint32_t dtype{0};
+    bool transA{false};
+    bool transB{false};
+    std::vector<ShapeClass> shapeClasses;
+    int32_t priority{0};
+
+    bool Accepts(KernelQuery const &query) const
+    {
+        return op == query.op && dtype == query.dtype && transA == query.transA && transB == query.transB;
+    }
+
+    bool Covers(ShapeClass shapeClass) const
+    {
+        return std::find(shapeClasses.begin(), shapeClasses.end(), shapeClass) != shapeClasses.end();
+    }
+};
+
+/// Table of precompiled kernels per op. Selection order for a query:
+///   1. the override set for the op, if it accepts the dtype and layouts of the query;
+///   2. the preferred kernel passed by the caller (e.g. from the tuning database), under the same condition;
+///   3. the highest priority kernel covering the shape class of the query;
+///   4. the highest priority kernel covering ShapeClass::GENERAL.
+/// Ties are resolved by registration order.
+template <class Launcher>
+class KernelRegistry {
+public:
+    struct Entry {
+        KernelSpec spec;
+        Launcher launcher;
+    };
+
+    /// Returns false if a kernel with the same name is already registered.
+    bool Register(KernelSpec const &spec, Launcher launcher)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (FindByName(spec.name) != nullptr) {
+            return false;
+        }
+        entries.push_back(Entry{spec, launcher});
+        return true;
+    }
+
+    /// The returned entry stays valid until Clear.
+    Entry const *Select(KernelQuery const &query, std::string const &preferred = "") const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = overrides.find(query.op);
+        if (it != overrides.end()) {
+            Entry const *entry = FindByName(it->second);
+            if (entry != nullptr && entry->spec.Accepts(query)) {
+                return entry;
+            }
+        }
+        if (!preferred.empty()) {
+            Entry const *entry = FindByName(preferred);
+            if (entry != nullptr && entry->spec.Accepts(query)) {
+                return entry;
+            }
+        }
+        Entry const *entry = SelectByShapeClass(query, ClassifyShape(query.m, query.n, query.k));
+        if (entry == nullptr) {
+            entry = SelectByShapeClass(query, ShapeClass::GENERAL);
+        }
+        return entry;
+    }
+
+    std::string Query(KernelQuery const &query, std::string const &preferred = "") const
+    {
+        Entry const *entry = Select(query, preferred);
+        return (entry == nullptr) ? std::string() : entry->spec.name;
+    }
+
+    std::vector<KernelSpec> List(std::string const &op) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        std::vector<KernelSpec> specs;
+        for (auto const &entry : entries) {
+            if (entry.spec.op == op) {
+                specs.push_back(entry.spec);
+            }
+        }
+        return specs;
+    }
+
+    /// Force the named kernel for its op. Returns false if no such kernel is registered.
+    bool SetOverride(std::string const &name)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        Entry const *entry = FindByName(name);
+        if (entry == nullptr) {
+            return false;
+        }
+        overrides[entry->spec.op] = name;
+        return true;
+    }
+
+    void ClearOverride(std::string const &op)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        overrides.erase(op);
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        entries.clear();
+        overrides.clear();
+    }
+
+private:
+    Entry const *FindByName(std::string const &name) const
+    {
+        for (auto const &entry : entries) {
+            if (entry.spec.name == name) {
+                return &entry;
+            }
+        }
+        return nullptr;
+    }
+
+    Entry const *SelectByShapeClass(KernelQuery const &query, ShapeClass shapeClass) const
+    {
+        Entry const *best = nullptr;
+        for (auto const &entry : entries) {
+            if (!entry.spec.Accepts(query) || !entry.spec.Covers(shapeClass)) {
+                continue;
+            }
+            if (best == nullptr || entry.spec.priority > best->spec.priority) {
+                best = &entry;
+            }
+        }
+        return best;
+    }
+
+    mutable std::mutex mutex;
+    // std::deque keeps the entries in place when registering more kernels.
+    std::deque<Entry> entries;
+    std::map<std::string, std::string> overrides;
+};
+
+} // namespace CatlassKernel::Registry
+
+#endif // SHARED_LIB_REGISTRY_KERNEL_REGISTRY_HPP
@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_TUNING_AUTOTUNER_HPP
+#define SHARED_LIB_TUNING_AUTOTUNER_HPP
+
+#include <functional>
+#include <optional>
+#include <vector>
+
+#include "tuning/tile_config.hpp"
+#include "tuning/tuning_db.hpp"
+
+namespace CatlassKernel::Tuning {
+
+/// Runs one candidate and returns its time in microseconds. A negative value marks a failed run.
+using MeasureFunc = std::function<double(TileConfig const &)>;
+
+/// Benchmark every candidate and return the fastest one. Candidates that fail are skipped.
+inline std::optional<TuningRecord> Tune(std::vector<TileConfig> const &candidates, MeasureFunc const &measure)
+{
+    std::optional<TuningRecord> best;
+    for (auto const &config : candidates) {
+        double timeUs = measure(config);
+        if (timeUs < 0) {
+            continue;
+        }
+        if (!best.has_value() || timeUs < best->timeUs) {
+            best = TuningRecord{config, timeUs};
+        }
+    }
+    return best;
+}
+
+/// Tune the candidates and store the winner under the key.
+inline std::optional<TuningRecord> TuneAndRecord(TuningDatabase &database, TuningKey const &key,
+    std::vector<TileConfig> const &candidates, MeasureFunc const &measure)
+{
+    auto best = Tune(candidates, measure);
+    if (best.has_value()) {
+        database.Update(key, *best);
+    }
+    return best;
+}
+
+} // namespace CatlassKernel::Tuning
+
+#endif // SHARED_LIB_TUNING_AUTOTUNER_HPP
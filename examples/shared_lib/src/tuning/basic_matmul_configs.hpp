@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_TUNING_BASIC_MATMUL_CONFIGS_HPP
+#define SHARED_LIB_TUNING_BASIC_MATMUL_CONFIGS_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+#include "tuning/tile_config.hpp"
+
+namespace CatlassKernel::Tuning {
+
+constexpr const char *BASIC_MATMUL_OP_NAME = "basic_matmul";
+
+// Configurations of BasicMatmul with a precompiled instantiation, each one is a kernel in the shared library.
+// Entry 0 and 1 are the untuned defaults.
+constexpr TileConfig BASIC_MATMUL_CONFIGS[] = {
+    {128, 256, 256, 64, 2, 3, 0},
+    {128, 256, 256, 64, 2, 3, 1},
+    {256, 128, 256, 64, 2, 3, 0},
+    {256, 128, 256, 64, 2, 3, 1},
+    {128, 128, 256, 64, 2, 3, 0},
+    {128, 128, 256, 64, 2, 3, 1},
+    {64, 256, 256, 64, 2, 3, 1},
+    {128, 128, 512, 128, 2, 3, 0},
+    {128, 128, 512, 128, 2, 3, 1},
+    {256, 64, 256, 64, 2, 3, 0},
+};
+
+constexpr size_t BASIC_MATMUL_CONFIG_NUM = sizeof(BASIC_MATMUL_CONFIGS) / sizeof(BASIC_MATMUL_CONFIGS[0]);
+
+constexpr bool AllBasicMatmulConfigsValid()
+{
+    for (size_t i = 0; i < BASIC_MATMUL_CONFIG_NUM; ++i) {
+        if (!IsValidTileConfig(BASIC_MATMUL_CONFIGS[i], sizeof(uint16_t), sizeof(float))) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(AllBasicMatmulConfigsValid(), "BasicMatmul configuration exceeds the BlockMmad budget!");
+
+/// Default configuration of the untuned dispatch, the swizzle direction follows the longer edge.
+inline TileConfig DefaultBasicMatmulConfig(uint32_t m, uint32_t n)
+{
+    return (m > n) ? BASIC_MATMUL_CONFIGS[0] : BASIC_MATMUL_CONFIGS[1];
+}
+
+} // namespace CatlassKernel::Tuning
+
+#endif // SHARED_LIB_TUNING_BASIC_MATMUL_CONFIGS_HPP
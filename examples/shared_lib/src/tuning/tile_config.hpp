@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_TUNING_TILE_CONFIG_HPP
+#define SHARED_LIB_TUNING_TILE_CONFIG_HPP
+
+#include <cstdint>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "catlass/detail/constants.hpp"
+
+namespace CatlassKernel::Tuning {
+
+// Buffer sizes of Catlass::Arch::AtlasA2. The tuning code is pure host code, so the values are
+// mirrored here instead of including the device headers.
+struct ArchBudget {
+    uint32_t l1Size = 512 * 1024;
+    uint32_t l0ASize = 64 * 1024;
+    uint32_t l0BSize = 64 * 1024;
+    uint32_t l0CSize = 128 * 1024;
+};
+
+using Catlass::BYTE_PER_C0;
+using Catlass::C0_NUM_PER_FRACTAL;
+
+struct TileConfig {
+    uint32_t l1M{128};
+    uint32_t l1N{256};
+    uint32_t l1K{256};
+    uint32_t l0K{64};
+    uint32_t stages{2};
+    uint32_t swizzleOffset{3};
+    uint32_t swizzleDirection{0};
+
+    auto Tie() const
+    {
+        return std::tie(l1M, l1N, l1K, l0K, stages, swizzleOffset, swizzleDirection);
+    }
+
+    bool operator==(TileConfig const &other) const
+    {
+        return Tie() == other.Tie();
+    }
+
+    bool operator!=(TileConfig const &other) const
+    {
+        return !(*this == other);
+    }
+
+    bool operator<(TileConfig const &other) const
+    {
+        return Tie() < other.Tie();
+    }
+};
+
+/// Host mirror of the static checks in BlockMmad (pingpong/preload policies): L1 and L0 tiles of
+/// every stage must fit their buffers, L0 shares M and N with L1, and all edges are fractal aligned.
+constexpr bool IsValidTileConfig(TileConfig const &config, uint32_t elementBytes, uint32_t accumulatorBytes,
+    ArchBudget const &budget = ArchBudget{})
+{
+    if (elementBytes == 0 || accumulatorBytes == 0 || config.stages == 0 || config.l0K == 0) {
+        return false;
+    }
+    uint32_t kAlign = BYTE_PER_C0 / elementBytes;
+    if ((config.l1M % C0_NUM_PER_FRACTAL != 0) || (config.l1N % C0_NUM_PER_FRACTAL != 0) ||
+        (config.l1M == 0) || (config.l1N == 0)) {
+        return false;
+    }
+    if ((config.l1K % kAlign != 0) || (config.l0K % kAlign != 0) || (config.l1K % config.l0K != 0)) {
+        return false;
+    }
+    if (config.swizzleOffset == 0 || config.swizzleDirection > 1) {
+        return false;
+    }
+
+    uint64_t l1Bytes = (static_cast<uint64_t>(config.l1M) * config.l1K +
+        static_cast<uint64_t>(config.l1K) * config.l1N) * elementBytes * config.stages;
+    uint64_t l0ABytes = static_cast<uint64_t>(config.l1M) * config.l0K * elementBytes * config.stages;
+    uint64_t l0BBytes = static_cast<uint64_t>(config.l0K) * config.l1N * elementBytes * config.stages;
+    uint64_t l0CBytes = static_cast<uint64_t>(config.l1M) * config.l1N * accumulatorBytes;
+    return (l1Bytes <= budget.l1Size) && (l0ABytes <= budget.l0ASize) &&
+        (l0BBytes <= budget.l0BSize) && (l0CBytes <= budget.l0CSize);
+}
+
+/// Kernel name of a configuration of the op, e.g. "basic_matmul_128x256x256_64_s3d0".
+inline std::string TileConfigKernelName(std::string const &op, TileConfig const &config)
+{
+    return op + "_" + std::to_string(config.l1M) + "x" + std::to_string(config.l1N) + "x" +
+        std::to_string(config.l1K) + "_" + std::to_string(config.l0K) + "_s" +
+        std::to_string(config.swizzleOffset) + "d" + std::to_string(config.swizzleDirection);
+}
+
+/// Enumerate every tile, stage and swizzle combination that passes IsValidTileConfig.
+inline std::vector<TileConfig> EnumerateTileConfigs(uint32_t elementBytes, uint32_t accumulatorBytes,
+    ArchBudget const &budget = ArchBudget{}, std::vector<uint32_t> const &stagesList = {2})
+{
+    static const uint32_t MN_CANDIDATES[] = {16, 32, 64, 128, 256};
+    static const uint32_t K_CANDIDATES[] = {32, 64, 128, 256, 512};
+    static const uint32_t SWIZZLE_OFFSET_CANDIDATES[] = {1, 3};
+
+    std::vector<TileConfig> configs;
+    for (uint32_t stages : stagesList) {
+        for (uint32_t l1M : MN_CANDIDATES) {
+            for (uint32_t l1N : MN_CANDIDATES) {
+                for (uint32_t l1K : K_CANDIDATES) {
+                    for (uint32_t l0K : K_CANDIDATES) {
+                        for (uint32_t swizzleOffset : SWIZZLE_OFFSET_CANDIDATES) {
+                            for (uint32_t swizzleDirection = 0; swizzleDirection < 2; ++swizzleDirection) {
+                                TileConfig config{l1M, l1N, l1K, l0K, stages, swizzleOffset, swizzleDirection};
+                                if (IsValidTileConfig(config, elementBytes, accumulatorBytes, budget)) {
+                                    configs.push_back(config);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    }
+    return configs;
+}
+
+} // namespace CatlassKernel::Tuning
+
+#endif // SHARED_LIB_TUNING_TILE_CONFIG_HPP
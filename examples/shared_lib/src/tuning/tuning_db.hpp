@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef SHARED_LIB_TUNING_TUNING_DB_HPP
+#define SHARED_LIB_TUNING_TUNING_DB_HPP
+
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <tuple>
+
+#include "tuning/tile_config.hpp"
+
+namespace CatlassKernel::Tuning {
+
+/// Round a problem dimension up to its power of two bucket, so that shapes which tile the same way share a record.
+inline uint32_t ShapeBucket(uint32_t dim)
+{
+    constexpr uint32_t MIN_BUCKET = 16;
+    uint32_t bucket = MIN_BUCKET;
+    while (bucket < dim && bucket < (1U << 31)) {
+        bucket <<= 1;
+    }
+    return bucket;
+}
+
+struct TuningKey {
+    std::string op;
+    uint32_t dtype{0};
+    bool transA{false};
+    bool transB{false};
+    uint32_t mBucket{0};
+    uint32_t nBucket{0};
+    uint32_t kBucket{0};
+
+    auto Tie() const
+    {
+        return std::tie(op, dtype, transA, transB, mBucket, nBucket, kBucket);
+    }
+
+    bool operator<(TuningKey const &other) const
+    {
+        return Tie() < other.Tie();
+    }
+
+    bool operator==(TuningKey const &other) const
+    {
+        return Tie() == other.Tie();
+    }
+};
+
+inline TuningKey MakeTuningKey(std::string const &op, uint32_t dtype, bool transA, bool transB,
+    uint32_t m, uint32_t n, uint32_t k)
+{
+    return TuningKey{op, dtype, transA, transB, ShapeBucket(m), ShapeBucket(n), ShapeBucket(k)};
+}
+
+struct TuningRecord {
+    TileConfig config;
+    double timeUs{0.0};
+};
+
+/// Persistent table of the fastest configuration per shape bucket.
+/// File format (text, one record per line, '#' starts a comment):
+///   catlass_tuning_db <version>
+///   <op> <dtype> <transA> <transB> <mBucket> <nBucket> <kBucket>
+///       <l1M> <l1N> <l1K> <l0K> <stages> <swizzleOffset> <swizzleDirection> <timeUs>
+/// A file with a different version is ignored as a whole, since its configurations may refer to
+/// kernels that no longer exist.
+class TuningDatabase {
+public:
+    static constexpr uint32_t VERSION = 1;
+    static constexpr const char *MAGIC = "catlass_tuning_db";
+
+    bool Load(std::string const &path)
+    {
+        std::ifstream file(path);
+        if (!file.is_open()) {
+            return false;
+        }
+        std::string magic;
+        uint32_t version = 0;
+        if (!(file >> magic >> version) || magic != MAGIC || version != VERSION) {
+            return false;
+        }
+
+        std::map<TuningKey, TuningRecord> loaded;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#') {
+                continue;
+            }
+            std::istringstream stream(line);
+            TuningKey key;
+            TuningRecord record;
+            TileConfig &config = record.config;
+            if (!(stream >> key.op >> key.dtype >> key.transA >> key.transB >>
+                key.mBucket >> key.nBucket >> key.kBucket >>
+                config.l1M >> config.l1N >> config.l1K >> config.l0K >> config.stages >>
+                config.swizzleOffset >> config.swizzleDirection >> record.timeUs)) {
+                return false;
+            }
+            loaded[key] = record;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto const &item : loaded) {
+            records[item.first] = item.second;
+        }
+        return true;
+    }
+
+    bool Save(std::string const &path) const
+    {
+        std::ofstream file(path, std::ios::trunc);
+        if (!file.is_open()) {
+            return false;
+        }
+        file << MAGIC << " " << VERSION << "\n";
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto const &item : records) {
+            TuningKey const &key = item.first;
+            TileConfig const &config = item.second.config;
+            file << key.op << " " << key.dtype << " " << key.transA << " " << key.transB << " " <<
+                key.mBucket << " " << key.nBucket << " " << key.kBucket << " " <<
+                config.l1M << " " << config.l1N << " " << config.l1K << " " << config.l0K << " " <<
+                config.stages << " " << config.swizzleOffset << " " << config.swizzleDirection << " " <<
+                item.second.timeUs << "\n";
+        }
+        return static_cast<bool>(file);
+    }
+
+    std::optional<TuningRecord> Find(TuningKey const &key) const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = records.find(key);
+        if (it == records.end()) {
+            return std::nullopt;
+        }
+        return it->second;
+    }
+
+    /// Insert the record, replacing any stored one. A key covers a bucket of shapes, so the times of two records
+    /// may come from different shapes and are not compared; the latest tuning run wins.
+    void Update(TuningKey const &key, TuningRecord const &record)
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        records[key] = record;
+    }
+
+    size_t Size() const
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        return records.size();
+    }
+
+    void Clear()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        records.clear();
+    }
+
+private:
+    mutable std::mutex mutex;
+    std::map<TuningKey, TuningRecord> records;
+};
+
+/// Process wide database used at dispatch time. It is loaded once from the file named by
+/// CATLASS_TUNING_DB_PATH, if the variable is set.
+inline TuningDatabase &GetTuningDatabase()
+{
+    static TuningDatabase database;
+    static std::once_flag loadFlag;
+    std::call_once(loadFlag, []() {
+        const char *path = std::getenv("CATLASS_TUNING_DB_PATH");
+        if (path != nullptr) {
+            database.Load(path);
+        }
+    });
+    return database;
+}
+
+} // namespace CatlassKernel::Tuning
+
+#endif // SHARED_LIB_TUNING_TUNING_DB_HPP
@@ -14,22 +14,23 @@
 #include <kernel_operator.h>
 
 #include "catlass/detail/alignment.hpp"
+#include "catlass/detail/constants.hpp"
 #include "catlass/detail/dependent_false.hpp"
 #include "catlass/detail/macros.hpp"
 
 namespace Catlass {
 
-constexpr uint32_t BYTE_PER_C0 = 32;
-constexpr uint32_t BYTE_PER_C2 = 64;
-constexpr uint32_t C0_NUM_PER_FRACTAL = 16;
-constexpr uint32_t BYTE_PER_FRACTAL = BYTE_PER_C0 * C0_NUM_PER_FRACTAL;
-
-constexpr uint32_t BYTE_PER_BLK = 32;
-constexpr uint32_t BLK_NUM_PER_VECTOR_FRACTAL = 8;
-constexpr uint32_t BYTE_PER_VECTOR_FRACTAL = BYTE_PER_BLK * BLK_NUM_PER_VECTOR_FRACTAL;
-
-constexpr uint64_t L2_OFFSET = 0;
-constexpr uint32_t STRIDE_LIMIT = 65536;
+/// Number of bits an element occupies in memory. int4b_t is packed two per byte, so sizeof does not give its
+/// element count per C0 or per fractal.
+template <class Element>
+struct SizeOfBits {
+    static constexpr uint32_t VALUE = sizeof(Element) * 8;
+};
+
+template <>
+struct SizeOfBits<AscendC::int4b_t> {
+    static constexpr uint32_t VALUE = 4;
+};
 
 }  // namespace Catlass
 
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_DETAIL_CONSTANTS_HPP
+#define CATLASS_DETAIL_CONSTANTS_HPP
+
+#include <cstdint>
+
+// Hardware constants without any device dependency, so host code (tiling, packing, cost models) can include them.
+namespace Catlass {
+
+constexpr uint32_t BYTE_PER_C0 = 32;
+constexpr uint32_t BYTE_PER_C2 = 64;
+constexpr uint32_t C0_NUM_PER_FRACTAL = 16;
+constexpr uint32_t BYTE_PER_FRACTAL = BYTE_PER_C0 * C0_NUM_PER_FRACTAL;
+
+constexpr uint32_t BYTE_PER_BLK = 32;
+constexpr uint32_t BLK_NUM_PER_VECTOR_FRACTAL = 8;
+constexpr uint32_t BYTE_PER_VECTOR_FRACTAL = BYTE_PER_BLK * BLK_NUM_PER_VECTOR_FRACTAL;
+
+constexpr uint64_t L2_OFFSET = 0;
+constexpr uint32_t STRIDE_LIMIT = 65536;
+
+}  // namespace Catlass
+
+#endif  // CATLASS_DETAIL_CONSTANTS_HPP
@@ -32,6 +32,11 @@ class BlockEpilogue {
 #include "catlass/epilogue/block/block_epilogue_mla_rescale_o.hpp"
 #include "catlass/epilogue/block/block_epilogue_mla_fd_rescale_o.hpp"
 #include "catlass/epilogue/block/block_epilogue_per_token_dequant.hpp"
+#include "catlass/epilogue/block/block_epilogue_per_group_dequant.hpp"
+#include "catlass/epilogue/block/block_epilogue_bias_activation.hpp"
+#include "catlass/epilogue/block/block_epilogue_swiglu.hpp"
+#include "catlass/epilogue/block/block_epilogue_visitor.hpp"
+#include "catlass/epilogue/block/block_epilogue_residual_norm.hpp"
 #include "catlass/epilogue/block/block_epilogue_gemm.hpp"
 #include "catlass/epilogue/block/block_epilogue_gemv.hpp"
 #include "catlass/epilogue/block/block_epilogue_mla_tp1_softmax.hpp"
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_BLOCK_EPILOGUE_BIAS_ACTIVATION_HPP
+#define CATLASS_EPILOGUE_BLOCK_EPILOGUE_BIAS_ACTIVATION_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/detail/callback.hpp"
+
+namespace Catlass::Epilogue::Block {
+
+/// D = activation(C + bias), computed in fp32 and cast to the element type of D. C is the fp32 or fp16 result of
+/// the cube in the GM workspace, bias is a vector of n elements broadcast to every row (skipped if ptrBias is null).
+template <
+    uint32_t UB_STAGES_,
+    class CType_,
+    class BiasType_,
+    class DType_,
+    class TileRowBroadcastAdd_,
+    class TileActivation_,
+    class TileCopy_,
+    class EpilogueTileSwizzle_
+>
+class BlockEpilogue <
+    EpilogueAtlasA2BiasActivation<UB_STAGES_>,
+    CType_,
+    BiasType_,
+    DType_,
+    TileRowBroadcastAdd_,
+    TileActivation_,
+    TileCopy_,
+    EpilogueTileSwizzle_
+> {
+public:
+    using DispatchPolicy = EpilogueAtlasA2BiasActivation<UB_STAGES_>;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    static constexpr uint32_t UB_STAGES = UB_STAGES_;
+
+    // Data infos
+    using ElementC = typename CType_::Element;
+    using LayoutC = typename CType_::Layout;
+    using ElementBias = typename BiasType_::Element;
+    using LayoutBias = typename BiasType_::Layout;
+    using ElementD = typename DType_::Element;
+    using LayoutD = typename DType_::Layout;
+
+    // Check data infos
+    static_assert(
+        (std::is_same_v<ElementC, float> || std::is_same_v<ElementC, half>) &&
+            (std::is_same_v<ElementD, half> || std::is_same_v<ElementD, bfloat16_t>) &&
+            std::is_same_v<ElementBias, ElementD>,
+        "The element type template parameters of BlockEpilogue are wrong"
+    );
+    static_assert(
+        std::is_same_v<LayoutC, layout::RowMajor> && std::is_same_v<LayoutBias, layout::VectorLayout> &&
+            std::is_same_v<LayoutD, layout::RowMajor>,
+        "The layout template parameters of BlockEpilogue are wrong"
+    );
+
+    // Tile compute ops
+    using TileRowBroadcastAdd = TileRowBroadcastAdd_;
+    using TileActivation = TileActivation_;
+
+    // Tile copy
+    using CopyGmToUbC = typename TileCopy_::CopyGmToUbC;
+    using CopyGmToUbBias = typename TileCopy_::CopyGmToUbX;
+    using CopyUbToGmD = typename TileCopy_::CopyUbToGmD;
+
+    using EpilogueTileSwizzle = EpilogueTileSwizzle_;
+
+    using TileShape = typename TileRowBroadcastAdd::TileShape;
+
+    static_assert(std::is_same_v<TileShape, typename TileActivation::TileShape>,
+        "TileShape must be consistent for all tile compute ops");
+
+    static constexpr bool CAST_C = !std::is_same_v<ElementC, float>;
+
+    static_assert(
+        (UB_STAGES * (TileShape::COUNT * sizeof(ElementC) + TileShape::COLUMN * sizeof(ElementBias)
+                + TileShape::COUNT * sizeof(ElementD))
+            + ((CAST_C ? TileShape::COUNT : 0) + TileShape::COLUMN + TileShape::COUNT) * sizeof(float))
+        <= ArchTag::UB_SIZE,
+        "TileShape is too large to fit in UB"
+    );
+
+    struct Params {
+        __gm__ ElementBias *ptrBias{nullptr};
+        LayoutBias layoutBias{};
+        __gm__ ElementD *ptrD{nullptr};
+        LayoutD layoutD{};
+
+        CATLASS_HOST_DEVICE
+        Params() {};
+
+        CATLASS_HOST_DEVICE
+        Params(
+            __gm__ ElementBias *ptrBias_, LayoutBias const &layoutBias_,
+            __gm__ ElementD *ptrD_, LayoutD const &layoutD_
+        ) : ptrBias(ptrBias_), layoutBias(layoutBias_), ptrD(ptrD_), layoutD(layoutD_) {}
+    };
+
+    CATLASS_DEVICE
+    BlockEpilogue(Arch::Resource<ArchTag> const &resource, Params const &params = Params{}) : params(params)
+    {
+        size_t ubOffset = 0;
+        int32_t eventVMTE2 = 0;
+        int32_t eventMTE2V = 0;
+        int32_t eventMTE3V = 0;
+        int32_t eventVMTE3 = 0;
+        for (uint32_t i = 0; i < UB_STAGES; ++i) {
+            ubCList[i] = resource.ubBuf.template GetBufferByByte<ElementC>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(ElementC);
+            ubBiasList[i] = resource.ubBuf.template GetBufferByByte<ElementBias>(ubOffset);
+            ubOffset += TileShape::COLUMN * sizeof(ElementBias);
+            ubDList[i] = resource.ubBuf.template GetBufferByByte<ElementD>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(ElementD);
+
+            eventUbCVMTE2List[i] = eventVMTE2++;
+            eventUbCMTE2VList[i] = eventMTE2V++;
+            eventUbBiasVMTE2List[i] = eventVMTE2++;
+            eventUbBiasMTE2VList[i] = eventMTE2V++;
+            eventUbDMTE3VList[i] = eventMTE3V++;
+            eventUbDVMTE3List[i] = eventVMTE3++;
+
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[i]);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbBiasVMTE2List[i]);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[i]);
+        }
+        if constexpr (CAST_C) {
+            ubCFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(float);
+        }
+        ubBiasFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COLUMN * sizeof(float);
+        ubTmp = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COUNT * sizeof(float);
+    }
+
+    CATLASS_DEVICE
+    ~BlockEpilogue()
+    {
+        for (uint32_t i = 0; i < UB_STAGES; ++i) {
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[i]);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventUbBiasVMTE2List[i]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[i]);
+        }
+    }
+
+    CATLASS_DEVICE
+    void UpdateParams(Params const &params_)
+    {
+        params = params_;
+    }
+
+    CATLASS_DEVICE
+    void operator() (
+        GemmCoord const &blockShapeMNK,
+        GemmCoord const &blockCoordMNK,
+        GemmCoord const &actualBlockShapeMNK,
+        AscendC::GlobalTensor<ElementC> const &gmBlockC,
+        LayoutC const &layoutBlockC, Callback &&callback = Callback{}
+    )
+    {
+        if (actualBlockShapeMNK.k() == 0) {
+            return;
+        }
+        callback();
+
+        // Calculate the offset of the current block
+        MatrixCoord blockShape = blockShapeMNK.GetCoordMN();
+        MatrixCoord blockCoord = blockCoordMNK.GetCoordMN();
+        MatrixCoord actualBlockShape = actualBlockShapeMNK.GetCoordMN();
+        MatrixCoord blockOffset = blockCoord * blockShape;
+
+        AscendC::GlobalTensor<ElementBias> gmBias;
+        gmBias.SetGlobalBuffer(params.ptrBias);
+        AscendC::GlobalTensor<ElementD> gmD;
+        gmD.SetGlobalBuffer(params.ptrD);
+        bool hasBias = (params.ptrBias != nullptr);
+
+        auto ubTileStride = MakeCoord(static_cast<int64_t>(TileShape::COLUMN), 1L);
+        auto tileShape = TileShape::ToCoord();
+        EpilogueTileSwizzle epilogueTileSwizzle(actualBlockShape, tileShape);
+        uint32_t tileLoops = epilogueTileSwizzle.GetLoops();
+        uint32_t subblockIdx = AscendC::GetSubBlockIdx();
+        uint32_t subblockNum = AscendC::GetSubBlockNum();
+        for (uint32_t loopIdx = subblockIdx; loopIdx < tileLoops; loopIdx += subblockNum) {
+            auto tileCoord = epilogueTileSwizzle.GetTileCoord(loopIdx);
+            auto actualTileShape = epilogueTileSwizzle.GetActualTileShape(tileCoord);
+            auto tileOffsetInBlock = tileCoord * tileShape;
+            auto tileOffset = blockOffset + tileOffsetInBlock;
+
+            auto gmTileC = gmBlockC[layoutBlockC.GetOffset(tileOffsetInBlock)];
+            auto layoutGmTileC = layoutBlockC.GetTileLayout(actualTileShape);
+
+            auto &ubC = ubCList[ubListId];
+            LayoutC layoutUbC{actualTileShape, ubTileStride};
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[ubListId]);
+            copyGmToUbC(ubC, gmTileC, layoutUbC, layoutGmTileC);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventUbCMTE2VList[ubListId]);
+
+            auto &ubBias = ubBiasList[ubListId];
+            if (hasBias) {
+                auto biasTileOffset = tileOffset.template GetCoordByAxis<1>();
+                auto biasTileShape = actualTileShape.template GetCoordByAxis<1>();
+
+                auto gmTileBias = gmBias[params.layoutBias.GetOffset(biasTileOffset)];
+                auto layoutGmTileBias = params.layoutBias.GetTileLayout(biasTileShape);
+                auto layoutUbBias = LayoutBias::template MakeLayoutInUb<ElementBias>(biasTileShape);
+
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventUbBiasVMTE2List[ubListId]);
+                copyGmToUbBias(ubBias, gmTileBias, layoutUbBias, layoutGmTileBias);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventUbBiasMTE2VList[ubListId]);
+            }
+
+            // The fp32 C the bias and the activation are applied to. An fp32 C is updated in place in its stage
+            // buffer, which is then released after the output cast.
+            AscendC::LocalTensor<float> ubCompute;
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventUbCMTE2VList[ubListId]);
+            if constexpr (CAST_C) {
+                AscendC::Cast(ubCFp32, ubC, AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[ubListId]);
+                ubCompute = ubCFp32;
+            } else {
+                ubCompute = ubC;
+            }
+
+            if (hasBias) {
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventUbBiasMTE2VList[ubListId]);
+                AscendC::Cast(ubBiasFp32, ubBias, AscendC::RoundMode::CAST_NONE, TileShape::COLUMN);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbBiasVMTE2List[ubListId]);
+                AscendC::PipeBarrier<PIPE_V>();
+                tileRowBroadcastAdd(ubCompute, ubCompute, ubBiasFp32);
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            tileActivation(ubCompute, ubCompute, ubTmp);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            auto &ubD = ubDList[ubListId];
+            LayoutD layoutUbD{actualTileShape, ubTileStride};
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[ubListId]);
+            AscendC::Cast(ubD, ubCompute, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventUbDVMTE3List[ubListId]);
+            if constexpr (!CAST_C) {
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[ubListId]);
+            }
+
+            auto gmTileD = gmD[params.layoutD.GetOffset(tileOffset)];
+            auto layoutGmTileD = params.layoutD.GetTileLayout(actualTileShape);
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventUbDVMTE3List[ubListId]);
+            copyUbToGmD(gmTileD, ubD, layoutGmTileD, layoutUbD);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[ubListId]);
+
+            ubListId = (ubListId + 1 < UB_STAGES) ? (ubListId + 1) : 0;
+        }
+    }
+
+private:
+    Params params;
+
+    AscendC::LocalTensor<ElementC> ubCList[UB_STAGES];
+    AscendC::LocalTensor<ElementBias> ubBiasList[UB_STAGES];
+    AscendC::LocalTensor<ElementD> ubDList[UB_STAGES];
+
+    int32_t eventUbCVMTE2List[UB_STAGES];
+    int32_t eventUbCMTE2VList[UB_STAGES];
+    int32_t eventUbBiasVMTE2List[UB_STAGES];
+    int32_t eventUbBiasMTE2VList[UB_STAGES];
+    int32_t eventUbDMTE3VList[UB_STAGES];
+    int32_t eventUbDVMTE3List[UB_STAGES];
+
+    uint32_t ubListId{0};
+
+    AscendC::LocalTensor<float> ubCFp32;
+    AscendC::LocalTensor<float> ubBiasFp32;
+    AscendC::LocalTensor<float> ubTmp;
+
+    TileRowBroadcastAdd tileRowBroadcastAdd;
+    TileActivation tileActivation;
+
+    CopyGmToUbC copyGmToUbC;
+    CopyGmToUbBias copyGmToUbBias;
+    CopyUbToGmD copyUbToGmD;
+};
+
+}  // namespace Catlass::Epilogue::Block
+
+#endif  // CATLASS_EPILOGUE_BLOCK_EPILOGUE_BIAS_ACTIVATION_HPP
@@ -0,0 +1,585 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_BLOCK_EPILOGUE_RESIDUAL_NORM_HPP
+#define CATLASS_EPILOGUE_BLOCK_EPILOGUE_RESIDUAL_NORM_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/epilogue/tile/copy_gm_to_ub.hpp"
+#include "catlass/epilogue/tile/copy_ub_to_gm.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_add.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_mul.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_one_blk.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/detail/callback.hpp"
+
+namespace Catlass::Epilogue::Block {
+
+/// S = C + residual and D = gamma * norm(S) (+ beta), where norm is RMSNorm or LayerNorm over the n columns of a
+/// row. Both S and D are written, S being the residual stream of the next layer. The statistics are accumulated in
+/// fp32 and the variance of LayerNorm is always computed from the centered values, so both paths below follow the
+/// same numerical contract:
+///   RMSNorm:   D = gamma * S / sqrt(sum(S^2) / n + eps)
+///   LayerNorm: D = gamma * (S - mean) / sqrt(sum((S - mean)^2) / n + eps) + beta
+/// If a cube block holds full rows (n <= TileShape::COLUMN), every tile is normalized in UB right after the
+/// residual add. Otherwise operator() writes the fp32 S back in place of C in the workspace and atomically adds the
+/// partial row statistics to a row statistics workspace, and the kernel calls AccumulateCenteredSquares (LayerNorm
+/// only) and Normalize after cross core barriers.
+template <
+    bool IS_LAYER_NORM_,
+    class CType_,
+    class ResidualType_,
+    class GammaType_,
+    class DType_,
+    class TileRowReduceSum_,
+    class TileCopy_,
+    class EpilogueTileSwizzle_
+>
+class BlockEpilogue <
+    EpilogueAtlasA2ResidualNorm<IS_LAYER_NORM_>,
+    CType_,
+    ResidualType_,
+    GammaType_,
+    DType_,
+    TileRowReduceSum_,
+    TileCopy_,
+    EpilogueTileSwizzle_
+> {
+public:
+    using DispatchPolicy = EpilogueAtlasA2ResidualNorm<IS_LAYER_NORM_>;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    static constexpr bool IS_LAYER_NORM = IS_LAYER_NORM_;
+
+    // Data infos
+    using ElementC = typename CType_::Element;
+    using LayoutC = typename CType_::Layout;
+    using ElementResidual = typename ResidualType_::Element;
+    using LayoutResidual = typename ResidualType_::Layout;
+    using ElementGamma = typename GammaType_::Element;
+    using LayoutGamma = typename GammaType_::Layout;
+    using ElementD = typename DType_::Element;
+    using LayoutD = typename DType_::Layout;
+
+    // Check data infos
+    static_assert(
+        std::is_same_v<ElementC, float> &&
+            (std::is_same_v<ElementD, half> || std::is_same_v<ElementD, bfloat16_t>) &&
+            std::is_same_v<ElementResidual, ElementD> && std::is_same_v<ElementGamma, ElementD>,
+        "The element type template parameters of BlockEpilogue are wrong"
+    );
+    static_assert(
+        std::is_same_v<LayoutC, layout::RowMajor> && std::is_same_v<LayoutResidual, layout::RowMajor> &&
+            std::is_same_v<LayoutGamma, layout::VectorLayout> && std::is_same_v<LayoutD, layout::RowMajor>,
+        "The layout template parameters of BlockEpilogue are wrong"
+    );
+
+    // Tile compute ops
+    using TileRowReduceSum = TileRowReduceSum_;
+    using TileShape = typename TileRowReduceSum::TileShape;
+    using ComputeType = Gemm::GemmType<float, layout::RowMajor>;
+    using TileRowBroadcastMul = Tile::TileRowBroadcastMul<ArchTag, ComputeType, TileShape>;
+    using TileRowBroadcastAdd = Tile::TileRowBroadcastAdd<ArchTag, ComputeType, TileShape>;
+    using TileOneBlkColumnBroadcastMul = Tile::TileOneBlkColumnBroadcastMul<ArchTag, ComputeType, TileShape>;
+    using TileOneBlkColumnBroadcastAdd = Tile::TileOneBlkColumnBroadcastAdd<ArchTag, ComputeType, TileShape>;
+    using TileBroadcastOneBlk = Tile::TileBroadcastOneBlk<ArchTag, ComputeType, TileShape::ROW>;
+
+    // Tile copy
+    using CopyGmToUbC = typename TileCopy_::CopyGmToUbC;
+    using CopyGmToUbResidual = typename TileCopy_::CopyGmToUbX;
+    using CopyGmToUbGamma = typename TileCopy_::CopyGmToUbY;
+    using CopyUbToGmD = typename TileCopy_::CopyUbToGmD;
+    using CopyUbToGmC = Tile::CopyUb2Gm<ArchTag, CType_>;
+    using CopyGmToUbRowStat = Tile::CopyGm2Ub<ArchTag, Gemm::GemmType<float, layout::VectorLayout>>;
+    using CopyUbToGmRowStat = Tile::CopyUb2Gm<ArchTag, Gemm::GemmType<float, layout::VectorLayout>>;
+
+    using EpilogueTileSwizzle = EpilogueTileSwizzle_;
+
+    // Row statistics in the workspace, ROW_STAT_NUM vectors of m floats
+    static constexpr uint32_t ROW_STAT_SUM = 0;
+    static constexpr uint32_t ROW_STAT_SQUARE_SUM = 1;
+    static constexpr uint32_t ROW_STAT_NUM = 2;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(float);
+    static constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_VECTOR_FRACTAL / sizeof(float);
+
+    static_assert(TileShape::ROW % ELE_NUM_PER_BLK == 0 && TileShape::ROW <= 255,
+        "TileShape::ROW must be a multiple of the floats of one block, and fit one repeat");
+
+    static_assert(
+        TileShape::COUNT * (2 * sizeof(float) + sizeof(ElementResidual) + sizeof(ElementD))
+            + TileRowReduceSum::SCRATCH_COUNT * sizeof(float)
+            + TileShape::COLUMN * 2 * (sizeof(ElementGamma) + sizeof(float))
+            + TileShape::ROW * (5 + 2 * ELE_NUM_PER_BLK) * sizeof(float)
+        <= ArchTag::UB_SIZE,
+        "TileShape is too large to fit in UB"
+    );
+
+    struct Params {
+        __gm__ ElementResidual *ptrResidual{nullptr};
+        LayoutResidual layoutResidual{};
+        __gm__ ElementGamma *ptrGamma{nullptr};
+        // Only read by LayerNorm, which skips beta if it is null
+        __gm__ ElementGamma *ptrBeta{nullptr};
+        LayoutGamma layoutGamma{};
+        // S and D share layoutD
+        __gm__ ElementD *ptrSum{nullptr};
+        __gm__ ElementD *ptrD{nullptr};
+        LayoutD layoutD{};
+        float epsilon{1e-6f};
+
+        CATLASS_HOST_DEVICE
+        Params() {};
+
+        CATLASS_HOST_DEVICE
+        Params(
+            __gm__ ElementResidual *ptrResidual_, LayoutResidual const &layoutResidual_,
+            __gm__ ElementGamma *ptrGamma_, __gm__ ElementGamma *ptrBeta_, LayoutGamma const &layoutGamma_,
+            __gm__ ElementD *ptrSum_, __gm__ ElementD *ptrD_, LayoutD const &layoutD_, float epsilon_
+        ) : ptrResidual(ptrResidual_), layoutResidual(layoutResidual_), ptrGamma(ptrGamma_), ptrBeta(ptrBeta_),
+            layoutGamma(layoutGamma_), ptrSum(ptrSum_), ptrD(ptrD_), layoutD(layoutD_), epsilon(epsilon_) {}
+    };
+
+    CATLASS_DEVICE
+    BlockEpilogue(Arch::Resource<ArchTag> const &resource, Params const &params = Params{}) : params(params)
+    {
+        size_t ubOffset = 0;
+        ubS = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COUNT * sizeof(float);
+        ubTmp = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COUNT * sizeof(float);
+        ubResidual = resource.ubBuf.template GetBufferByByte<ElementResidual>(ubOffset);
+        ubOffset += TileShape::COUNT * sizeof(ElementResidual);
+        ubOut = resource.ubBuf.template GetBufferByByte<ElementD>(ubOffset);
+        ubOffset += TileShape::COUNT * sizeof(ElementD);
+        ubScratch = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileRowReduceSum::SCRATCH_COUNT * sizeof(float);
+        ubGamma = resource.ubBuf.template GetBufferByByte<ElementGamma>(ubOffset);
+        ubOffset += TileShape::COLUMN * sizeof(ElementGamma);
+        ubBeta = resource.ubBuf.template GetBufferByByte<ElementGamma>(ubOffset);
+        ubOffset += TileShape::COLUMN * sizeof(ElementGamma);
+        ubGammaFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COLUMN * sizeof(float);
+        ubBetaFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COLUMN * sizeof(float);
+        ubRowSum = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * sizeof(float);
+        ubRowSquareSum = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * sizeof(float);
+        ubRowScale = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * sizeof(float);
+        ubRowShift = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * sizeof(float);
+        ubOnes = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * sizeof(float);
+        ubRowScaleBrcb = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * ELE_NUM_PER_BLK * sizeof(float);
+        ubRowShiftBrcb = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::ROW * ELE_NUM_PER_BLK * sizeof(float);
+
+        AscendC::Duplicate(ubOnes, 1.0f, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    CATLASS_DEVICE
+    ~BlockEpilogue() {}
+
+    CATLASS_DEVICE
+    void UpdateParams(Params const &params_)
+    {
+        params = params_;
+    }
+
+    /// The m x n fp32 matrix the cube writes C to and S is written back to, and the row statistics, ROW_STAT_NUM
+    /// vectors of m floats. Set by the kernel before any other call.
+    CATLASS_DEVICE
+    void SetWorkspace(AscendC::GlobalTensor<float> const &gmS_, LayoutC const &layoutS_,
+        AscendC::GlobalTensor<float> const &gmRowStats_)
+    {
+        gmS = gmS_;
+        layoutS = layoutS_;
+        gmRowStats = gmRowStats_;
+    }
+
+    /// Zero the row statistics before the atomic accumulation, split over the AIVs.
+    CATLASS_DEVICE
+    void ClearRowStats(uint32_t aivIndex, uint32_t aivNum)
+    {
+        uint32_t total = ROW_STAT_NUM * layoutS.shape(0);
+        uint32_t perCore = RoundUp<ELE_NUM_PER_BLK>(CeilDiv(total, aivNum));
+        uint32_t begin = aivIndex * perCore;
+        uint32_t end = (begin + perCore < total) ? (begin + perCore) : total;
+        if (begin >= end) {
+            return;
+        }
+        AscendC::Duplicate(ubTmp, 0.0f, TileShape::COUNT);
+        Sync<AscendC::HardEvent::V_MTE3>();
+        for (uint32_t offset = begin; offset < end; offset += TileShape::COUNT) {
+            uint32_t count = (end - offset < TileShape::COUNT) ? (end - offset) : TileShape::COUNT;
+            layout::VectorLayout layoutChunk{count};
+            copyUbToGmRowStat(gmRowStats[offset], ubTmp, layoutChunk, layoutChunk);
+        }
+        Sync<AscendC::HardEvent::MTE3_V>();
+    }
+
+    CATLASS_DEVICE
+    void operator() (
+        GemmCoord const &blockShapeMNK,
+        GemmCoord const &blockCoordMNK,
+        GemmCoord const &actualBlockShapeMNK,
+        AscendC::GlobalTensor<ElementC> const &gmBlockC,
+        LayoutC const &layoutBlockC, Callback &&callback = Callback{}
+    )
+    {
+        if (actualBlockShapeMNK.k() == 0) {
+            return;
+        }
+        callback();
+
+        // Calculate the offset of the current block
+        MatrixCoord blockShape = blockShapeMNK.GetCoordMN();
+        MatrixCoord blockCoord = blockCoordMNK.GetCoordMN();
+        MatrixCoord actualBlockShape = actualBlockShapeMNK.GetCoordMN();
+        MatrixCoord blockOffset = blockCoord * blockShape;
+
+        uint32_t n = layoutS.shape(1);
+        bool fullRow = (actualBlockShape.column() == n) && (n <= TileShape::COLUMN);
+        float invN = 1.0f / static_cast<float>(n);
+
+        AscendC::GlobalTensor<ElementResidual> gmResidual;
+        gmResidual.SetGlobalBuffer(params.ptrResidual);
+        AscendC::GlobalTensor<ElementD> gmSum;
+        gmSum.SetGlobalBuffer(params.ptrSum);
+        AscendC::GlobalTensor<ElementD> gmD;
+        gmD.SetGlobalBuffer(params.ptrD);
+
+        if (fullRow) {
+            LoadGammaBeta(0, n);
+        }
+
+        auto ubTileStride = MakeCoord(static_cast<int64_t>(TileShape::COLUMN), 1L);
+        auto tileShape = TileShape::ToCoord();
+        EpilogueTileSwizzle epilogueTileSwizzle(actualBlockShape, tileShape);
+        uint32_t tileLoops = epilogueTileSwizzle.GetLoops();
+        uint32_t subblockIdx = AscendC::GetSubBlockIdx();
+        uint32_t subblockNum = AscendC::GetSubBlockNum();
+        for (uint32_t loopIdx = subblockIdx; loopIdx < tileLoops; loopIdx += subblockNum) {
+            auto tileCoord = epilogueTileSwizzle.GetTileCoord(loopIdx);
+            auto actualTileShape = epilogueTileSwizzle.GetActualTileShape(tileCoord);
+            auto tileOffsetInBlock = tileCoord * tileShape;
+            auto tileOffset = blockOffset + tileOffsetInBlock;
+            uint32_t cols = actualTileShape.column();
+
+            auto gmTileC = gmBlockC[layoutBlockC.GetOffset(tileOffsetInBlock)];
+            auto layoutGmTileC = layoutBlockC.GetTileLayout(actualTileShape);
+            auto gmTileResidual = gmResidual[params.layoutResidual.GetOffset(tileOffset)];
+            auto layoutGmTileResidual = params.layoutResidual.GetTileLayout(actualTileShape);
+            LayoutC layoutUbS{actualTileShape, ubTileStride};
+            LayoutResidual layoutUbResidual{actualTileShape, ubTileStride};
+            LayoutD layoutUbD{actualTileShape, ubTileStride};
+            auto layoutGmTileD = params.layoutD.GetTileLayout(actualTileShape);
+
+            Sync<AscendC::HardEvent::V_MTE2>();
+            copyGmToUbC(ubS, gmTileC, layoutUbS, layoutGmTileC);
+            copyGmToUbResidual(ubResidual, gmTileResidual, layoutUbResidual, layoutGmTileResidual);
+            Sync<AscendC::HardEvent::MTE2_V>();
+
+            AscendC::Cast(ubTmp, ubResidual, AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Add(ubS, ubS, ubTmp, TileShape::COUNT);
+            AscendC::PipeBarrier<PIPE_V>();
+            FillColumnTail(ubS, cols);
+
+            AscendC::Cast(ubOut, ubS, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+            Sync<AscendC::HardEvent::V_MTE3>();
+            copyUbToGmD(gmSum[params.layoutD.GetOffset(tileOffset)], ubOut, layoutGmTileD, layoutUbD);
+
+            if (fullRow) {
+                // The whole row is in UB, normalize it right away
+                AscendC::LocalTensor<float> ubNorm;
+                if constexpr (IS_LAYER_NORM) {
+                    tileRowReduceSum(ubRowSum, ubS, ubScratch);
+                    AscendC::PipeBarrier<PIPE_V>();
+                    SubtractRowMean(ubTmp, ubS, invN, cols);
+                    AscendC::Mul(ubS, ubTmp, ubTmp, TileShape::COUNT);
+                    AscendC::PipeBarrier<PIPE_V>();
+                    tileRowReduceSum(ubRowSquareSum, ubS, ubScratch);
+                    ubNorm = ubTmp;
+                } else {
+                    AscendC::Mul(ubTmp, ubS, ubS, TileShape::COUNT);
+                    AscendC::PipeBarrier<PIPE_V>();
+                    tileRowReduceSum(ubRowSquareSum, ubTmp, ubScratch);
+                    ubNorm = ubS;
+                }
+                AscendC::PipeBarrier<PIPE_V>();
+                ScaleRows(ubNorm, invN);
+
+                Sync<AscendC::HardEvent::MTE3_V>();
+                AscendC::Cast(ubOut, ubNorm, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+                Sync<AscendC::HardEvent::V_MTE3>();
+                copyUbToGmD(gmD[params.layoutD.GetOffset(tileOffset)], ubOut, layoutGmTileD, layoutUbD);
+            } else {
+                // Keep the fp32 S for the normalization pass and accumulate the partial row statistics
+                copyUbToGmC(gmTileC, ubS, layoutGmTileC, layoutUbS);
+                if constexpr (IS_LAYER_NORM) {
+                    tileRowReduceSum(ubRowSum, ubS, ubScratch);
+                    AtomicAddRowStat(ubRowSum, ROW_STAT_SUM, tileOffset.row(), actualTileShape.row());
+                } else {
+                    AscendC::Mul(ubTmp, ubS, ubS, TileShape::COUNT);
+                    AscendC::PipeBarrier<PIPE_V>();
+                    tileRowReduceSum(ubRowSquareSum, ubTmp, ubScratch);
+                    AtomicAddRowStat(ubRowSquareSum, ROW_STAT_SQUARE_SUM, tileOffset.row(), actualTileShape.row());
+                }
+            }
+            Sync<AscendC::HardEvent::MTE3_V>();
+        }
+    }
+
+    /// LayerNorm on rows spanning several blocks: sum((S - mean)^2) of the stored S, once the row sums of all the
+    /// blocks are in the workspace. Tiles of the m x n matrix are split over the AIVs.
+    CATLASS_DEVICE
+    void AccumulateCenteredSquares(uint32_t aivIndex, uint32_t aivNum)
+    {
+        uint32_t m = layoutS.shape(0);
+        uint32_t n = layoutS.shape(1);
+        float invN = 1.0f / static_cast<float>(n);
+        uint32_t tilesN = CeilDiv<TileShape::COLUMN>(n);
+        uint32_t tileLoops = CeilDiv<TileShape::ROW>(m) * tilesN;
+        auto ubTileStride = MakeCoord(static_cast<int64_t>(TileShape::COLUMN), 1L);
+        for (uint32_t loopIdx = aivIndex; loopIdx < tileLoops; loopIdx += aivNum) {
+            MatrixCoord tileOffset{(loopIdx / tilesN) * TileShape::ROW, (loopIdx % tilesN) * TileShape::COLUMN};
+            MatrixCoord actualTileShape = GetActualTileShape(tileOffset);
+            LayoutC layoutUbS{actualTileShape, ubTileStride};
+
+            Sync<AscendC::HardEvent::V_MTE2>();
+            copyGmToUbC(ubS, gmS[layoutS.GetOffset(tileOffset)], layoutUbS, layoutS.GetTileLayout(actualTileShape));
+            LoadRowStat(ubRowSum, ROW_STAT_SUM, tileOffset.row(), actualTileShape.row());
+            Sync<AscendC::HardEvent::MTE2_V>();
+
+            SubtractRowMean(ubTmp, ubS, invN, actualTileShape.column());
+            AscendC::Mul(ubTmp, ubTmp, ubTmp, TileShape::COUNT);
+            AscendC::PipeBarrier<PIPE_V>();
+            tileRowReduceSum(ubRowSquareSum, ubTmp, ubScratch);
+            AtomicAddRowStat(ubRowSquareSum, ROW_STAT_SQUARE_SUM, tileOffset.row(), actualTileShape.row());
+            Sync<AscendC::HardEvent::MTE3_V>();
+        }
+    }
+
+    /// Rows spanning several blocks: D from the stored S and the complete row statistics.
+    CATLASS_DEVICE
+    void Normalize(uint32_t aivIndex, uint32_t aivNum)
+    {
+        uint32_t m = layoutS.shape(0);
+        uint32_t n = layoutS.shape(1);
+        float invN = 1.0f / static_cast<float>(n);
+        uint32_t tilesN = CeilDiv<TileShape::COLUMN>(n);
+        uint32_t tileLoops = CeilDiv<TileShape::ROW>(m) * tilesN;
+        auto ubTileStride = MakeCoord(static_cast<int64_t>(TileShape::COLUMN), 1L);
+
+        AscendC::GlobalTensor<ElementD> gmD;
+        gmD.SetGlobalBuffer(params.ptrD);
+
+        for (uint32_t loopIdx = aivIndex; loopIdx < tileLoops; loopIdx += aivNum) {
+            MatrixCoord tileOffset{(loopIdx / tilesN) * TileShape::ROW, (loopIdx % tilesN) * TileShape::COLUMN};
+            MatrixCoord actualTileShape = GetActualTileShape(tileOffset);
+            LayoutC layoutUbS{actualTileShape, ubTileStride};
+            LayoutD layoutUbD{actualTileShape, ubTileStride};
+
+            LoadGammaBeta(tileOffset.column(), actualTileShape.column());
+            Sync<AscendC::HardEvent::V_MTE2>();
+            copyGmToUbC(ubS, gmS[layoutS.GetOffset(tileOffset)], layoutUbS, layoutS.GetTileLayout(actualTileShape));
+            if constexpr (IS_LAYER_NORM) {
+                LoadRowStat(ubRowSum, ROW_STAT_SUM, tileOffset.row(), actualTileShape.row());
+            }
+            LoadRowStat(ubRowSquareSum, ROW_STAT_SQUARE_SUM, tileOffset.row(), actualTileShape.row());
+            Sync<AscendC::HardEvent::MTE2_V>();
+
+            AscendC::LocalTensor<float> ubNorm = ubS;
+            if constexpr (IS_LAYER_NORM) {
+                SubtractRowMean(ubTmp, ubS, invN, actualTileShape.column());
+                ubNorm = ubTmp;
+            }
+            ScaleRows(ubNorm, invN);
+
+            AscendC::Cast(ubOut, ubNorm, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+            Sync<AscendC::HardEvent::V_MTE3>();
+            copyUbToGmD(gmD[params.layoutD.GetOffset(tileOffset)], ubOut,
+                params.layoutD.GetTileLayout(actualTileShape), layoutUbD);
+            Sync<AscendC::HardEvent::MTE3_V>();
+        }
+    }
+
+private:
+    static constexpr int32_t EVENT_ID = 0;
+
+    template <AscendC::HardEvent EVENT>
+    CATLASS_DEVICE
+    static void Sync()
+    {
+        AscendC::SetFlag<EVENT>(EVENT_ID);
+        AscendC::WaitFlag<EVENT>(EVENT_ID);
+    }
+
+    CATLASS_DEVICE
+    MatrixCoord GetActualTileShape(MatrixCoord const &tileOffset) const
+    {
+        uint32_t rows = layoutS.shape(0) - tileOffset.row();
+        uint32_t cols = layoutS.shape(1) - tileOffset.column();
+        return MatrixCoord{(rows < TileShape::ROW) ? rows : TileShape::ROW,
+            (cols < TileShape::COLUMN) ? cols : TileShape::COLUMN};
+    }
+
+    /// Zero columns [cols, TileShape::COLUMN) of every row, so that the row reductions only see the valid tile.
+    CATLASS_DEVICE
+    void FillColumnTail(AscendC::LocalTensor<float> const &ubTile, uint32_t cols)
+    {
+        if (cols >= TileShape::COLUMN) {
+            return;
+        }
+        constexpr uint8_t blkNumPerColumn = TileShape::COLUMN / ELE_NUM_PER_BLK;
+        uint32_t colStart = RoundDown<ELE_NUM_PER_BLK>(cols);
+        for (uint32_t colOffset = colStart; colOffset < TileShape::COLUMN; colOffset += ELE_NUM_PER_FRACTAL) {
+            uint32_t colNum = TileShape::COLUMN - colOffset;
+            uint64_t mask[2] = {(colNum >= ELE_NUM_PER_FRACTAL) ? ~0ULL : ((1ULL << colNum) - 1), 0};
+            if (colOffset == colStart) {
+                mask[0] &= ~((1ULL << (cols - colStart)) - 1);
+            }
+            AscendC::Duplicate(ubTile[colOffset], 0.0f, mask, static_cast<uint8_t>(TileShape::ROW), 1,
+                blkNumPerColumn);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    /// ubCentered = ubIn - ubRowSum * invN, with the tail columns zeroed. Keeps -mean in ubRowShift.
+    CATLASS_DEVICE
+    void SubtractRowMean(AscendC::LocalTensor<float> const &ubCentered, AscendC::LocalTensor<float> const &ubIn,
+        float invN, uint32_t cols)
+    {
+        AscendC::Muls(ubRowShift, ubRowSum, -invN, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+        tileBroadcastOneBlk(ubRowShiftBrcb, ubRowShift);
+        AscendC::PipeBarrier<PIPE_V>();
+        tileOneBlkColumnBroadcastAdd(ubCentered, ubIn, ubRowShiftBrcb);
+        AscendC::PipeBarrier<PIPE_V>();
+        FillColumnTail(ubCentered, cols);
+    }
+
+    /// ubNorm = ubNorm / sqrt(ubRowSquareSum * invN + eps) * gamma (+ beta)
+    CATLASS_DEVICE
+    void ScaleRows(AscendC::LocalTensor<float> const &ubNorm, float invN)
+    {
+        AscendC::Muls(ubRowScale, ubRowSquareSum, invN, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Adds(ubRowScale, ubRowScale, params.epsilon, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Sqrt(ubRowScale, ubRowScale, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Div(ubRowScale, ubOnes, ubRowScale, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+        tileBroadcastOneBlk(ubRowScaleBrcb, ubRowScale);
+        AscendC::PipeBarrier<PIPE_V>();
+        tileOneBlkColumnBroadcastMul(ubNorm, ubNorm, ubRowScaleBrcb);
+        AscendC::PipeBarrier<PIPE_V>();
+        tileRowBroadcastMul(ubNorm, ubNorm, ubGammaFp32);
+        if (IS_LAYER_NORM && (params.ptrBeta != nullptr)) {
+            AscendC::PipeBarrier<PIPE_V>();
+            tileRowBroadcastAdd(ubNorm, ubNorm, ubBetaFp32);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    /// gamma and beta of columns [colOffset, colOffset + cols) in fp32
+    CATLASS_DEVICE
+    void LoadGammaBeta(uint32_t colOffset, uint32_t cols)
+    {
+        bool hasBeta = IS_LAYER_NORM && (params.ptrBeta != nullptr);
+        AscendC::GlobalTensor<ElementGamma> gmGamma;
+        gmGamma.SetGlobalBuffer(params.ptrGamma);
+        AscendC::GlobalTensor<ElementGamma> gmBeta;
+        gmBeta.SetGlobalBuffer(params.ptrBeta);
+        layout::VectorLayout layoutTile{cols};
+
+        Sync<AscendC::HardEvent::V_MTE2>();
+        copyGmToUbGamma(ubGamma, gmGamma[colOffset], layoutTile, layoutTile);
+        if (hasBeta) {
+            copyGmToUbGamma(ubBeta, gmBeta[colOffset], layoutTile, layoutTile);
+        }
+        Sync<AscendC::HardEvent::MTE2_V>();
+        AscendC::Cast(ubGammaFp32, ubGamma, AscendC::RoundMode::CAST_NONE, TileShape::COLUMN);
+        if (hasBeta) {
+            AscendC::Cast(ubBetaFp32, ubBeta, AscendC::RoundMode::CAST_NONE, TileShape::COLUMN);
+        }
+        AscendC::PipeBarrier<PIPE_V>();
+    }
+
+    CATLASS_DEVICE
+    void LoadRowStat(AscendC::LocalTensor<float> const &ubRowStat, uint32_t stat, uint32_t rowOffset, uint32_t rows)
+    {
+        layout::VectorLayout layoutRows{rows};
+        copyGmToUbRowStat(ubRowStat, gmRowStats[stat * layoutS.shape(0) + rowOffset], layoutRows, layoutRows);
+    }
+
+    CATLASS_DEVICE
+    void AtomicAddRowStat(AscendC::LocalTensor<float> const &ubRowStat, uint32_t stat, uint32_t rowOffset,
+        uint32_t rows)
+    {
+        layout::VectorLayout layoutRows{rows};
+        Sync<AscendC::HardEvent::V_MTE3>();
+        AscendC::SetAtomicAdd<float>();
+        copyUbToGmRowStat(gmRowStats[stat * layoutS.shape(0) + rowOffset], ubRowStat, layoutRows, layoutRows);
+        AscendC::SetAtomicNone();
+    }
+
+    Params params;
+
+    AscendC::GlobalTensor<float> gmS;
+    LayoutC layoutS;
+    AscendC::GlobalTensor<float> gmRowStats;
+
+    AscendC::LocalTensor<float> ubS;
+    AscendC::LocalTensor<float> ubTmp;
+    AscendC::LocalTensor<ElementResidual> ubResidual;
+    AscendC::LocalTensor<ElementD> ubOut;
+    AscendC::LocalTensor<float> ubScratch;
+    AscendC::LocalTensor<ElementGamma> ubGamma;
+    AscendC::LocalTensor<ElementGamma> ubBeta;
+    AscendC::LocalTensor<float> ubGammaFp32;
+    AscendC::LocalTensor<float> ubBetaFp32;
+    AscendC::LocalTensor<float> ubRowSum;
+    AscendC::LocalTensor<float> ubRowSquareSum;
+    AscendC::LocalTensor<float> ubRowScale;
+    AscendC::LocalTensor<float> ubRowShift;
+    AscendC::LocalTensor<float> ubOnes;
+    AscendC::LocalTensor<float> ubRowScaleBrcb;
+    AscendC::LocalTensor<float> ubRowShiftBrcb;
+
+    TileRowReduceSum tileRowReduceSum;
+    TileRowBroadcastMul tileRowBroadcastMul;
+    TileRowBroadcastAdd tileRowBroadcastAdd;
+    TileOneBlkColumnBroadcastMul tileOneBlkColumnBroadcastMul;
+    TileOneBlkColumnBroadcastAdd tileOneBlkColumnBroadcastAdd;
+    TileBroadcastOneBlk tileBroadcastOneBlk;
+
+    CopyGmToUbC copyGmToUbC;
+    CopyGmToUbResidual copyGmToUbResidual;
+    CopyGmToUbGamma copyGmToUbGamma;
+    CopyUbToGmD copyUbToGmD;
+    CopyUbToGmC copyUbToGmC;
+    CopyGmToUbRowStat copyGmToUbRowStat;
+    CopyUbToGmRowStat copyUbToGmRowStat;
+};
+
+}  // namespace Catlass::Epilogue::Block
+
+#endif  // CATLASS_EPILOGUE_BLOCK_EPILOGUE_RESIDUAL_NORM_HPP
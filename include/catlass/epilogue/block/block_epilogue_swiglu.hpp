@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_BLOCK_EPILOGUE_SWIGLU_HPP
+#define CATLASS_EPILOGUE_BLOCK_EPILOGUE_SWIGLU_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/epilogue/dispatch_policy.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/detail/callback.hpp"
+
+namespace Catlass::Epilogue::Block {
+
+/// D = SiLU(gate) * up, computed in fp32 and cast to the element type of D. A block of C is the product with an
+/// interleaved gate/up weight: its left half holds the gate columns and its right half the up columns of the same
+/// blockShape.n() / 2 columns of D, so a block of C with actual width 2 * w produces w columns of D, at column
+/// blockCoord.n() * blockShape.n() / 2.
+template <
+    uint32_t UB_STAGES_,
+    class CType_,
+    class DType_,
+    class TileSilu_,
+    class TileElemwiseMul_,
+    class TileCopy_,
+    class EpilogueTileSwizzle_
+>
+class BlockEpilogue <
+    EpilogueAtlasA2SwiGlu<UB_STAGES_>,
+    CType_,
+    DType_,
+    TileSilu_,
+    TileElemwiseMul_,
+    TileCopy_,
+    EpilogueTileSwizzle_
+> {
+public:
+    using DispatchPolicy = EpilogueAtlasA2SwiGlu<UB_STAGES_>;
+    using ArchTag = typename DispatchPolicy::ArchTag;
+    static constexpr uint32_t UB_STAGES = UB_STAGES_;
+
+    // Data infos
+    using ElementC = typename CType_::Element;
+    using LayoutC = typename CType_::Layout;
+    using ElementD = typename DType_::Element;
+    using LayoutD = typename DType_::Layout;
+
+    // Check data infos
+    static_assert(
+        (std::is_same_v<ElementC, float> || std::is_same_v<ElementC, half>) &&
+            (std::is_same_v<ElementD, half> || std::is_same_v<ElementD, bfloat16_t>),
+        "The element type template parameters of BlockEpilogue are wrong"
+    );
+    static_assert(
+        std::is_same_v<LayoutC, layout::RowMajor> && std::is_same_v<LayoutD, layout::RowMajor>,
+        "The layout template parameters of BlockEpilogue are wrong"
+    );
+
+    // Tile compute ops
+    using TileSilu = TileSilu_;
+    using TileElemwiseMul = TileElemwiseMul_;
+
+    // Tile copy
+    using CopyGmToUbC = typename TileCopy_::CopyGmToUbC;
+    using CopyUbToGmD = typename TileCopy_::CopyUbToGmD;
+
+    using EpilogueTileSwizzle = EpilogueTileSwizzle_;
+
+    using TileShape = typename TileSilu::TileShape;
+
+    static_assert(std::is_same_v<TileShape, typename TileElemwiseMul::TileShape>,
+        "TileShape must be consistent for all tile compute ops");
+
+    static constexpr bool CAST_C = !std::is_same_v<ElementC, float>;
+
+    static_assert(
+        (UB_STAGES * TileShape::COUNT * (2 * sizeof(ElementC) + sizeof(ElementD))
+            + ((CAST_C ? 2 : 0) + 1) * TileShape::COUNT * sizeof(float))
+        <= ArchTag::UB_SIZE,
+        "TileShape is too large to fit in UB"
+    );
+
+    struct Params {
+        __gm__ ElementD *ptrD{nullptr};
+        LayoutD layoutD{};
+
+        CATLASS_HOST_DEVICE
+        Params() {};
+
+        CATLASS_HOST_DEVICE
+        Params(__gm__ ElementD *ptrD_, LayoutD const &layoutD_) : ptrD(ptrD_), layoutD(layoutD_) {}
+    };
+
+    CATLASS_DEVICE
+    BlockEpilogue(Arch::Resource<ArchTag> const &resource, Params const &params = Params{}) : params(params)
+    {
+        size_t ubOffset = 0;
+        int32_t eventVMTE2 = 0;
+        int32_t eventMTE2V = 0;
+        int32_t eventMTE3V = 0;
+        int32_t eventVMTE3 = 0;
+        for (uint32_t i = 0; i < UB_STAGES; ++i) {
+            ubGateList[i] = resource.ubBuf.template GetBufferByByte<ElementC>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(ElementC);
+            ubUpList[i] = resource.ubBuf.template GetBufferByByte<ElementC>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(ElementC);
+            ubDList[i] = resource.ubBuf.template GetBufferByByte<ElementD>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(ElementD);
+
+            eventUbCVMTE2List[i] = eventVMTE2++;
+            eventUbCMTE2VList[i] = eventMTE2V++;
+            eventUbDMTE3VList[i] = eventMTE3V++;
+            eventUbDVMTE3List[i] = eventVMTE3++;
+
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[i]);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[i]);
+        }
+        if constexpr (CAST_C) {
+            ubGateFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(float);
+            ubUpFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(float);
+        }
+        ubTmp = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += TileShape::COUNT * sizeof(float);
+    }
+
+    CATLASS_DEVICE
+    ~BlockEpilogue()
+    {
+        for (uint32_t i = 0; i < UB_STAGES; ++i) {
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[i]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[i]);
+        }
+    }
+
+    CATLASS_DEVICE
+    void UpdateParams(Params const &params_)
+    {
+        params = params_;
+    }
+
+    CATLASS_DEVICE
+    void operator() (
+        GemmCoord const &blockShapeMNK,
+        GemmCoord const &blockCoordMNK,
+        GemmCoord const &actualBlockShapeMNK,
+        AscendC::GlobalTensor<ElementC> const &gmBlockC,
+        LayoutC const &layoutBlockC, Callback &&callback = Callback{}
+    )
+    {
+        if (actualBlockShapeMNK.k() == 0) {
+            return;
+        }
+        callback();
+
+        // The gate and up halves of the block, and the block of D they produce
+        uint32_t halfBlockN = blockShapeMNK.n() / 2;
+        uint32_t actualHalfN = actualBlockShapeMNK.n() / 2;
+        MatrixCoord actualBlockShape{actualBlockShapeMNK.m(), actualHalfN};
+        MatrixCoord blockOffset{blockCoordMNK.m() * blockShapeMNK.m(), blockCoordMNK.n() * halfBlockN};
+        auto gmBlockUp = gmBlockC[actualHalfN];
+
+        AscendC::GlobalTensor<ElementD> gmD;
+        gmD.SetGlobalBuffer(params.ptrD);
+
+        auto ubTileStride = MakeCoord(static_cast<int64_t>(TileShape::COLUMN), 1L);
+        auto tileShape = TileShape::ToCoord();
+        EpilogueTileSwizzle epilogueTileSwizzle(actualBlockShape, tileShape);
+        uint32_t tileLoops = epilogueTileSwizzle.GetLoops();
+        uint32_t subblockIdx = AscendC::GetSubBlockIdx();
+        uint32_t subblockNum = AscendC::GetSubBlockNum();
+        for (uint32_t loopIdx = subblockIdx; loopIdx < tileLoops; loopIdx += subblockNum) {
+            auto tileCoord = epilogueTileSwizzle.GetTileCoord(loopIdx);
+            auto actualTileShape = epilogueTileSwizzle.GetActualTileShape(tileCoord);
+            auto tileOffsetInBlock = tileCoord * tileShape;
+            auto tileOffset = blockOffset + tileOffsetInBlock;
+
+            int64_t gmTileOffsetC = layoutBlockC.GetOffset(tileOffsetInBlock);
+            auto layoutGmTileC = layoutBlockC.GetTileLayout(actualTileShape);
+            LayoutC layoutUbC{actualTileShape, ubTileStride};
+
+            auto &ubGate = ubGateList[ubListId];
+            auto &ubUp = ubUpList[ubListId];
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[ubListId]);
+            copyGmToUbC(ubGate, gmBlockC[gmTileOffsetC], layoutUbC, layoutGmTileC);
+            copyGmToUbC(ubUp, gmBlockUp[gmTileOffsetC], layoutUbC, layoutGmTileC);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventUbCMTE2VList[ubListId]);
+
+            AscendC::LocalTensor<float> ubGateCompute;
+            AscendC::LocalTensor<float> ubUpCompute;
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventUbCMTE2VList[ubListId]);
+            if constexpr (CAST_C) {
+                AscendC::Cast(ubGateFp32, ubGate, AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+                AscendC::Cast(ubUpFp32, ubUp, AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[ubListId]);
+                ubGateCompute = ubGateFp32;
+                ubUpCompute = ubUpFp32;
+            } else {
+                ubGateCompute = ubGate;
+                ubUpCompute = ubUp;
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            tileSilu(ubGateCompute, ubGateCompute, ubTmp);
+            AscendC::PipeBarrier<PIPE_V>();
+            tileElemwiseMul(ubGateCompute, ubGateCompute, ubUpCompute);
+            AscendC::PipeBarrier<PIPE_V>();
+
+            auto &ubD = ubDList[ubListId];
+            LayoutD layoutUbD{actualTileShape, ubTileStride};
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[ubListId]);
+            AscendC::Cast(ubD, ubGateCompute, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventUbDVMTE3List[ubListId]);
+            if constexpr (!CAST_C) {
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventUbCVMTE2List[ubListId]);
+            }
+
+            auto gmTileD = gmD[params.layoutD.GetOffset(tileOffset)];
+            auto layoutGmTileD = params.layoutD.GetTileLayout(actualTileShape);
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventUbDVMTE3List[ubListId]);
+            copyUbToGmD(gmTileD, ubD, layoutGmTileD, layoutUbD);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventUbDMTE3VList[ubListId]);
+
+            ubListId = (ubListId + 1 < UB_STAGES) ? (ubListId + 1) : 0;
+        }
+    }
+
+private:
+    Params params;
+
+    AscendC::LocalTensor<ElementC> ubGateList[UB_STAGES];
+    AscendC::LocalTensor<ElementC> ubUpList[UB_STAGES];
+    AscendC::LocalTensor<ElementD> ubDList[UB_STAGES];
+
+    int32_t eventUbCVMTE2List[UB_STAGES];
+    int32_t eventUbCMTE2VList[UB_STAGES];
+    int32_t eventUbDMTE3VList[UB_STAGES];
+    int32_t eventUbDVMTE3List[UB_STAGES];
+
+    uint32_t ubListId{0};
+
+    AscendC::LocalTensor<float> ubGateFp32;
+    AscendC::LocalTensor<float> ubUpFp32;
+    AscendC::LocalTensor<float> ubTmp;
+
+    TileSilu tileSilu;
+    TileElemwiseMul tileElemwiseMul;
+
+    CopyGmToUbC copyGmToUbC;
+    CopyUbToGmD copyUbToGmD;
+};
+
+}  // namespace Catlass::Epilogue::Block
+
+#endif  // CATLASS_EPILOGUE_BLOCK_EPILOGUE_SWIGLU_HPP
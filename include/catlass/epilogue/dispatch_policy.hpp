@@ -68,6 +68,41 @@ struct EpilogueAtlasA2PerTokenDequant {
     using ArchTag = Arch::AtlasA2;
     static constexpr uint32_t UB_STAGES = UB_STAGES_;
 };
+
+// For AtlasA2, per group dequant: the int32 partial sums of the k groups are dequantized with the scales of their
+// group and accumulated in fp32
+template <uint32_t UB_STAGES_>
+struct EpilogueAtlasA2PerGroupDequant {
+    using ArchTag = Arch::AtlasA2;
+    static constexpr uint32_t UB_STAGES = UB_STAGES_;
+};
+
+// For AtlasA2, D = activation(C + bias), multi-stage pipelined in UB
+template <uint32_t UB_STAGES_>
+struct EpilogueAtlasA2BiasActivation {
+    using ArchTag = Arch::AtlasA2;
+    static constexpr uint32_t UB_STAGES = UB_STAGES_;
+};
+
+// For AtlasA2, D = SiLU(gate) * up, gate and up being the two halves of a block of C, multi-stage pipelined in UB
+template <uint32_t UB_STAGES_>
+struct EpilogueAtlasA2SwiGlu {
+    using ArchTag = Arch::AtlasA2;
+    static constexpr uint32_t UB_STAGES = UB_STAGES_;
+};
+
+// For AtlasA2, epilogue visitor tree
+struct EpilogueAtlasA2Visitor {
+    using ArchTag = Arch::AtlasA2;
+};
+
+// For AtlasA2, S = C + residual and D = norm(S) over the rows, RMSNorm or LayerNorm
+template <bool IS_LAYER_NORM_>
+struct EpilogueAtlasA2ResidualNorm {
+    using ArchTag = Arch::AtlasA2;
+    static constexpr bool IS_LAYER_NORM = IS_LAYER_NORM_;
+};
+
 ////////////////////////////
 /// new add
 // For AtlasA2, GEMM
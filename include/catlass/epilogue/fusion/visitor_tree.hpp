@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_FUSION_VISITOR_TREE_HPP
+#define CATLASS_EPILOGUE_FUSION_VISITOR_TREE_HPP
+
+#include <cstdint>
+#include <type_traits>
+
+#include "catlass/detail/alignment.hpp"
+#include "catlass/detail/constants.hpp"
+#include "catlass/detail/dependent_false.hpp"
+#include "catlass/detail/macros.hpp"
+
+/// Epilogue visitor tree. A fused epilogue is described as a tree of node types, e.g.
+///
+///   using Tree = Store<0, half, Compute<OpRelu, Compute<OpAdd, Acc, RowBroadcast<1, half>>>>;
+///
+/// computes D = relu(C + bias) with D in tensor slot 0 and bias in slot 1. The same type is evaluated on device
+/// by Tile::TileVisitor, one UB tile at a time in fp32, and on the host by golden::EvaluateVisitorTree, which is
+/// the reference of the device result. Everything here is pure compile time description and planning, so that
+/// host code can include it.
+namespace Catlass::Epilogue::Fusion {
+
+/// Runtime arguments of a tree: up to VISITOR_MAX_TENSORS GM tensors, addressed by slot, and scalars.
+constexpr uint32_t VISITOR_MAX_TENSORS = 8;
+constexpr uint32_t VISITOR_MAX_SCALARS = 4;
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Ops of Compute nodes. SCRATCH_TILES is the number of fp32 tiles the device op needs besides its operands.
+
+struct OpAdd { static constexpr uint32_t ARITY = 2; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpSub { static constexpr uint32_t ARITY = 2; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpMul { static constexpr uint32_t ARITY = 2; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpDiv { static constexpr uint32_t ARITY = 2; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpMax { static constexpr uint32_t ARITY = 2; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpMin { static constexpr uint32_t ARITY = 2; static constexpr uint32_t SCRATCH_TILES = 0; };
+
+struct OpRelu { static constexpr uint32_t ARITY = 1; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpExp { static constexpr uint32_t ARITY = 1; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpAbs { static constexpr uint32_t ARITY = 1; static constexpr uint32_t SCRATCH_TILES = 0; };
+struct OpSilu { static constexpr uint32_t ARITY = 1; static constexpr uint32_t SCRATCH_TILES = 1; };
+struct OpGelu { static constexpr uint32_t ARITY = 1; static constexpr uint32_t SCRATCH_TILES = 1; };
+struct OpFastGelu { static constexpr uint32_t ARITY = 1; static constexpr uint32_t SCRATCH_TILES = 1; };
+
+/// x * scalars[SCALAR]
+template <uint32_t SCALAR_>
+struct OpScale {
+    static_assert(SCALAR_ < VISITOR_MAX_SCALARS, "Scalar slot out of range");
+    static constexpr uint32_t ARITY = 1;
+    static constexpr uint32_t SCRATCH_TILES = 0;
+    static constexpr uint32_t SCALAR = SCALAR_;
+};
+
+/// x + scalars[SCALAR]
+template <uint32_t SCALAR_>
+struct OpAddScalar {
+    static_assert(SCALAR_ < VISITOR_MAX_SCALARS, "Scalar slot out of range");
+    static constexpr uint32_t ARITY = 1;
+    static constexpr uint32_t SCRATCH_TILES = 0;
+    static constexpr uint32_t SCALAR = SCALAR_;
+};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Nodes. TENSOR is a tensor slot of the arguments, Element the element type of that tensor in GM.
+
+/// The m x n result of the mmad.
+struct Acc {};
+
+/// An m x n row major tensor.
+template <uint32_t TENSOR, class Element>
+struct AuxLoad {};
+
+/// A vector of n elements, the same for every row (e.g. a bias).
+template <uint32_t TENSOR, class Element>
+struct RowBroadcast {};
+
+/// A vector of m elements, the same for every column (e.g. a per token scale).
+template <uint32_t TENSOR, class Element>
+struct ColBroadcast {};
+
+/// Op applied elementwise to the children.
+template <class Op, class... Children>
+struct Compute {};
+
+/// Sums the child over the rows and atomically adds the n sums to an fp32 vector, which the caller zero fills.
+/// The child passes through, so a reduction can sit below a Store.
+template <uint32_t TENSOR, class Child>
+struct ColReduce {};
+
+/// Casts the child to Element and writes it to an m x n row major tensor. The child passes through, so several
+/// outputs can be chained.
+template <uint32_t TENSOR, class Element, class Child>
+struct Store {};
+
+//////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Planning. Each node leaves its result in one fp32 tile. TILES is the number of tiles live at once while the
+// node is evaluated, with Sethi-Ullman ordering: of two operands the one that needs more tiles is evaluated
+// first, then its result occupies one tile while the other one is evaluated.
+
+template <class Node>
+struct VisitorTraits {
+    static_assert(DEPENDENT_FALSE<Node>, "Unknown epilogue visitor node");
+};
+
+template <uint32_t A, uint32_t B>
+struct VisitorMax {
+    static constexpr uint32_t VALUE = (A > B) ? A : B;
+};
+
+/// Bytes per element of a load or store stage, fp32 tensors need none.
+template <class Element>
+struct VisitorStageBytes {
+    static constexpr uint32_t VALUE = std::is_same_v<Element, float> ? 0 : static_cast<uint32_t>(sizeof(Element));
+};
+
+struct VisitorLeafTraits {
+    static constexpr uint32_t TILES = 1;
+    static constexpr uint32_t LOAD_BYTES = 0;
+    static constexpr uint32_t STORE_BYTES = 0;
+    static constexpr bool USES_VECTOR = false;
+    static constexpr uint32_t TENSOR_MASK = 0;
+    static constexpr uint32_t NODES = 1;
+};
+
+template <>
+struct VisitorTraits<Acc> : VisitorLeafTraits {};
+
+template <uint32_t TENSOR, class Element>
+struct VisitorTraits<AuxLoad<TENSOR, Element>> : VisitorLeafTraits {
+    static_assert(TENSOR < VISITOR_MAX_TENSORS, "Tensor slot out of range");
+    static constexpr uint32_t LOAD_BYTES = VisitorStageBytes<Element>::VALUE;
+    static constexpr uint32_t TENSOR_MASK = 1U << TENSOR;
+};
+
+template <uint32_t TENSOR, class Element>
+struct VisitorTraits<RowBroadcast<TENSOR, Element>> : VisitorLeafTraits {
+    static_assert(TENSOR < VISITOR_MAX_TENSORS, "Tensor slot out of range");
+    static constexpr uint32_t LOAD_BYTES = VisitorStageBytes<Element>::VALUE;
+    static constexpr uint32_t TENSOR_MASK = 1U << TENSOR;
+};
+
+template <uint32_t TENSOR, class Element>
+struct VisitorTraits<ColBroadcast<TENSOR, Element>> : VisitorLeafTraits {
+    static_assert(TENSOR < VISITOR_MAX_TENSORS, "Tensor slot out of range");
+    static constexpr uint32_t LOAD_BYTES = VisitorStageBytes<Element>::VALUE;
+    static constexpr bool USES_VECTOR = true;
+    static constexpr uint32_t TENSOR_MASK = 1U << TENSOR;
+};
+
+template <class Op, class Child>
+struct VisitorTraits<Compute<Op, Child>> {
+    static_assert(Op::ARITY == 1, "The op of a Compute node with one child must be unary");
+    using ChildTraits = VisitorTraits<Child>;
+    static constexpr uint32_t TILES = VisitorMax<ChildTraits::TILES, 1 + Op::SCRATCH_TILES>::VALUE;
+    static constexpr uint32_t LOAD_BYTES = ChildTraits::LOAD_BYTES;
+    static constexpr uint32_t STORE_BYTES = ChildTraits::STORE_BYTES;
+    static constexpr bool USES_VECTOR = ChildTraits::USES_VECTOR;
+    static constexpr uint32_t TENSOR_MASK = ChildTraits::TENSOR_MASK;
+    static constexpr uint32_t NODES = ChildTraits::NODES + 1;
+};
+
+template <class Op, class Lhs, class Rhs>
+struct VisitorTraits<Compute<Op, Lhs, Rhs>> {
+    static_assert(Op::ARITY == 2, "The op of a Compute node with two children must be binary");
+    using LhsTraits = VisitorTraits<Lhs>;
+    using RhsTraits = VisitorTraits<Rhs>;
+    /// Evaluation order of the operands on device.
+    static constexpr bool LHS_FIRST = LhsTraits::TILES >= RhsTraits::TILES;
+    static constexpr uint32_t OPERAND_TILES = LHS_FIRST ?
+        VisitorMax<LhsTraits::TILES, RhsTraits::TILES + 1>::VALUE :
+        VisitorMax<RhsTraits::TILES, LhsTraits::TILES + 1>::VALUE;
+    static constexpr uint32_t TILES = VisitorMax<OPERAND_TILES, 2 + Op::SCRATCH_TILES>::VALUE;
+    static constexpr uint32_t LOAD_BYTES = VisitorMax<LhsTraits::LOAD_BYTES, RhsTraits::LOAD_BYTES>::VALUE;
+    static constexpr uint32_t STORE_BYTES = VisitorMax<LhsTraits::STORE_BYTES, RhsTraits::STORE_BYTES>::VALUE;
+    static constexpr bool USES_VECTOR = LhsTraits::USES_VECTOR || RhsTraits::USES_VECTOR;
+    static constexpr uint32_t TENSOR_MASK = LhsTraits::TENSOR_MASK | RhsTraits::TENSOR_MASK;
+    static constexpr uint32_t NODES = LhsTraits::NODES + RhsTraits::NODES + 1;
+};
+
+template <uint32_t TENSOR, class Child>
+struct VisitorTraits<ColReduce<TENSOR, Child>> {
+    static_assert(TENSOR < VISITOR_MAX_TENSORS, "Tensor slot out of range");
+    using ChildTraits = VisitorTraits<Child>;
+    static constexpr uint32_t TILES = ChildTraits::TILES;
+    static constexpr uint32_t LOAD_BYTES = ChildTraits::LOAD_BYTES;
+    static constexpr uint32_t STORE_BYTES = ChildTraits::STORE_BYTES;
+    static constexpr bool USES_VECTOR = true;
+    static constexpr uint32_t TENSOR_MASK = ChildTraits::TENSOR_MASK | (1U << TENSOR);
+    static constexpr uint32_t NODES = ChildTraits::NODES + 1;
+};
+
+template <uint32_t TENSOR, class Element, class Child>
+struct VisitorTraits<Store<TENSOR, Element, Child>> {
+    static_assert(TENSOR < VISITOR_MAX_TENSORS, "Tensor slot out of range");
+    using ChildTraits = VisitorTraits<Child>;
+    static constexpr uint32_t TILES = ChildTraits::TILES;
+    static constexpr uint32_t LOAD_BYTES = ChildTraits::LOAD_BYTES;
+    static constexpr uint32_t STORE_BYTES =
+        VisitorMax<ChildTraits::STORE_BYTES, VisitorStageBytes<Element>::VALUE>::VALUE;
+    static constexpr bool USES_VECTOR = ChildTraits::USES_VECTOR;
+    static constexpr uint32_t TENSOR_MASK = ChildTraits::TENSOR_MASK | (1U << TENSOR);
+    static constexpr uint32_t NODES = ChildTraits::NODES + 1;
+};
+
+/// UB plan of a tree for ROW x COLUMN tiles and the element type of C, in bytes:
+/// [fp32 tiles][load stage][store stage][fp32 vector]
+/// Loads and stores of other element types go through the stages and are cast from/to fp32, fp32 tensors are
+/// copied to/from the tiles directly. The vector holds a ColBroadcast operand or a ColReduce result.
+template <class Tree, class ElementC, uint32_t ROW_, uint32_t COLUMN_>
+struct VisitorUbPlan {
+    using Traits = VisitorTraits<Tree>;
+
+    static constexpr uint32_t ROW = ROW_;
+    static constexpr uint32_t COLUMN = COLUMN_;
+    static constexpr uint32_t COUNT = ROW * COLUMN;
+
+    static constexpr uint32_t TILES = Traits::TILES;
+    static constexpr uint32_t TILE_BYTES = COUNT * sizeof(float);
+    static constexpr uint32_t LOAD_ELEMENT_BYTES =
+        VisitorMax<Traits::LOAD_BYTES, VisitorStageBytes<ElementC>::VALUE>::VALUE;
+
+    static constexpr uint32_t TILES_OFFSET = 0;
+    static constexpr uint32_t LOAD_STAGE_OFFSET = TILES_OFFSET + TILES * TILE_BYTES;
+    static constexpr uint32_t LOAD_STAGE_BYTES = RoundUp<BYTE_PER_BLK>(COUNT * LOAD_ELEMENT_BYTES);
+    static constexpr uint32_t STORE_STAGE_OFFSET = LOAD_STAGE_OFFSET + LOAD_STAGE_BYTES;
+    static constexpr uint32_t STORE_STAGE_BYTES = RoundUp<BYTE_PER_BLK>(COUNT * Traits::STORE_BYTES);
+    static constexpr uint32_t VECTOR_OFFSET = STORE_STAGE_OFFSET + STORE_STAGE_BYTES;
+    static constexpr uint32_t VECTOR_BYTES = Traits::USES_VECTOR ?
+        RoundUp<BYTE_PER_BLK>(VisitorMax<ROW, COLUMN>::VALUE * static_cast<uint32_t>(sizeof(float))) : 0;
+    static constexpr uint32_t BYTES = VECTOR_OFFSET + VECTOR_BYTES;
+};
+
+}  // namespace Catlass::Epilogue::Fusion
+
+#endif  // CATLASS_EPILOGUE_FUSION_VISITOR_TREE_HPP
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_TILE_TILE_ACTIVATION_HPP
+#define CATLASS_EPILOGUE_TILE_TILE_ACTIVATION_HPP
+
+#include "catlass/catlass.hpp"
+
+namespace Catlass::Epilogue::Tile {
+
+/// Elementwise activations of a tile of TileShape::COUNT elements in UB. All of them take a scratch tensor of the
+/// same size, so that a block epilogue can use any of them. ubOut may be the same tensor as ubIn.
+/// GELU, fast GELU and SiLU are computed as x * sigmoid(g(x)) = x / (1 + exp(-g(x))), which only needs the basic
+/// vector instructions:
+///   SiLU:      g(x) = x
+///   fast GELU: g(x) = 1.702 * x
+///   GELU:      g(x) = 2 * sqrt(2 / pi) * (x + 0.044715 * x^3), i.e. the tanh approximation
+///              0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+
+/// @brief max(x, 0)
+template <
+    class ArchTag_,
+    class ComputeType_,
+    class TileShape_
+>
+struct TileRelu {
+    using ArchTag = ArchTag_;
+    using ElementCompute = typename ComputeType_::Element;
+    using TileShape = TileShape_;
+
+    CATLASS_DEVICE
+    TileRelu() {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<ElementCompute> const &ubOut,
+        AscendC::LocalTensor<ElementCompute> const &ubIn,
+        AscendC::LocalTensor<ElementCompute> const &ubTmp
+    )
+    {
+        AscendC::Relu(ubOut, ubIn, TileShape::COUNT);
+    }
+};
+
+namespace detail {
+
+/// ubOut = ubIn / (1 + exp(ubTmp)), where ubTmp holds -g(x) on entry
+template <class ElementCompute, uint32_t COUNT>
+CATLASS_DEVICE
+void DivideByOnePlusExp(
+    AscendC::LocalTensor<ElementCompute> const &ubOut,
+    AscendC::LocalTensor<ElementCompute> const &ubIn,
+    AscendC::LocalTensor<ElementCompute> const &ubTmp
+)
+{
+    AscendC::Exp(ubTmp, ubTmp, COUNT);
+    AscendC::PipeBarrier<PIPE_V>();
+    AscendC::Adds(ubTmp, ubTmp, static_cast<ElementCompute>(1), COUNT);
+    AscendC::PipeBarrier<PIPE_V>();
+    AscendC::Div(ubOut, ubIn, ubTmp, COUNT);
+}
+
+} // namespace detail
+
+/// @brief x * sigmoid(x)
+template <
+    class ArchTag_,
+    class ComputeType_,
+    class TileShape_
+>
+struct TileSilu {
+    using ArchTag = ArchTag_;
+    using ElementCompute = typename ComputeType_::Element;
+    using TileShape = TileShape_;
+
+    CATLASS_DEVICE
+    TileSilu() {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<ElementCompute> const &ubOut,
+        AscendC::LocalTensor<ElementCompute> const &ubIn,
+        AscendC::LocalTensor<ElementCompute> const &ubTmp
+    )
+    {
+        AscendC::Muls(ubTmp, ubIn, static_cast<ElementCompute>(-1), TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        detail::DivideByOnePlusExp<ElementCompute, TileShape::COUNT>(ubOut, ubIn, ubTmp);
+    }
+};
+
+/// @brief x * sigmoid(1.702 * x)
+template <
+    class ArchTag_,
+    class ComputeType_,
+    class TileShape_
+>
+struct TileFastGelu {
+    using ArchTag = ArchTag_;
+    using ElementCompute = typename ComputeType_::Element;
+    using TileShape = TileShape_;
+
+    static constexpr float SCALE = 1.702f;
+
+    CATLASS_DEVICE
+    TileFastGelu() {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<ElementCompute> const &ubOut,
+        AscendC::LocalTensor<ElementCompute> const &ubIn,
+        AscendC::LocalTensor<ElementCompute> const &ubTmp
+    )
+    {
+        AscendC::Muls(ubTmp, ubIn, static_cast<ElementCompute>(-SCALE), TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        detail::DivideByOnePlusExp<ElementCompute, TileShape::COUNT>(ubOut, ubIn, ubTmp);
+    }
+};
+
+/// @brief GELU, tanh approximation
+template <
+    class ArchTag_,
+    class ComputeType_,
+    class TileShape_
+>
+struct TileGelu {
+    using ArchTag = ArchTag_;
+    using ElementCompute = typename ComputeType_::Element;
+    using TileShape = TileShape_;
+
+    static constexpr float CUBIC_COEFF = 0.044715f;
+    // 2 * sqrt(2 / pi)
+    static constexpr float SCALE = 1.5957691216f;
+
+    CATLASS_DEVICE
+    TileGelu() {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<ElementCompute> const &ubOut,
+        AscendC::LocalTensor<ElementCompute> const &ubIn,
+        AscendC::LocalTensor<ElementCompute> const &ubTmp
+    )
+    {
+        AscendC::Mul(ubTmp, ubIn, ubIn, TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Mul(ubTmp, ubTmp, ubIn, TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Muls(ubTmp, ubTmp, static_cast<ElementCompute>(CUBIC_COEFF), TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Add(ubTmp, ubTmp, ubIn, TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        AscendC::Muls(ubTmp, ubTmp, static_cast<ElementCompute>(-SCALE), TileShape::COUNT);
+        AscendC::PipeBarrier<PIPE_V>();
+        detail::DivideByOnePlusExp<ElementCompute, TileShape::COUNT>(ubOut, ubIn, ubTmp);
+    }
+};
+
+} // namespace Catlass::Epilogue::Tile
+
+#endif // CATLASS_EPILOGUE_TILE_TILE_ACTIVATION_HPP
@@ -27,6 +27,21 @@ struct TileCopy {
     static_assert(DEPENDENT_FALSE<ArchTag>, "Unsupported tile copy, can not find the specialization.");
 };
 
+template <
+    class ArchTag,
+    /// GemmType for C matrix operand
+    class CType,
+    /// GemmType for D matrix operand
+    class DType
+>
+struct TileCopy<ArchTag, CType, DType> {
+    using ElementC = typename CType::Element;
+    using ElementD = typename DType::Element;
+
+    using CopyGmToUbC = CopyGm2Ub<ArchTag, CType>;
+    using CopyUbToGmD = CopyUb2Gm<ArchTag, DType>;
+};
+
 template <
     class ArchTag,
     /// GemmType for C matrix operand
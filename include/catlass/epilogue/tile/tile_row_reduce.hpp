@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_TILE_TILE_ROW_REDUCE_HPP
+#define CATLASS_EPILOGUE_TILE_TILE_ROW_REDUCE_HPP
+
+#include "catlass/catlass.hpp"
+
+namespace Catlass::Epilogue::Tile {
+
+/// @brief Sums every row of a tensor of shape (m, n) into a tensor of shape (m). The columns are first folded
+/// into one vector fractal per row in ubScratch, of shape (m, eleNumPerVectorFractal), which is then reduced with
+/// WholeReduceSum. ubIn is not modified. Every column of the tile is summed, so the columns outside the valid
+/// tile must be zero.
+/// @tparam ArchTag_ is the architecture tag.
+/// @tparam ComputeType_ includes the element type and layout information.
+/// @tparam TileShape_ is the shape (m, n).
+template <
+    class ArchTag_,
+    class ComputeType_,
+    class TileShape_
+>
+struct TileRowReduceSum {
+    using ArchTag = ArchTag_;
+    using ElementCompute = typename ComputeType_::Element;
+    using TileShape = TileShape_;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(ElementCompute);
+    static constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_VECTOR_FRACTAL / sizeof(ElementCompute);
+    static constexpr uint32_t SCRATCH_COUNT = TileShape::ROW * ELE_NUM_PER_FRACTAL;
+
+    static_assert(std::is_same_v<ElementCompute, float>, "TileRowReduceSum only supports float");
+    static_assert(TileShape::COLUMN % ELE_NUM_PER_FRACTAL == 0 && TileShape::COLUMN / ELE_NUM_PER_BLK <= 255,
+        "TileShape::COLUMN must be a multiple of one vector fractal, and its stride must fit a repeat stride");
+
+    CATLASS_DEVICE
+    TileRowReduceSum() {}
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<ElementCompute> const &ubOut,
+        AscendC::LocalTensor<ElementCompute> const &ubIn,
+        AscendC::LocalTensor<ElementCompute> const &ubScratch
+    )
+    {
+        constexpr uint32_t maxRepeatTimes = 255;
+        constexpr uint32_t blkNumPerColumn = TileShape::COLUMN / ELE_NUM_PER_BLK;
+        constexpr uint32_t fractalNum = TileShape::COLUMN / ELE_NUM_PER_FRACTAL;
+
+        AscendC::LocalTensor<ElementCompute> ubFold = ubIn;
+        uint8_t foldRepStride = blkNumPerColumn;
+        if constexpr (fractalNum > 1) {
+            AscendC::BinaryRepeatParams repeatParams;
+            repeatParams.dstBlkStride = 1;
+            repeatParams.src0BlkStride = 1;
+            repeatParams.src1BlkStride = 1;
+            repeatParams.dstRepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+            repeatParams.src0RepStride = blkNumPerColumn;
+            repeatParams.src1RepStride = blkNumPerColumn;
+            for (uint32_t colOffset = ELE_NUM_PER_FRACTAL; colOffset < TileShape::COLUMN;
+                colOffset += ELE_NUM_PER_FRACTAL) {
+                for (uint32_t rowOffset = 0; rowOffset < TileShape::ROW; rowOffset += maxRepeatTimes) {
+                    uint32_t residueM = TileShape::ROW - rowOffset;
+                    uint8_t repeatTimes = static_cast<uint8_t>((residueM > maxRepeatTimes) ? maxRepeatTimes : residueM);
+                    AscendC::Add(
+                        ubScratch[rowOffset * ELE_NUM_PER_FRACTAL],
+                        (colOffset == ELE_NUM_PER_FRACTAL) ?
+                            ubIn[rowOffset * TileShape::COLUMN] : ubScratch[rowOffset * ELE_NUM_PER_FRACTAL],
+                        ubIn[rowOffset * TileShape::COLUMN + colOffset],
+                        ELE_NUM_PER_FRACTAL, repeatTimes, repeatParams
+                    );
+                }
+                AscendC::PipeBarrier<PIPE_V>();
+                // The running sum is read back with the stride of the scratch
+                repeatParams.src0RepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+            }
+            ubFold = ubScratch;
+            foldRepStride = BLK_NUM_PER_VECTOR_FRACTAL;
+        }
+
+        for (uint32_t rowOffset = 0; rowOffset < TileShape::ROW; rowOffset += maxRepeatTimes) {
+            uint32_t residueM = TileShape::ROW - rowOffset;
+            int32_t repeatTimes = static_cast<int32_t>((residueM > maxRepeatTimes) ? maxRepeatTimes : residueM);
+            AscendC::WholeReduceSum<ElementCompute>(
+                ubOut[rowOffset], ubFold[rowOffset * foldRepStride * ELE_NUM_PER_BLK],
+                ELE_NUM_PER_FRACTAL, repeatTimes, 1, 1, foldRepStride
+            );
+        }
+    }
+};
+
+} // namespace Catlass::Epilogue::Tile
+
+#endif // CATLASS_EPILOGUE_TILE_TILE_ROW_REDUCE_HPP
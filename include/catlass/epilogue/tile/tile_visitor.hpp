@@ -0,0 +1,418 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_EPILOGUE_TILE_TILE_VISITOR_HPP
+#define CATLASS_EPILOGUE_TILE_TILE_VISITOR_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/epilogue/fusion/visitor_tree.hpp"
+#include "catlass/epilogue/tile/copy_gm_to_ub.hpp"
+#include "catlass/epilogue/tile/copy_ub_to_gm.hpp"
+#include "catlass/epilogue/tile/tile_activation.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_inplace_by_column.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_inplace_by_row.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Epilogue::Tile {
+
+/// Evaluates an epilogue visitor tree (see catlass/epilogue/fusion/visitor_tree.hpp) on one tile of C in a single
+/// UB resident pass. Every node leaves its result in one fp32 tile, the tiles are assigned at compile time by
+/// Fusion::VisitorTraits, so a tree needs Fusion::VisitorUbPlan::BYTES of UB whatever its size.
+/// Loads and stores are issued one after the other, each waits for the vector instructions that use its buffer.
+/// @tparam ArchTag_ is the architecture tag.
+/// @tparam Tree_ is the visitor tree.
+/// @tparam ElementC_ is the element type of C in GM.
+/// @tparam TileShape_ is the shape (m, n) of a tile.
+template <
+    class ArchTag_,
+    class Tree_,
+    class ElementC_,
+    class TileShape_
+>
+struct TileVisitor {
+    using ArchTag = ArchTag_;
+    using Tree = Tree_;
+    using ElementC = ElementC_;
+    using TileShape = TileShape_;
+    using Plan = Fusion::VisitorUbPlan<Tree, ElementC, TileShape::ROW, TileShape::COLUMN>;
+
+    static constexpr uint32_t UB_BYTES = Plan::BYTES;
+
+    using ComputeType = Gemm::GemmType<float, layout::RowMajor>;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(float);
+    static_assert(TileShape::COLUMN % (BYTE_PER_VECTOR_FRACTAL / sizeof(float)) == 0,
+        "TileShape::COLUMN must be a multiple of the floats of one repeat");
+    static_assert(TileShape::ROW % ELE_NUM_PER_BLK == 0 && TileShape::ROW <= 255 * ELE_NUM_PER_BLK,
+        "TileShape::ROW must be a multiple of the floats of one block, and fit one Brcb");
+
+    struct Params {
+        // Tensor slots of the tree. m x n tensors are row major with leading dimension ldTensor.
+        GM_ADDR ptrTensor[Fusion::VISITOR_MAX_TENSORS]{};
+        int64_t ldTensor[Fusion::VISITOR_MAX_TENSORS]{};
+        float scalars[Fusion::VISITOR_MAX_SCALARS]{};
+
+        CATLASS_HOST_DEVICE
+        Params() {}
+    };
+
+    CATLASS_DEVICE
+    TileVisitor(Arch::Resource<ArchTag> const &resource, uint32_t ubOffset = 0)
+    {
+        ubTiles = resource.ubBuf.template GetBufferByByte<float>(ubOffset + Plan::TILES_OFFSET);
+        ubLoadStage = resource.ubBuf.template GetBufferByByte<uint8_t>(ubOffset + Plan::LOAD_STAGE_OFFSET);
+        ubStoreStage = resource.ubBuf.template GetBufferByByte<uint8_t>(ubOffset + Plan::STORE_STAGE_OFFSET);
+        ubVector = resource.ubBuf.template GetBufferByByte<float>(ubOffset + Plan::VECTOR_OFFSET);
+
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_LOAD_STAGE);
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_STORE_STAGE);
+    }
+
+    CATLASS_DEVICE
+    ~TileVisitor()
+    {
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_LOAD_STAGE);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_STORE_STAGE);
+    }
+
+    /// Evaluates the tree on the tile at tileOffset of the m x n problem.
+    /// gmTileC and layoutGmTileC are the tile of C in the workspace.
+    CATLASS_DEVICE
+    void operator()(
+        Params const &params,
+        AscendC::GlobalTensor<ElementC> const &gmTileC, layout::RowMajor const &layoutGmTileC,
+        MatrixCoord const &tileOffset, MatrixCoord const &actualTileShape
+    )
+    {
+        paramsPtr = &params;
+        gmC = gmTileC;
+        layoutGmC = layoutGmTileC;
+        offset = tileOffset;
+        actualShape = actualTileShape;
+        layoutUbTile = layout::RowMajor{actualTileShape, MakeCoord(static_cast<int64_t>(TileShape::COLUMN), 1L)};
+
+        Visit<0>(Tree{});
+    }
+
+private:
+    static constexpr int32_t EVENT_LOAD_STAGE = 0;
+    static constexpr int32_t EVENT_STORE_STAGE = 0;
+    static constexpr int32_t EVENT_SYNC = 1;
+
+    CATLASS_DEVICE
+    AscendC::LocalTensor<float> Tile(uint32_t idx) const
+    {
+        return ubTiles[idx * TileShape::COUNT];
+    }
+
+    template <class Element>
+    CATLASS_DEVICE
+    AscendC::GlobalTensor<Element> Tensor(uint32_t slot) const
+    {
+        AscendC::GlobalTensor<Element> gm;
+        gm.SetGlobalBuffer(reinterpret_cast<__gm__ Element *>(paramsPtr->ptrTensor[slot]));
+        return gm;
+    }
+
+    CATLASS_DEVICE
+    int64_t MatrixOffset(uint32_t slot) const
+    {
+        return static_cast<int64_t>(offset.row()) * paramsPtr->ldTensor[slot] + offset.column();
+    }
+
+    /// Copies a GM tensor into dst as fp32, count is the number of UB elements to cast.
+    template <class Element, class Layout>
+    CATLASS_DEVICE
+    void LoadFp32(
+        AscendC::LocalTensor<float> const &dst, AscendC::GlobalTensor<Element> const &src,
+        Layout const &layoutDst, Layout const &layoutSrc, uint32_t count
+    )
+    {
+        using CopyGmToUb = CopyGm2Ub<ArchTag, Gemm::GemmType<Element, Layout>>;
+        if constexpr (std::is_same_v<Element, float>) {
+            // dst may still be read by the vector instructions of other nodes
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_SYNC);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_SYNC);
+            CopyGmToUb{}(dst, src, layoutDst, layoutSrc);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_SYNC);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_SYNC);
+        } else {
+            auto ubStage = ubLoadStage.template ReinterpretCast<Element>();
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(EVENT_LOAD_STAGE);
+            CopyGmToUb{}(ubStage, src, layoutDst, layoutSrc);
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(EVENT_SYNC);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(EVENT_SYNC);
+            AscendC::Cast(dst, ubStage, AscendC::RoundMode::CAST_NONE, count);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(EVENT_LOAD_STAGE);
+        }
+    }
+
+    /// Writes an fp32 tile to a GM tensor of Element.
+    template <class Element>
+    CATLASS_DEVICE
+    void StoreFp32(
+        AscendC::GlobalTensor<Element> const &dst, AscendC::LocalTensor<float> const &src,
+        layout::RowMajor const &layoutDst
+    )
+    {
+        using CopyUbToGm = CopyUb2Gm<ArchTag, Gemm::GemmType<Element, layout::RowMajor>>;
+        if constexpr (std::is_same_v<Element, float>) {
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_SYNC);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_SYNC);
+            CopyUbToGm{}(dst, src, layoutDst, layoutUbTile);
+            // src passes through to the parent node, which may overwrite it
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_SYNC);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_SYNC);
+        } else {
+            auto ubStage = ubStoreStage.template ReinterpretCast<Element>();
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_STORE_STAGE);
+            AscendC::Cast(ubStage, src, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_SYNC);
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_SYNC);
+            CopyUbToGm{}(dst, ubStage, layoutDst, layoutUbTile);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_STORE_STAGE);
+        }
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Ops
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpRelu, AscendC::LocalTensor<float> const &dst, AscendC::LocalTensor<float> const &src,
+        AscendC::LocalTensor<float> const &)
+    {
+        AscendC::Relu(dst, src, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpExp, AscendC::LocalTensor<float> const &dst, AscendC::LocalTensor<float> const &src,
+        AscendC::LocalTensor<float> const &)
+    {
+        AscendC::Exp(dst, src, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpAbs, AscendC::LocalTensor<float> const &dst, AscendC::LocalTensor<float> const &src,
+        AscendC::LocalTensor<float> const &)
+    {
+        AscendC::Abs(dst, src, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpSilu, AscendC::LocalTensor<float> const &dst, AscendC::LocalTensor<float> const &src,
+        AscendC::LocalTensor<float> const &tmp)
+    {
+        TileSilu<ArchTag, ComputeType, TileShape>{}(dst, src, tmp);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpGelu, AscendC::LocalTensor<float> const &dst, AscendC::LocalTensor<float> const &src,
+        AscendC::LocalTensor<float> const &tmp)
+    {
+        TileGelu<ArchTag, ComputeType, TileShape>{}(dst, src, tmp);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpFastGelu, AscendC::LocalTensor<float> const &dst, AscendC::LocalTensor<float> const &src,
+        AscendC::LocalTensor<float> const &tmp)
+    {
+        TileFastGelu<ArchTag, ComputeType, TileShape>{}(dst, src, tmp);
+    }
+
+    template <uint32_t SCALAR>
+    CATLASS_DEVICE
+    void Apply(Fusion::OpScale<SCALAR>, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &src, AscendC::LocalTensor<float> const &)
+    {
+        AscendC::Muls(dst, src, paramsPtr->scalars[SCALAR], TileShape::COUNT);
+    }
+
+    template <uint32_t SCALAR>
+    CATLASS_DEVICE
+    void Apply(Fusion::OpAddScalar<SCALAR>, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &src, AscendC::LocalTensor<float> const &)
+    {
+        AscendC::Adds(dst, src, paramsPtr->scalars[SCALAR], TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpAdd, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &lhs, AscendC::LocalTensor<float> const &rhs)
+    {
+        AscendC::Add(dst, lhs, rhs, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpSub, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &lhs, AscendC::LocalTensor<float> const &rhs)
+    {
+        AscendC::Sub(dst, lhs, rhs, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpMul, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &lhs, AscendC::LocalTensor<float> const &rhs)
+    {
+        AscendC::Mul(dst, lhs, rhs, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpDiv, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &lhs, AscendC::LocalTensor<float> const &rhs)
+    {
+        AscendC::Div(dst, lhs, rhs, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpMax, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &lhs, AscendC::LocalTensor<float> const &rhs)
+    {
+        AscendC::Max(dst, lhs, rhs, TileShape::COUNT);
+    }
+
+    CATLASS_DEVICE
+    void Apply(Fusion::OpMin, AscendC::LocalTensor<float> const &dst,
+        AscendC::LocalTensor<float> const &lhs, AscendC::LocalTensor<float> const &rhs)
+    {
+        AscendC::Min(dst, lhs, rhs, TileShape::COUNT);
+    }
+
+    //////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    // Nodes, each one leaves its result in Tile(BASE)
+
+    template <uint32_t BASE>
+    CATLASS_DEVICE
+    void Visit(Fusion::Acc)
+    {
+        LoadFp32(Tile(BASE), gmC, layoutUbTile, layoutGmC, TileShape::COUNT);
+    }
+
+    template <uint32_t BASE, uint32_t TENSOR, class Element>
+    CATLASS_DEVICE
+    void Visit(Fusion::AuxLoad<TENSOR, Element>)
+    {
+        auto gmTile = Tensor<Element>(TENSOR)[MatrixOffset(TENSOR)];
+        layout::RowMajor layoutGmTile{actualShape.row(), actualShape.column(), paramsPtr->ldTensor[TENSOR]};
+        LoadFp32(Tile(BASE), gmTile, layoutUbTile, layoutGmTile, TileShape::COUNT);
+    }
+
+    template <uint32_t BASE, uint32_t TENSOR, class Element>
+    CATLASS_DEVICE
+    void Visit(Fusion::RowBroadcast<TENSOR, Element>)
+    {
+        auto gmTile = Tensor<Element>(TENSOR)[offset.column()];
+        layout::VectorLayout layoutVector{actualShape.column()};
+        // Load into the first row, then copy it to the others
+        LoadFp32(Tile(BASE), gmTile, layoutVector, layoutVector, TileShape::COLUMN);
+        AscendC::PipeBarrier<PIPE_V>();
+        TileBroadcastInplaceByRow<ArchTag, ComputeType, TileShape>{}(Tile(BASE));
+    }
+
+    template <uint32_t BASE, uint32_t TENSOR, class Element>
+    CATLASS_DEVICE
+    void Visit(Fusion::ColBroadcast<TENSOR, Element>)
+    {
+        auto gmTile = Tensor<Element>(TENSOR)[offset.row()];
+        layout::VectorLayout layoutVector{actualShape.row()};
+        LoadFp32(ubVector, gmTile, layoutVector, layoutVector, TileShape::ROW);
+        AscendC::PipeBarrier<PIPE_V>();
+
+        // Fill the first block of every row with its value, then copy the block along the row
+        AscendC::BrcbRepeatParams repeatParams;
+        repeatParams.dstBlkStride = TileShape::COLUMN / ELE_NUM_PER_BLK;
+        repeatParams.dstRepStride = BLK_NUM_PER_VECTOR_FRACTAL * TileShape::COLUMN / ELE_NUM_PER_BLK;
+        uint8_t repeatTimes = static_cast<uint8_t>(TileShape::ROW / BLK_NUM_PER_VECTOR_FRACTAL);
+        AscendC::Brcb(Tile(BASE), ubVector, repeatTimes, repeatParams);
+        AscendC::PipeBarrier<PIPE_V>();
+        TileBroadcastInplaceByColumn<ArchTag, ComputeType, TileShape>{}(Tile(BASE));
+    }
+
+    template <uint32_t BASE, class Op, class Child>
+    CATLASS_DEVICE
+    void Visit(Fusion::Compute<Op, Child>)
+    {
+        Visit<BASE>(Child{});
+        AscendC::PipeBarrier<PIPE_V>();
+        Apply(Op{}, Tile(BASE), Tile(BASE), Tile(BASE + 1));
+    }
+
+    template <uint32_t BASE, class Op, class Lhs, class Rhs>
+    CATLASS_DEVICE
+    void Visit(Fusion::Compute<Op, Lhs, Rhs>)
+    {
+        if constexpr (Fusion::VisitorTraits<Fusion::Compute<Op, Lhs, Rhs>>::LHS_FIRST) {
+            Visit<BASE>(Lhs{});
+            Visit<BASE + 1>(Rhs{});
+            AscendC::PipeBarrier<PIPE_V>();
+            Apply(Op{}, Tile(BASE), Tile(BASE), Tile(BASE + 1));
+        } else {
+            Visit<BASE>(Rhs{});
+            Visit<BASE + 1>(Lhs{});
+            AscendC::PipeBarrier<PIPE_V>();
+            Apply(Op{}, Tile(BASE), Tile(BASE + 1), Tile(BASE));
+        }
+    }
+
+    template <uint32_t BASE, uint32_t TENSOR, class Child>
+    CATLASS_DEVICE
+    void Visit(Fusion::ColReduce<TENSOR, Child>)
+    {
+        Visit<BASE>(Child{});
+        AscendC::PipeBarrier<PIPE_V>();
+        // Only the valid rows are summed, the rows past the edge of the problem hold garbage
+        auto ubTile = Tile(BASE);
+        AscendC::Adds(ubVector, ubTile, 0.0f, TileShape::COLUMN);
+        for (uint32_t row = 1; row < actualShape.row(); ++row) {
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Add(ubVector, ubVector, ubTile[row * TileShape::COLUMN], TileShape::COLUMN);
+        }
+
+        auto gmTile = Tensor<float>(TENSOR)[offset.column()];
+        layout::VectorLayout layoutVector{actualShape.column()};
+        AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(EVENT_SYNC);
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(EVENT_SYNC);
+        AscendC::SetAtomicAdd<float>();
+        CopyUb2Gm<ArchTag, Gemm::GemmType<float, layout::VectorLayout>>{}(
+            gmTile, ubVector, layoutVector, layoutVector);
+        AscendC::SetAtomicNone();
+        AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(EVENT_SYNC);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(EVENT_SYNC);
+    }
+
+    template <uint32_t BASE, uint32_t TENSOR, class Element, class Child>
+    CATLASS_DEVICE
+    void Visit(Fusion::Store<TENSOR, Element, Child>)
+    {
+        Visit<BASE>(Child{});
+        AscendC::PipeBarrier<PIPE_V>();
+        auto gmTile = Tensor<Element>(TENSOR)[MatrixOffset(TENSOR)];
+        layout::RowMajor layoutGmTile{actualShape.row(), actualShape.column(), paramsPtr->ldTensor[TENSOR]};
+        StoreFp32(gmTile, Tile(BASE), layoutGmTile);
+    }
+
+    AscendC::LocalTensor<float> ubTiles;
+    AscendC::LocalTensor<uint8_t> ubLoadStage;
+    AscendC::LocalTensor<uint8_t> ubStoreStage;
+    AscendC::LocalTensor<float> ubVector;
+
+    Params const *paramsPtr{nullptr};
+    AscendC::GlobalTensor<ElementC> gmC;
+    layout::RowMajor layoutGmC;
+    layout::RowMajor layoutUbTile;
+    MatrixCoord offset;
+    MatrixCoord actualShape;
+};
+
+} // namespace Catlass::Epilogue::Tile
+
+#endif // CATLASS_EPILOGUE_TILE_TILE_VISITOR_HPP
@@ -75,8 +75,8 @@ public:
 
     static constexpr bool ENABLE_UNIT_FLAG = DispatchPolicy::ENABLE_UNIT_FLAG;
     static constexpr uint32_t STAGES = DispatchPolicy::STAGES;
-    static constexpr uint32_t L1A_SIZE = L1TileShape::M * L1TileShape::K * sizeof(ElementA);
-    static constexpr uint32_t L1B_SIZE = L1TileShape::N * L1TileShape::K * sizeof(ElementB);
+    static constexpr uint32_t L1A_SIZE = L1TileShape::M * L1TileShape::K * SizeOfBits<ElementA>::VALUE / 8;
+    static constexpr uint32_t L1B_SIZE = L1TileShape::N * L1TileShape::K * SizeOfBits<ElementB>::VALUE / 8;
     static constexpr uint32_t L0A_SIZE = ArchTag::L0A_SIZE;
     static constexpr uint32_t L0B_SIZE = ArchTag::L0B_SIZE;
     static constexpr uint32_t L0A_PINGPONG_BUF_SIZE = L0A_SIZE / STAGES;
@@ -89,8 +89,8 @@ public:
     static_assert((L1A_SIZE * STAGES + L1B_SIZE * STAGES) <= ArchTag::L1_SIZE, "L1TileShape exceeding the L1 space!");
 
     // Check L0TileShape
-    static constexpr uint32_t L0A_TILE_SIZE = L0TileShape::M * L0TileShape::K * sizeof(ElementA);
-    static constexpr uint32_t L0B_TILE_SIZE = L0TileShape::K * L0TileShape::N * sizeof(ElementB);
+    static constexpr uint32_t L0A_TILE_SIZE = L0TileShape::M * L0TileShape::K * SizeOfBits<ElementA>::VALUE / 8;
+    static constexpr uint32_t L0B_TILE_SIZE = L0TileShape::K * L0TileShape::N * SizeOfBits<ElementB>::VALUE / 8;
     static_assert((L0A_TILE_SIZE * STAGES) <= L0A_SIZE, "L0TileShape exceeding the L0A space!");
     static_assert((L0B_TILE_SIZE * STAGES) <= L0B_SIZE, "L0TileShape exceeding the L0B space!");
 
@@ -141,12 +141,15 @@ public:
     }
 
     /// Perform a block-scoped matrix multiply-accumulate
+    /// quantArgs are passed to a quantizing CopyL0CToGm (see QuantTileCopy): the encoded quant scalar for
+    /// PER_TENSOR, the L1 tensor of the per-column quant parameters of this block for PER_CHANNEL.
+    template <class... QuantArgs>
     CATLASS_DEVICE
     void operator()(
         AscendC::GlobalTensor<ElementA> const &gmA, LayoutA const &layoutA,
         AscendC::GlobalTensor<ElementB> const &gmB, LayoutB const &layoutB,
         AscendC::GlobalTensor<ElementC> const &gmC, LayoutC const &layoutC,
-        GemmCoord const &actualShape)
+        GemmCoord const &actualShape, QuantArgs const &... quantArgs)
     {
         uint32_t mRound = RoundUp<L1AAlignHelper::M_ALIGNED>(actualShape.m());
         uint32_t nRound = RoundUp<L1BAlignHelper::N_ALIGNED>(actualShape.n());
@@ -312,10 +315,10 @@ public:
         if constexpr (!ENABLE_UNIT_FLAG) {
             AscendC::SetFlag<AscendC::HardEvent::M_FIX>(EVENT_ID0);
             AscendC::WaitFlag<AscendC::HardEvent::M_FIX>(EVENT_ID0);
-            copyL0CToGm(gmC, l0CTensor, layoutBlock, layoutInL0C);
+            copyL0CToGm(gmC, l0CTensor, quantArgs..., layoutBlock, layoutInL0C);
             AscendC::SetFlag<AscendC::HardEvent::FIX_M>(EVENT_ID0);
         } else {
-            copyL0CToGm(gmC, l0CTensor, layoutBlock, layoutInL0C, 0b11);
+            copyL0CToGm(gmC, l0CTensor, quantArgs..., layoutBlock, layoutInL0C, 0b11);
         }
     }
 
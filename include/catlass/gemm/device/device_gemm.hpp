@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_DEVICE_DEVICE_GEMM_HPP
+#define CATLASS_GEMM_DEVICE_DEVICE_GEMM_HPP
+
+#include <acl/acl.h>
+
+#include "catlass/catlass.hpp"
+#include "catlass/status.hpp"
+#include "catlass/gemm/device/kernel_adapter.hpp"
+
+namespace Catlass::Gemm::Device {
+
+/// Host adapter of a kernel of gemm/kernel or gemv/kernel. Every such kernel provides
+///   struct Arguments;                                         host view of the problem
+///   static bool CanImplement(Arguments const &);              whether the kernel supports the arguments
+///   static size_t GetWorkspaceSize(Arguments const &);        bytes of device workspace, 0 if none
+///   static Params ToUnderlyingArguments(Arguments const &, uint8_t *workspace);
+/// so the adapter can validate, size and launch any of them. The workspace is owned by the caller, it may come
+/// from any allocator (e.g. a stream ordered pool) and must stay valid until the launch has finished.
+template <class Kernel>
+class DeviceGemm {
+public:
+    using Arguments = typename Kernel::Arguments;
+    using Params = typename Kernel::Params;
+
+    DeviceGemm() {}
+    ~DeviceGemm() {}
+
+    static Status CanImplement(Arguments const &args)
+    {
+        return Kernel::CanImplement(args) ? Status::kSuccess : Status::kErrorInvalidProblem;
+    }
+
+    static size_t GetWorkspaceSize(Arguments const &args)
+    {
+        return Kernel::GetWorkspaceSize(args);
+    }
+
+    /// Validate the arguments and build the kernel parameters on top of the workspace.
+    Status Initialize(Arguments const &args, uint8_t *workspace = nullptr)
+    {
+        if (!Kernel::CanImplement(args)) {
+            return Status::kErrorInvalidProblem;
+        }
+        if (workspace == nullptr && Kernel::GetWorkspaceSize(args) > 0) {
+            return Status::kErrorWorkspaceNull;
+        }
+        params = Kernel::ToUnderlyingArguments(args, workspace);
+        initialized = true;
+        return Status::kSuccess;
+    }
+
+    /// Launch the kernel with the parameters of the last Initialize, asynchronously on the stream.
+    Status Run(aclrtStream stream, uint32_t blockDim, uint64_t fftsAddr = 0)
+    {
+        if (!initialized) {
+            return Status::kErrorNotInitialized;
+        }
+        KernelAdapter<Kernel><<<blockDim, nullptr, stream>>>(params, fftsAddr);
+        return Status::kSuccess;
+    }
+
+    Status operator()(Arguments const &args, uint8_t *workspace, aclrtStream stream, uint32_t blockDim,
+        uint64_t fftsAddr = 0)
+    {
+        Status status = Initialize(args, workspace);
+        if (status != Status::kSuccess) {
+            return status;
+        }
+        return Run(stream, blockDim, fftsAddr);
+    }
+
+private:
+    Params params;
+    bool initialized{false};
+};
+
+}  // namespace Catlass::Gemm::Device
+
+#endif  // CATLASS_GEMM_DEVICE_DEVICE_GEMM_HPP
@@ -0,0 +1,33 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_DEVICE_KERNEL_ADAPTER_HPP
+#define CATLASS_GEMM_DEVICE_KERNEL_ADAPTER_HPP
+
+#include "catlass/catlass.hpp"
+
+namespace Catlass {
+
+/// Entry of every kernel launched through a device adapter. The FFTS address is only needed by kernels that
+/// synchronize AIC and AIV cores, pure cube or vector kernels may pass 0.
+template <class Kernel>
+CATLASS_GLOBAL
+void KernelAdapter(typename Kernel::Params params, uint64_t fftsAddr)
+{
+    if (fftsAddr != 0) {
+        AscendC::SetSyncBaseAddr(fftsAddr);
+    }
+    Kernel kernel;
+    kernel(params);
+}
+
+}  // namespace Catlass
+
+#endif  // CATLASS_GEMM_DEVICE_KERNEL_ADAPTER_HPP
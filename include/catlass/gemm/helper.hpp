@@ -12,6 +12,7 @@
 #define CATLASS_GEMM_HELPER_HPP
 
 #include "catlass/catlass.hpp"
+#include "catlass/arch/arch.hpp"
 #include "catlass/layout/layout.hpp"
 #include "catlass/gemm/gemm_type.hpp"
 #include "tla/layout.hpp"
@@ -25,7 +26,7 @@ struct L1AlignHelper {
 
 template<class Element>
 struct L1AlignHelper<Element, layout::RowMajor> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = C0_NUM_PER_FRACTAL;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = ELE_NUM_PER_C0;
@@ -33,7 +34,7 @@ struct L1AlignHelper<Element, layout::RowMajor> {
 
 template<class Element>
 struct L1AlignHelper<Element, layout::ColumnMajor> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = C0_NUM_PER_FRACTAL;
@@ -41,7 +42,7 @@ struct L1AlignHelper<Element, layout::ColumnMajor> {
 
 template<class Element>
 struct L1AlignHelper<Element, layout::PaddingRowMajor> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = C0_NUM_PER_FRACTAL;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = ELE_NUM_PER_C0;
@@ -49,7 +50,7 @@ struct L1AlignHelper<Element, layout::PaddingRowMajor> {
 
 template<class Element>
 struct L1AlignHelper<Element, layout::PaddingColumnMajor> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = C0_NUM_PER_FRACTAL;
@@ -57,7 +58,7 @@ struct L1AlignHelper<Element, layout::PaddingColumnMajor> {
 
 template<class Element>
 struct L1AlignHelper<Element, layout::zN> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = C0_NUM_PER_FRACTAL;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = ELE_NUM_PER_C0;
@@ -65,12 +66,14 @@ struct L1AlignHelper<Element, layout::zN> {
 
 template<class Element>
 struct L1AlignHelper<Element, layout::nZ> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = C0_NUM_PER_FRACTAL;
 };
 
+/// Accumulator of a product of ElementA and ElementB. The AIV compute paths (epilogues, GEMV on AIV) use every
+/// specialization; the cube unit additionally needs CubeOperandSupport.
 template<class ElementA, class ElementB>
 struct ElementAccumulatorSelector {
     static_assert(DEPENDENT_FALSE<ElementA>,
@@ -88,15 +91,83 @@ struct ElementAccumulatorSelector<float, float> {
 };
 
 template<>
-struct ElementAccumulatorSelector<int8_t, int8_t> {
+struct ElementAccumulatorSelector<bfloat16_t, bfloat16_t> {
+    using ElementAccumulator = float;
+};
+
+template<>
+struct ElementAccumulatorSelector<AscendC::int4b_t, AscendC::int4b_t> {
     using ElementAccumulator = int32_t;
 };
 
+// Mixed floating point operands are promoted to fp32
 template<>
-struct ElementAccumulatorSelector<bfloat16_t, bfloat16_t> {
+struct ElementAccumulatorSelector<half, float> {
+    using ElementAccumulator = float;
+};
+
+template<>
+struct ElementAccumulatorSelector<float, half> {
+    using ElementAccumulator = float;
+};
+
+template<>
+struct ElementAccumulatorSelector<bfloat16_t, float> {
+    using ElementAccumulator = float;
+};
+
+template<>
+struct ElementAccumulatorSelector<float, bfloat16_t> {
+    using ElementAccumulator = float;
+};
+
+template<>
+struct ElementAccumulatorSelector<half, bfloat16_t> {
+    using ElementAccumulator = float;
+};
+
+template<>
+struct ElementAccumulatorSelector<bfloat16_t, half> {
     using ElementAccumulator = float;
 };
 
+// Integer operands mixed with floating point ones have no common accumulator
+template<class ElementB>
+struct ElementAccumulatorSelector<int8_t, ElementB> {
+    static_assert(DEPENDENT_FALSE<ElementB>,
+        "int8_t is only accumulated with int8_t (to int32_t). For int8_t weights with floating point activations, "
+        "dequantize the weight first, see Gemm::Kernel::WeightOnlyQuantMatmul. The cube has no mixed int4b_t x int8_t "
+        "mode either, widen the int4b_t operand to int8_t.");
+};
+
+template<class ElementA>
+struct ElementAccumulatorSelector<ElementA, int8_t> {
+    static_assert(DEPENDENT_FALSE<ElementA>,
+        "int8_t is only accumulated with int8_t (to int32_t). For int8_t weights with floating point activations, "
+        "dequantize the weight first, see Gemm::Kernel::WeightOnlyQuantMatmul. The cube has no mixed int4b_t x int8_t "
+        "mode either, widen the int4b_t operand to int8_t.");
+};
+
+template<>
+struct ElementAccumulatorSelector<int8_t, int8_t> {
+    using ElementAccumulator = int32_t;
+};
+
+/// Operand pairs the cube unit multiplies. Both operands must have the same element type, the products being
+/// accumulated in L0C as fp32 (half, bfloat16_t, float) or int32_t (int8_t, int4b_t). L0C does not hold half
+/// accumulators; half and bfloat16_t results are produced by the fixpipe cast, see CopyL0CToGmQuantMode.
+template<class ArchTag, class ElementA, class ElementB>
+struct CubeOperandSupport {
+    static constexpr bool VALUE = false;
+};
+
+template<class Element>
+struct CubeOperandSupport<Arch::AtlasA2, Element, Element> {
+    static constexpr bool VALUE = std::is_same_v<Element, half> || std::is_same_v<Element, bfloat16_t> ||
+        std::is_same_v<Element, float> || std::is_same_v<Element, int8_t> ||
+        std::is_same_v<Element, AscendC::int4b_t>;
+};
+
 template<class GmAType>
 struct L1ATypeSelector {
     static_assert(DEPENDENT_FALSE<GmAType>,
@@ -113,6 +184,11 @@ struct L1ATypeSelector<Gemm::GemmType<Element, layout::PaddingRowMajor>> {
     using L1AType = Gemm::GemmType<Element, layout::zN, AscendC::TPosition::A1>;
 };
 
+template<class Element>
+struct L1ATypeSelector<Gemm::GemmType<Element, layout::zN>> {
+    using L1AType = Gemm::GemmType<Element, layout::zN, AscendC::TPosition::A1>;
+};
+
 template<class Element>
 struct L1ATypeSelector<Gemm::GemmType<Element, layout::ColumnMajor>> {
     using L1AType = Gemm::GemmType<Element, layout::nZ, AscendC::TPosition::A1>;
@@ -123,6 +199,11 @@ struct L1ATypeSelector<Gemm::GemmType<Element, layout::PaddingColumnMajor>> {
     using L1AType = Gemm::GemmType<Element, layout::nZ, AscendC::TPosition::A1>;
 };
 
+template<class Element>
+struct L1ATypeSelector<Gemm::GemmType<Element, layout::nZ>> {
+    using L1AType = Gemm::GemmType<Element, layout::nZ, AscendC::TPosition::A1>;
+};
+
 template<class GmBType>
 struct L1BTypeSelector {
     static_assert(DEPENDENT_FALSE<GmBType>,
@@ -186,7 +267,7 @@ struct L1AlignHelperTla {
 
 template<class Element, class Layout>
 struct L1AlignHelperTla<Element, Layout, std::enable_if_t<tla::detail::isRowMajor<Layout>::value>> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = C0_NUM_PER_FRACTAL;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = ELE_NUM_PER_C0;
@@ -194,7 +275,7 @@ struct L1AlignHelperTla<Element, Layout, std::enable_if_t<tla::detail::isRowMajo
 
 template<class Element, class Layout>
 struct L1AlignHelperTla<Element, Layout, std::enable_if_t<tla::detail::isColumnMajor<Layout>::value>> {
-    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
     static constexpr uint32_t M_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t K_ALIGNED = ELE_NUM_PER_C0;
     static constexpr uint32_t N_ALIGNED = C0_NUM_PER_FRACTAL;
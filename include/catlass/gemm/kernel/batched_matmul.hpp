@@ -56,10 +56,10 @@ public:
         int64_t strideC;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(uint32_t batchCount_, GemmCoord const &problemShape_,
                GM_ADDR ptrA_, LayoutA layoutA_, int64_t strideA_,
                GM_ADDR ptrB_, LayoutB layoutB_, int64_t strideB_,
@@ -70,6 +70,39 @@ public:
               ptrC(ptrC_), layoutC(layoutC_), strideC(strideC_) {}
     };
 
+    struct Arguments {
+        uint32_t batchCount;
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        int64_t strideA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        int64_t strideB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        int64_t strideC;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.batchCount, args.problemShape,
+            args.ptrA, args.layoutA, args.strideA,
+            args.ptrB, args.layoutB, args.strideB,
+            args.ptrC, args.layoutC, args.strideC};
+    }
+
     // Methods
     CATLASS_DEVICE
     BatchedMatmul() {}
@@ -0,0 +1,652 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_DYNAMIC_QUANT_MATMUL_HPP
+#define CATLASS_GEMM_KERNEL_DYNAMIC_QUANT_MATMUL_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/detail/callback.hpp"
+#include "catlass/epilogue/tile/copy_gm_to_ub.hpp"
+#include "catlass/epilogue/tile/copy_ub_to_gm.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Symmetric per-token int8 quantization of a row major activation on AIV.
+/// Every row gets scale = absmax / 127 and q = rint(x * (1 / scale)), computed in fp32. A row is read in chunks of
+/// COMPUTE_LENGTH elements, once for the absmax and once for the quantization; a row of at most COMPUTE_LENGTH
+/// elements stays in UB between the two passes and is read from GM only once.
+template<
+    class ArchTag_,
+    class ElementIn_,
+    class ElementOut_,
+    uint32_t COMPUTE_LENGTH
+>
+struct PerTokenQuantMatrixBlock {
+public:
+    using ArchTag = ArchTag_;
+    using ElementIn = ElementIn_;
+    using ElementOut = ElementOut_;
+    using ElementScale = float;
+    using LayoutIn = layout::RowMajor;
+    using LayoutOut = layout::RowMajor;
+    using CopyGm2Ub = Catlass::Epilogue::Tile::CopyGm2Ub<ArchTag, Gemm::GemmType<ElementIn, layout::RowMajor>>;
+    using CopyUb2Gm = Catlass::Epilogue::Tile::CopyUb2Gm<ArchTag, Gemm::GemmType<ElementOut, layout::RowMajor>>;
+    using CopyUb2GmScale =
+        Catlass::Epilogue::Tile::CopyUb2Gm<ArchTag, Gemm::GemmType<ElementScale, layout::VectorLayout>>;
+
+    static_assert(std::is_same_v<ElementIn, half>, "The activation of PerTokenQuantMatrixBlock must be half");
+    static_assert(std::is_same_v<ElementOut, int8_t>, "The quantized activation must be int8_t");
+    static_assert(COMPUTE_LENGTH % (BYTE_PER_C0 / sizeof(ElementOut)) == 0,
+        "COMPUTE_LENGTH must be a multiple of the int8 elements of a block");
+
+    static constexpr float QUANT_MAX = 127.0f;
+
+    CopyGm2Ub copyGm2Ub;
+    CopyUb2Gm copyUb2Gm;
+    CopyUb2GmScale copyUb2GmScale;
+
+    CATLASS_DEVICE
+    PerTokenQuantMatrixBlock(Arch::Resource<ArchTag> &resource)
+    {
+        uint32_t ubOffset = 0;
+        for (uint32_t i = 0; i < BUFFER_NUM; ++i) {
+            ubInList[i] = resource.ubBuf.template GetBufferByByte<ElementIn>(ubOffset);
+            ubOffset += COMPUTE_LENGTH * sizeof(ElementIn);
+            ubOutList[i] = resource.ubBuf.template GetBufferByByte<ElementOut>(ubOffset);
+            ubOffset += COMPUTE_LENGTH * sizeof(ElementOut);
+        }
+        ubAbs = resource.ubBuf.template GetBufferByByte<ElementIn>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementIn);
+        ubMax = resource.ubBuf.template GetBufferByByte<ElementIn>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementIn);
+        ubReduceWork = resource.ubBuf.template GetBufferByByte<ElementIn>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(ElementIn);
+        ubAbsMax = resource.ubBuf.template GetBufferByByte<ElementIn>(ubOffset);
+        ubOffset += BYTE_PER_BLK;
+        ubFp32 = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(float);
+        ubInt32 = resource.ubBuf.template GetBufferByByte<int32_t>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(int32_t);
+        ubHalf = resource.ubBuf.template GetBufferByByte<half>(ubOffset);
+        ubOffset += COMPUTE_LENGTH * sizeof(half);
+        ubScale = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+    }
+
+    /// Quantizes the rows of src into dst and writes one fp32 scale per row to scale.
+    /// The rows are split evenly across all the AIV cores of the launch.
+    CATLASS_DEVICE
+    void operator()(AscendC::GlobalTensor<ElementOut> const &dst,
+                    AscendC::GlobalTensor<ElementIn> const &src,
+                    AscendC::GlobalTensor<ElementScale> const &scale,
+                    LayoutOut layoutDst, LayoutIn layoutSrc)
+    {
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        uint32_t aivId = AscendC::GetBlockIdx();
+
+        uint32_t rowsNum = layoutSrc.shape(0);
+        uint32_t rowLen = layoutSrc.shape(1);
+        uint32_t rowsPerAiv = rowsNum / aivNum;
+        uint32_t rowsRemain = rowsNum % aivNum;
+        if (aivId < rowsRemain) {
+            rowsPerAiv++;
+        }
+        uint32_t rowBegin = aivId * rowsPerAiv;
+        if (aivId >= rowsRemain) {
+            rowBegin += rowsRemain;
+        }
+
+        uint32_t chunksPerRow = CeilDiv(rowLen, COMPUTE_LENGTH);
+        // A single chunk is kept in UB for the second pass
+        bool rowResident = (chunksPerRow == 1);
+
+        for (uint32_t i = 0; i < BUFFER_NUM; ++i) {
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventIds[i]);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventIds[i]);
+        }
+
+        uint32_t scaleCount = 0;
+        uint32_t scaleRowBegin = rowBegin;
+        for (uint32_t rowIdx = rowBegin; rowIdx < rowBegin + rowsPerAiv; ++rowIdx) {
+            // First pass, the absmax of the row
+            AscendC::Duplicate(ubMax, static_cast<ElementIn>(0), COMPUTE_LENGTH);
+            AscendC::PipeBarrier<PIPE_V>();
+            for (uint32_t chunkIdx = 0; chunkIdx < chunksPerRow; ++chunkIdx) {
+                uint32_t actualLen = ChunkLen(rowLen, chunkIdx);
+                LoadChunk(src, layoutSrc, rowIdx, chunkIdx, actualLen);
+                AscendC::Abs(ubAbs, ubInList[inBufferIndex], actualLen);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Max(ubMax, ubMax, ubAbs, actualLen);
+                // The next Abs overwrites ubAbs, the next Max or ReduceMax reads ubMax
+                AscendC::PipeBarrier<PIPE_V>();
+                if (!rowResident) {
+                    AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventIds[inBufferIndex]);
+                    inBufferIndex = (inBufferIndex + 1 < BUFFER_NUM) ? (inBufferIndex + 1) : 0;
+                }
+            }
+            AscendC::ReduceMax(ubAbsMax, ubMax, ubReduceWork, COMPUTE_LENGTH);
+            AscendC::SetFlag<AscendC::HardEvent::V_S>(EVENT_ID0);
+            AscendC::WaitFlag<AscendC::HardEvent::V_S>(EVENT_ID0);
+            float absMax = static_cast<float>(ubAbsMax.GetValue(0));
+            float rowScale = (absMax == 0.0f) ? 1.0f : absMax / QUANT_MAX;
+            float rowScaleInv = 1.0f / rowScale;
+            ubScale.SetValue(scaleCount++, rowScale);
+
+            // Second pass, the quantized row
+            for (uint32_t chunkIdx = 0; chunkIdx < chunksPerRow; ++chunkIdx) {
+                uint32_t actualLen = ChunkLen(rowLen, chunkIdx);
+                if (!rowResident) {
+                    LoadChunk(src, layoutSrc, rowIdx, chunkIdx, actualLen);
+                }
+                auto &ubIn = ubInList[inBufferIndex];
+                AscendC::Cast(ubFp32, ubIn, AscendC::RoundMode::CAST_NONE, actualLen);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE2>(eventIds[inBufferIndex]);
+                inBufferIndex = (inBufferIndex + 1 < BUFFER_NUM) ? (inBufferIndex + 1) : 0;
+                AscendC::PipeBarrier<PIPE_V>();
+
+                AscendC::Muls(ubFp32, ubFp32, rowScaleInv, actualLen);
+                AscendC::PipeBarrier<PIPE_V>();
+                // Round once to an integer, the later casts are exact for |q| <= 127
+                AscendC::Cast(ubInt32, ubFp32, AscendC::RoundMode::CAST_RINT, actualLen);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Cast(ubFp32, ubInt32, AscendC::RoundMode::CAST_NONE, actualLen);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Cast(ubHalf, ubFp32, AscendC::RoundMode::CAST_NONE, actualLen);
+                // Also orders the reuse of ubFp32 by the next chunk and row
+                AscendC::PipeBarrier<PIPE_V>();
+
+                auto &ubOut = ubOutList[outBufferIndex];
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventIds[outBufferIndex]);
+                AscendC::Cast(ubOut, ubHalf, AscendC::RoundMode::CAST_NONE, actualLen);
+                AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventIds[outBufferIndex]);
+                AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventIds[outBufferIndex]);
+                MatrixCoord offset{rowIdx, chunkIdx * COMPUTE_LENGTH};
+                copyUb2Gm(dst[layoutDst.GetOffset(offset)], ubOut, LayoutOut{1, actualLen}, LayoutOut{1, actualLen});
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_V>(eventIds[outBufferIndex]);
+                outBufferIndex = (outBufferIndex + 1 < BUFFER_NUM) ? (outBufferIndex + 1) : 0;
+            }
+
+            if ((scaleCount == SCALE_BUFFER_LEN) || (rowIdx + 1 == rowBegin + rowsPerAiv)) {
+                AscendC::SetFlag<AscendC::HardEvent::S_MTE3>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::S_MTE3>(EVENT_ID0);
+                layout::VectorLayout layoutScale{scaleCount};
+                copyUb2GmScale(scale[scaleRowBegin], ubScale, layoutScale, layoutScale);
+                AscendC::SetFlag<AscendC::HardEvent::MTE3_S>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE3_S>(EVENT_ID0);
+                scaleRowBegin += scaleCount;
+                scaleCount = 0;
+            }
+        }
+
+        for (uint32_t i = 0; i < BUFFER_NUM; ++i) {
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventIds[i]);
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_V>(eventIds[i]);
+        }
+    }
+
+    CATLASS_DEVICE
+    ~PerTokenQuantMatrixBlock() {}
+
+private:
+    static const uint32_t BUFFER_NUM = 2;
+    /// Scales buffered in UB before one store to GM
+    static const uint32_t SCALE_BUFFER_LEN = 256;
+
+    CATLASS_DEVICE
+    uint32_t ChunkLen(uint32_t rowLen, uint32_t chunkIdx) const
+    {
+        uint32_t remain = rowLen - chunkIdx * COMPUTE_LENGTH;
+        return (remain < COMPUTE_LENGTH) ? remain : COMPUTE_LENGTH;
+    }
+
+    CATLASS_DEVICE
+    void LoadChunk(AscendC::GlobalTensor<ElementIn> const &src, LayoutIn const &layoutSrc,
+        uint32_t rowIdx, uint32_t chunkIdx, uint32_t actualLen)
+    {
+        auto &ubIn = ubInList[inBufferIndex];
+        AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>(eventIds[inBufferIndex]);
+        MatrixCoord offset{rowIdx, chunkIdx * COMPUTE_LENGTH};
+        copyGm2Ub(ubIn, src[layoutSrc.GetOffset(offset)], LayoutIn{1, actualLen}, LayoutIn{1, actualLen});
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventIds[inBufferIndex]);
+        AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventIds[inBufferIndex]);
+    }
+
+    AscendC::LocalTensor<ElementIn> ubInList[BUFFER_NUM];
+    AscendC::LocalTensor<ElementOut> ubOutList[BUFFER_NUM];
+    AscendC::LocalTensor<ElementIn> ubAbs;
+    AscendC::LocalTensor<ElementIn> ubMax;
+    AscendC::LocalTensor<ElementIn> ubReduceWork;
+    AscendC::LocalTensor<ElementIn> ubAbsMax;
+    AscendC::LocalTensor<float> ubFp32;
+    AscendC::LocalTensor<int32_t> ubInt32;
+    AscendC::LocalTensor<half> ubHalf;
+    AscendC::LocalTensor<ElementScale> ubScale;
+    AscendC::TEventID eventIds[BUFFER_NUM] = {EVENT_ID0, EVENT_ID1};
+    uint32_t inBufferIndex{0};
+    uint32_t outBufferIndex{0};
+
+    static constexpr uint32_t UB_BYTES = BUFFER_NUM * COMPUTE_LENGTH * (sizeof(ElementIn) + sizeof(ElementOut)) +
+        3 * COMPUTE_LENGTH * sizeof(ElementIn) + BYTE_PER_BLK +
+        COMPUTE_LENGTH * (sizeof(float) + sizeof(int32_t) + sizeof(half)) + SCALE_BUFFER_LEN * sizeof(ElementScale);
+    static_assert(UB_BYTES <= ArchTag::UB_SIZE, "Excedding the UB space!");
+};
+
+/// W8A8 matmul over an fp16 activation that is quantized per token inside the kernel.
+/// The AIV cores run PrologueA one L1TileShape::M row tile at a time, writing the int8 activation into the workspace
+/// and its per-token scales to ptrPerTokenScale, where they stay for the caller. All the AIVs share the rows of a tile
+/// and flag their cube core once the whole tile is quantized, so the cube cores compute the int32 accumulators of a
+/// tile into the multistage workspace while the next tiles are quantized. Between two tiles the AIV cores dequantize
+/// the blocks of the previous tiles with BlockEpilogue as in QuantMatmulMultiStageWorkspace.
+template <
+    class PrologueA,
+    class BlockMmad_,
+    class BlockEpilogue_,
+    class BlockScheduler_,
+    uint32_t WORKSPACE_STAGES_
+>
+class DynamicQuantMatmul {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+    using ElementX = typename PrologueA::ElementIn;
+    using LayoutX = typename PrologueA::LayoutIn;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementScale = typename BlockEpilogue::ElementScale;
+    using LayoutScale = typename BlockEpilogue::LayoutScale;
+    using ElementPerTokenScale = typename BlockEpilogue::ElementPerTokenScale;
+    using LayoutPerTokenScale = typename BlockEpilogue::LayoutPerTokenScale;
+    using ElementD = typename BlockEpilogue::ElementD;
+    using LayoutD = typename BlockEpilogue::LayoutD;
+    using EpilogueParams = typename BlockEpilogue::Params;
+
+    using BlockScheduler = BlockScheduler_;
+    static constexpr uint32_t WORKSPACE_STAGES = WORKSPACE_STAGES_;
+
+    static_assert(std::is_same_v<ElementA, typename PrologueA::ElementOut> &&
+        std::is_same_v<LayoutA, typename PrologueA::LayoutOut>,
+        "The output of PrologueA must be the A operand of BlockMmad");
+    static_assert(std::is_same_v<ElementPerTokenScale, typename PrologueA::ElementScale>,
+        "The scales of PrologueA must be the per-token scales of BlockEpilogue");
+    static_assert(2 * WORKSPACE_STAGES + 1 <= Arch::AIV_INTER_BLOCK_BARRIER,
+        "The flags of the stages and of the quantized tiles must not reach the AIV inter-block barrier flag");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        __gm__ ElementX *ptrX;
+        LayoutX layoutX;
+        __gm__ ElementB *ptrB;
+        LayoutB layoutB;
+        __gm__ ElementScale *ptrScale;
+        LayoutScale layoutScale;
+        __gm__ ElementPerTokenScale *ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        __gm__ ElementD *ptrD;
+        LayoutD layoutD;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord problemShape_,
+            GM_ADDR ptrX_, LayoutX layoutX_,
+            GM_ADDR ptrB_, LayoutB layoutB_,
+            GM_ADDR ptrScale_, LayoutScale layoutScale_,
+            GM_ADDR ptrPerTokenScale_, LayoutPerTokenScale layoutPerTokenScale_,
+            GM_ADDR ptrD_, LayoutD layoutD_,
+            GM_ADDR ptrWorkspace_
+        ) : problemShape(problemShape_),
+            ptrX(reinterpret_cast<__gm__ ElementX *>(ptrX_)), layoutX(layoutX_),
+            ptrB(reinterpret_cast<__gm__ ElementB *>(ptrB_)), layoutB(layoutB_),
+            ptrScale(reinterpret_cast<__gm__ ElementScale *>(ptrScale_)), layoutScale(layoutScale_),
+            ptrPerTokenScale(reinterpret_cast<__gm__ ElementPerTokenScale *>(ptrPerTokenScale_)),
+            layoutPerTokenScale(layoutPerTokenScale_),
+            ptrD(reinterpret_cast<__gm__ ElementD *>(ptrD_)), layoutD(layoutD_),
+            ptrWorkspace(ptrWorkspace_)
+        {
+        }
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        // Output, one fp32 scale per row of X
+        GM_ADDR ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        GM_ADDR ptrD;
+        LayoutD layoutD;
+        // Number of cube cores of the launch, each one owns WORKSPACE_STAGES tiles of the workspace.
+        uint32_t aicCoreNum;
+    };
+
+    /// The quantized activation starts at this alignment in the workspace, its rows at BYTE_PER_C0.
+    static constexpr size_t WORKSPACE_ALIGN_BYTE = 512;
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return args.aicCoreNum > 0;
+    }
+
+    /// Bytes of the int32 accumulators, WORKSPACE_STAGES L1 tiles per cube core.
+    CATLASS_HOST_DEVICE
+    static size_t GetWorkspaceSizeC(uint32_t aicCoreNum)
+    {
+        size_t len = static_cast<size_t>(L1TileShape::M) * L1TileShape::N * aicCoreNum * WORKSPACE_STAGES;
+        return RoundUp(len * sizeof(ElementC), WORKSPACE_ALIGN_BYTE);
+    }
+
+    CATLASS_HOST_DEVICE
+    static LayoutA GetWorkspaceLayoutA(GemmCoord const &problemShape)
+    {
+        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(ElementA);
+        return LayoutA{problemShape.m(), problemShape.k(), RoundUp<ELE_NUM_PER_C0>(problemShape.k())};
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        LayoutA layoutA = GetWorkspaceLayoutA(args.problemShape);
+        return GetWorkspaceSizeC(args.aicCoreNum) +
+            static_cast<size_t>(layoutA.shape(0)) * layoutA.stride(0) * sizeof(ElementA);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape,
+            args.ptrX, args.layoutX,
+            args.ptrB, args.layoutB,
+            args.ptrScale, args.layoutScale,
+            args.ptrPerTokenScale, args.layoutPerTokenScale,
+            args.ptrD, args.layoutD,
+            workspace};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    DynamicQuantMatmul()
+    {
+        Arch::FlagID flagId = 0;
+        for (uint32_t stageId = 0; stageId < WORKSPACE_STAGES; ++stageId) {
+            flagAicFinishStoreList[stageId] = Arch::CrossCoreFlag(flagId++);
+            flagAivFinishComputeList[stageId] = Arch::CrossCoreFlag(flagId++);
+            aicWaitFuncList[stageId] = {this, stageId};
+            aicSetFuncList[stageId] = {this, stageId};
+        }
+        flagAivFinishQuant = Arch::CrossCoreFlag(flagId++);
+    }
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params)
+    {
+        BlockScheduler blockScheduler;
+        blockScheduler.Update(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+        BlockMmad blockMmad(resource);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA *>(params.ptrWorkspace + GetWorkspaceSizeC(coreNum)));
+        LayoutA layoutA = GetWorkspaceLayoutA(params.problemShape);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(params.ptrB);
+
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC *>(params.ptrWorkspace));
+        auto layoutC = layout::RowMajor{L1TileShape::M * coreNum * WORKSPACE_STAGES, L1TileShape::N};
+
+        uint32_t stageId = 0;
+        uint32_t stageUsed = 0;
+        // Number of m tiles of the activation quantized by all the AIV cores of the launch
+        uint32_t mQuantized = 0;
+        uint32_t mLoops = CeilDiv(params.problemShape.m(), L1TileShape::M);
+
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            // Compute block location
+            GemmCoord blockCoord = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = blockScheduler.GetActualBlockShape(blockCoord);
+
+            while (mQuantized <= blockCoord.m()) {
+                Arch::CrossCoreWaitFlag(flagAivFinishQuant);
+                ++mQuantized;
+            }
+
+            Callback callbackBeforeFixpipe{};
+            if (stageUsed == WORKSPACE_STAGES) {
+                callbackBeforeFixpipe = MakeCallback(&aicWaitFuncList[stageId]);
+            } else {
+                ++stageUsed;
+            }
+            Callback callbackAfterFixpipe = MakeCallback(&aicSetFuncList[stageId]);
+
+            // Compute initial location in logical coordinates
+            MatrixCoord offsetA{blockCoord.m() * L1TileShape::M, blockCoord.k() * L1TileShape::K};
+            MatrixCoord offsetB{blockCoord.k() * L1TileShape::K, blockCoord.n() * L1TileShape::N};
+            MatrixCoord offsetC{(stageId * coreNum + coreIdx) * L1TileShape::M, 0};
+            int64_t gmOffsetA = layoutA.GetOffset(offsetA);
+            int64_t gmOffsetB = params.layoutB.GetOffset(offsetB);
+            int64_t gmOffsetC = layoutC.GetOffset(offsetC);
+
+            // Compute block-scoped matrix multiply-add
+            if constexpr (BlockMmad::DispatchPolicy::ASYNC) {
+                blockMmad(
+                    gmA[gmOffsetA], layoutA,
+                    gmB[gmOffsetB], params.layoutB,
+                    gmC[gmOffsetC], layoutC,
+                    actualBlockShape,
+                    callbackBeforeFixpipe, callbackAfterFixpipe
+                );
+            } else {
+                callbackBeforeFixpipe();
+                blockMmad(
+                    gmA[gmOffsetA], layoutA,
+                    gmB[gmOffsetB], params.layoutB,
+                    gmC[gmOffsetC], layoutC,
+                    actualBlockShape
+                );
+                callbackAfterFixpipe();
+            }
+
+            stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+        }
+
+        if constexpr (BlockMmad::DispatchPolicy::ASYNC) {
+            blockMmad.SynchronizeBlock();
+        }
+
+        // The AIVs flag every m tile, whether this core uses it or not
+        while (mQuantized < mLoops) {
+            Arch::CrossCoreWaitFlag(flagAivFinishQuant);
+            ++mQuantized;
+        }
+
+        while (stageUsed > 0) {
+            uint32_t aivComputeStageId = (stageId >= stageUsed) ?
+                (stageId - stageUsed) : (stageId + WORKSPACE_STAGES - stageUsed);
+            Arch::CrossCoreWaitFlag(flagAivFinishComputeList[aivComputeStageId]);
+            --stageUsed;
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params)
+    {
+        uint32_t m = params.problemShape.m();
+        uint32_t k = params.problemShape.k();
+        uint32_t mLoops = CeilDiv(m, L1TileShape::M);
+
+        AscendC::GlobalTensor<ElementX> gmX;
+        gmX.SetGlobalBuffer(params.ptrX);
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA *>(
+            params.ptrWorkspace + GetWorkspaceSizeC(AscendC::GetBlockNum())));
+        AscendC::GlobalTensor<ElementPerTokenScale> gmPerTokenScale;
+        gmPerTokenScale.SetGlobalBuffer(params.ptrPerTokenScale);
+        LayoutA layoutA = GetWorkspaceLayoutA(params.problemShape);
+
+        BlockScheduler blockScheduler;
+        blockScheduler.Update(params.problemShape, L1TileShape::ToCoordMN());
+        uint32_t loopIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t stageId = 0;
+
+        for (uint32_t mIdx = 0; mIdx < mLoops; ++mIdx) {
+            uint32_t mOffset = mIdx * L1TileShape::M;
+            uint32_t actualM = (m - mOffset < L1TileShape::M) ? (m - mOffset) : L1TileShape::M;
+            MatrixCoord offsetTile{mOffset, 0};
+            {
+                PrologueA prologueA(resource);
+                prologueA(gmA[layoutA.GetOffset(offsetTile)], gmX[params.layoutX.GetOffset(offsetTile)],
+                    gmPerTokenScale[mOffset], layoutA.GetTileLayout(MatrixCoord{actualM, k}),
+                    params.layoutX.GetTileLayout(MatrixCoord{actualM, k}));
+            }
+            // The cube core and the epilogue of any core may read the rows and scales written by another one
+            Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+            Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagAivFinishQuant);
+
+            // The cube core computes the blocks of this tile meanwhile
+            DequantBlocks(params, blockScheduler, loopIdx, stageId, mIdx);
+        }
+        DequantBlocks(params, blockScheduler, loopIdx, stageId, mLoops);
+    }
+
+private:
+    /// Dequantizes the blocks of this core from loopIdx on, in the order of the cube core, up to the first one whose m
+    /// tile is not below mEnd.
+    CATLASS_DEVICE
+    void DequantBlocks(Params const &params, BlockScheduler &blockScheduler, uint32_t &loopIdx, uint32_t &stageId,
+        uint32_t mEnd)
+    {
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+        if ((loopIdx >= coreLoops) || (blockScheduler.GetBlockCoord(loopIdx).m() >= mEnd)) {
+            return;
+        }
+
+        // Shares UB with PrologueA, so it lives only between two tiles
+        BlockEpilogue blockEpilogue(resource);
+
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC *>(params.ptrWorkspace));
+        auto layoutC = layout::RowMajor{L1TileShape::M * coreNum * WORKSPACE_STAGES, L1TileShape::N};
+
+        LayoutScale layoutScale = params.layoutScale;
+        LayoutPerTokenScale layoutPerTokenScale =
+            params.layoutPerTokenScale.GetTileLayout(params.problemShape.template GetCoordByAxis<0>());
+        LayoutD layoutD = params.layoutD.GetTileLayout(params.problemShape.GetCoordMN());
+
+        EpilogueParams epilogueParams{
+            params.ptrScale, layoutScale,
+            params.ptrPerTokenScale, layoutPerTokenScale,
+            params.ptrD, layoutD
+        };
+        blockEpilogue.UpdateParams(epilogueParams);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        GemmCoord blockShapeMNK = L1TileShape::ToCoord();
+        for (; loopIdx < coreLoops; loopIdx += coreNum) {
+            GemmCoord blockCoordMNK = blockScheduler.GetBlockCoord(loopIdx);
+            if (blockCoordMNK.m() >= mEnd) {
+                break;
+            }
+            GemmCoord actualBlockShapeMNK = blockScheduler.GetActualBlockShape(blockCoordMNK);
+
+            MatrixCoord offsetC{(stageId * coreNum + coreIdx) * L1TileShape::M, 0};
+            int64_t gmOffsetC = layoutC.GetOffset(offsetC);
+            auto gmBlockC = gmC[gmOffsetC];
+            auto layoutBlockC = layoutC.GetTileLayout(actualBlockShapeMNK.GetCoordMN());
+
+            Arch::CrossCoreWaitFlag(flagAicFinishStoreList[stageId]);
+            blockEpilogue(blockShapeMNK, blockCoordMNK, actualBlockShapeMNK, gmBlockC, layoutBlockC);
+            Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagAivFinishComputeList[stageId]);
+
+            stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+        }
+    }
+
+    friend struct AicWaitFunc;
+    friend struct AicSetFunc;
+
+    struct AicWaitFunc {
+        using MatmulKernel = DynamicQuantMatmul<PrologueA, BlockMmad, BlockEpilogue, BlockScheduler,
+            WORKSPACE_STAGES>;
+
+        CATLASS_DEVICE
+        AicWaitFunc() = default;
+
+        CATLASS_DEVICE
+        void operator()() const
+        {
+            Arch::CrossCoreWaitFlag(ptr->flagAivFinishComputeList[stageId]);
+        }
+
+        MatmulKernel *ptr{nullptr};
+        uint32_t stageId;
+    };
+
+    struct AicSetFunc {
+        using MatmulKernel = DynamicQuantMatmul<PrologueA, BlockMmad, BlockEpilogue, BlockScheduler,
+            WORKSPACE_STAGES>;
+
+        CATLASS_DEVICE
+        AicSetFunc() = default;
+
+        CATLASS_DEVICE
+        void operator()() const
+        {
+            Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(ptr->flagAicFinishStoreList[stageId]);
+        }
+
+        MatmulKernel *ptr{nullptr};
+        uint32_t stageId;
+    };
+
+    Arch::CrossCoreFlag flagAicFinishStoreList[WORKSPACE_STAGES];
+    Arch::CrossCoreFlag flagAivFinishComputeList[WORKSPACE_STAGES];
+    Arch::CrossCoreFlag flagAivFinishQuant;
+
+    AicWaitFunc aicWaitFuncList[WORKSPACE_STAGES];
+    AicSetFunc aicSetFuncList[WORKSPACE_STAGES];
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_DYNAMIC_QUANT_MATMUL_HPP
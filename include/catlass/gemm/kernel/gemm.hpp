@@ -223,6 +223,104 @@ public:
               epilogueParams(epilogueParams_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        EpilogueParams epilogueParams;
+    };
+
+    /// Operands whose leading stride is not a multiple of this many bytes are copied with an aligned stride.
+    static constexpr uint32_t PADDING_ALIGN_BYTE = 512;
+
+    CATLASS_HOST_DEVICE
+    static layout::RowMajor GetPaddingLayout(layout::RowMajor const &layout, uint32_t align)
+    {
+        return layout::RowMajor(layout.shape(0), layout.shape(1), RoundUp(layout.shape(1), align));
+    }
+
+    CATLASS_HOST_DEVICE
+    static layout::ColumnMajor GetPaddingLayout(layout::ColumnMajor const &layout, uint32_t align)
+    {
+        return layout::ColumnMajor(layout.shape(0), layout.shape(1), RoundUp(layout.shape(0), align));
+    }
+
+    CATLASS_HOST_DEVICE
+    static size_t GetPaddingLen(layout::RowMajor const &layout)
+    {
+        return static_cast<size_t>(layout.shape(0)) * layout.stride(0);
+    }
+
+    CATLASS_HOST_DEVICE
+    static size_t GetPaddingLen(layout::ColumnMajor const &layout)
+    {
+        return static_cast<size_t>(layout.shape(1)) * layout.stride(1);
+    }
+
+    template <class Layout>
+    static bool NeedPadding(Layout const &layout, Layout const &layoutW)
+    {
+        return GetPaddingLen(layout) != GetPaddingLen(layoutW);
+    }
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    /// Bytes of the m x n accumulators, rounded up so that the padded copies start aligned.
+    static size_t GetWorkspaceSizeC(const Arguments &args)
+    {
+        size_t size = static_cast<size_t>(args.problemShape.m()) * args.problemShape.n() * sizeof(ElementC);
+        return RoundUp(size, static_cast<size_t>(PADDING_ALIGN_BYTE));
+    }
+
+    static size_t GetWorkspaceSizeA(const Arguments &args)
+    {
+        LayoutA layoutWA = GetPaddingLayout(args.layoutA, PADDING_ALIGN_BYTE / sizeof(ElementA));
+        if (!NeedPadding(args.layoutA, layoutWA)) {
+            return 0;
+        }
+        return RoundUp(GetPaddingLen(layoutWA) * sizeof(ElementA), static_cast<size_t>(PADDING_ALIGN_BYTE));
+    }
+
+    static size_t GetWorkspaceSizeB(const Arguments &args)
+    {
+        LayoutB layoutWB = GetPaddingLayout(args.layoutB, PADDING_ALIGN_BYTE / sizeof(ElementB));
+        if (!NeedPadding(args.layoutB, layoutWB)) {
+            return 0;
+        }
+        return GetPaddingLen(layoutWB) * sizeof(ElementB);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return GetWorkspaceSizeC(args) + GetWorkspaceSizeA(args) + GetWorkspaceSizeB(args);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        // An operand that needs no copy is read in place, the kernel compares the strides to skip its padding.
+        LayoutA layoutWA = GetPaddingLayout(args.layoutA, PADDING_ALIGN_BYTE / sizeof(ElementA));
+        LayoutB layoutWB = GetPaddingLayout(args.layoutB, PADDING_ALIGN_BYTE / sizeof(ElementB));
+        GM_ADDR ptrWA = args.ptrA;
+        GM_ADDR ptrWB = args.ptrB;
+        if (NeedPadding(args.layoutA, layoutWA)) {
+            ptrWA = workspace + GetWorkspaceSizeC(args);
+        } else {
+            layoutWA = args.layoutA;
+        }
+        if (NeedPadding(args.layoutB, layoutWB)) {
+            ptrWB = workspace + GetWorkspaceSizeC(args) + GetWorkspaceSizeA(args);
+        } else {
+            layoutWB = args.layoutB;
+        }
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, workspace,
+            ptrWA, layoutWA, ptrWB, layoutWB, args.epilogueParams};
+    }
+
 
     CATLASS_DEVICE
     KernelGemm(){}
@@ -245,6 +245,45 @@ public:
         {}
     };
 
+    struct Arguments {
+        uint32_t problemCount;
+        GM_ADDR ptrProblemShape;
+        GM_ADDR alpha;
+        GM_ADDR beta;
+        GM_ADDR ptrA;
+        GM_ADDR ptrLayoutA;
+        GM_ADDR ptrB;
+        GM_ADDR ptrLayoutB;
+        GM_ADDR ptrWorkspace;
+        GM_ADDR ptrLayoutWorkspace;
+        GM_ADDR ptrWA;
+        GM_ADDR ptrLayoutWA;
+        GM_ADDR ptrWB;
+        GM_ADDR ptrLayoutWB;
+        GM_ADDR ptrX;
+        GM_ADDR ptrD;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        // The shape and layout lists are unpacked into fixed size arrays on the core.
+        return args.problemCount <= MAX_TENSOR_COUNT;
+    }
+
+    /// The shapes and layouts of the groups are only known on the device, so the accumulator and padding buffers
+    /// are sized by the caller along with their layout lists and passed in the arguments.
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemCount, args.ptrProblemShape, args.alpha, args.beta, args.ptrA,
+            args.ptrLayoutA, args.ptrB, args.ptrLayoutB, args.ptrWorkspace, args.ptrLayoutWorkspace,
+            args.ptrWA, args.ptrLayoutWA, args.ptrWB, args.ptrLayoutWB, args.ptrX, args.ptrD};
+    }
+
     CATLASS_DEVICE
     KernelGroupGemm() {}
 
@@ -67,10 +67,10 @@ public:
         GM_ADDR ptrLayoutC;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             uint32_t problemCount_, GM_ADDR ptrProblemShape_,
             GM_ADDR ptrA_, GM_ADDR ptrLayoutA_,
@@ -84,6 +84,37 @@ public:
         }
     };
 
+    struct Arguments {
+        uint32_t problemCount;
+        GM_ADDR ptrProblemShape;
+        GM_ADDR ptrA;
+        GM_ADDR ptrLayoutA;
+        GM_ADDR ptrB;
+        GM_ADDR ptrLayoutB;
+        GM_ADDR ptrC;
+        GM_ADDR ptrLayoutC;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        // The shape and layout lists are unpacked into fixed size arrays on the core.
+        return args.problemCount <= MAX_TENSOR_COUNT;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemCount, args.ptrProblemShape,
+            args.ptrA, args.ptrLayoutA,
+            args.ptrB, args.ptrLayoutB,
+            args.ptrC, args.ptrLayoutC};
+    }
+
     // Methods
     CATLASS_DEVICE
     GroupedMatmul() {}
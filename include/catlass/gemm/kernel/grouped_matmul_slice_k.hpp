@@ -12,6 +12,7 @@
 #define CATLASS_GEMM_KERNEL_GROUPED_MATMUL_K_HPP
 
 #include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
 #include "catlass/arch/resource.hpp"
 #include "catlass/coord.hpp"
 #include "catlass/gemm_coord.hpp"
@@ -20,11 +21,14 @@
 namespace Catlass::Gemm::Kernel {
 
 // Template for grouped matmul kernel. Compute grouped C = A * B
+// If PrologueB_ is not void, the AIV cores walk one group ahead of the AIC cores and
+// prefetch the B matrix of the next group into L2 while the current group is computed.
 template <
     class BlockMmad_,
     class BlockEpilogue_,
     class BlockScheduler_,
-    class ElementGroupList_
+    class ElementGroupList_,
+    class PrologueB_ = void
 >
 class GroupedMatmulSliceK {
 public:
@@ -41,6 +45,7 @@ public:
     using ElementGroupList = ElementGroupList_;
 
     using BlockScheduler = BlockScheduler_;
+    using PrologueB = PrologueB_;
 
     /// Parameters structure
     struct Params {
@@ -56,10 +61,10 @@ public:
         LayoutC layoutC;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             GemmCoord const &problemShape_, uint32_t problemCount_, GM_ADDR ptrGroupList_,
             GM_ADDR ptrA_, LayoutA const &layoutA_,
@@ -74,6 +79,37 @@ public:
         }
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t problemCount;
+        GM_ADDR ptrGroupList;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape, args.problemCount, args.ptrGroupList,
+            args.ptrA, args.layoutA,
+            args.ptrB, args.layoutB,
+            args.ptrC, args.layoutC};
+    }
+
     // Methods
     CATLASS_DEVICE
     GroupedMatmulSliceK() {}
@@ -120,6 +156,13 @@ public:
             blockScheduler.Update(problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
             uint32_t coreLoops = blockScheduler.GetCoreLoops();
 
+            if constexpr (!std::is_void_v<PrologueB>) {
+                // Allow the AIV cores to start prefetching the B matrix of the next group
+                if (groupIdx + 1 < params.problemCount) {
+                    Arch::CrossCoreSetFlagWithReverse<0x2, PIPE_MTE2>(flagAicStartGroup);
+                }
+            }
+
             // Determine the starting loopIdx of the current core under the current groupIdx
             uint32_t startLoopIdx;
             if (coreIdx < startCoreIdx) {
@@ -163,7 +206,34 @@ public:
 
     template <>
     CATLASS_DEVICE
-    void operator()<AscendC::AIV>(Params const &params) {}
+    void operator()<AscendC::AIV>(Params const &params)
+    {
+        if constexpr (!std::is_void_v<PrologueB>) {
+            Arch::Resource<ArchTag> resource;
+            PrologueB prologueB(resource);
+
+            AscendC::GlobalTensor<ElementB> gmB;
+            gmB.SetGlobalBuffer(params.ptrB);
+            AscendC::GlobalTensor<ElementGroupList> groupList;
+            groupList.SetGlobalBuffer(params.ptrGroupList);
+
+            int64_t inGroupOffsetB = 0;
+            for (uint32_t groupIdx = 0; groupIdx + 1 < params.problemCount; ++groupIdx) {
+                uint32_t currentK = (groupIdx == 0) ? groupList.GetValue(groupIdx) :
+                    (groupList.GetValue(groupIdx) - groupList.GetValue(groupIdx - 1));
+                uint32_t nextK = groupList.GetValue(groupIdx + 1) - groupList.GetValue(groupIdx);
+                inGroupOffsetB += static_cast<int64_t>(currentK) * params.problemShape.n();
+
+                Arch::CrossCoreWaitFlagWithReverse<0x2, PIPE_MTE2>(flagAicStartGroup);
+                prologueB(gmB[inGroupOffsetB], static_cast<uint64_t>(nextK) * params.problemShape.n());
+            }
+        }
+    }
+
+private:
+    static constexpr Arch::FlagID FLAG_AIC_START_GROUP = 0;
+    static constexpr Arch::FlagID FLAG_AIV_FINISH_PREFETCH = 1;
+    Arch::CrossCoreFlagWithReverse<> flagAicStartGroup{FLAG_AIC_START_GROUP, FLAG_AIV_FINISH_PREFETCH};
 };
 
 } // namespace Catlass::Gemm::Kernel
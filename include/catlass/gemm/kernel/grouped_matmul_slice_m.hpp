@@ -12,6 +12,7 @@
 #define CATLASS_GEMM_KERNEL_GROUPED_MATMUL_M_HPP
 
 #include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
 #include "catlass/arch/resource.hpp"
 #include "catlass/coord.hpp"
 #include "catlass/gemm_coord.hpp"
@@ -22,11 +23,14 @@ inline __gm__ struct OpSystemRunCfg g_opSystemRunCfg{Catlass::L2_OFFSET};
 namespace Catlass::Gemm::Kernel {
 
 // Template for grouped matmul kernel. Compute grouped C = A * B
+// If PrologueB_ is not void, the AIV cores walk one group ahead of the AIC cores and
+// prefetch the B matrix of the next group into L2 while the current group is computed.
 template <
     class BlockMmad_,
     class BlockEpilogue_,
     class BlockScheduler_,
-    class ElementGroupList_
+    class ElementGroupList_,
+    class PrologueB_ = void
 >
 class GroupedMatmulSliceM {
 public:
@@ -44,6 +48,7 @@ public:
     using ElementGroupList = ElementGroupList_;
 
     using BlockScheduler = BlockScheduler_;
+    using PrologueB = PrologueB_;
 
     /// Parameters structure
     struct Params {
@@ -59,10 +64,10 @@ public:
         LayoutC layoutC;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             GemmCoord const &problemShape_, uint32_t problemCount_, GM_ADDR ptrGroupList_,
             GM_ADDR ptrA_, LayoutA const &layoutA_,
@@ -77,6 +82,37 @@ public:
         }
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t problemCount;
+        GM_ADDR ptrGroupList;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape, args.problemCount, args.ptrGroupList,
+            args.ptrA, args.layoutA,
+            args.ptrB, args.layoutB,
+            args.ptrC, args.layoutC};
+    }
+
     // Methods
     CATLASS_DEVICE
     GroupedMatmulSliceM() {}
@@ -122,8 +158,15 @@ public:
 
             AscendC::GlobalTensor<ElementB> gmB;
             gmB.SetGlobalBuffer(params.ptrB + gmGroupOffsetB);
-            if (CeilDiv(currentM, L1TileShape::M) == 1) {
-                gmB.SetL2CacheHint(AscendC::CacheMode::CACHE_MODE_DISABLE);
+            if constexpr (std::is_void_v<PrologueB>) {
+                if (CeilDiv(currentM, L1TileShape::M) == 1) {
+                    gmB.SetL2CacheHint(AscendC::CacheMode::CACHE_MODE_DISABLE);
+                }
+            } else {
+                // Allow the AIV cores to start prefetching the B matrix of the next group
+                if (groupIdx + 1 < params.problemCount) {
+                    Arch::CrossCoreSetFlagWithReverse<0x2, PIPE_MTE2>(flagAicStartGroup);
+                }
             }
 
             // Determine the starting loopIdx of the current core under the current groupIdx
@@ -172,7 +215,28 @@ public:
     CATLASS_DEVICE
     void operator()<AscendC::AIV>(Params const &params)
     {
+        if constexpr (!std::is_void_v<PrologueB>) {
+            Arch::Resource<ArchTag> resource;
+            PrologueB prologueB(resource);
+
+            AscendC::GlobalTensor<ElementB> gmB;
+            gmB.SetGlobalBuffer(params.ptrB);
+
+            // Every group shares the same B shape, only the group offset moves
+            int64_t groupLenB = static_cast<int64_t>(params.problemShape.k()) * params.problemShape.n();
+            int64_t gmGroupOffsetB = 0;
+            for (uint32_t groupIdx = 0; groupIdx + 1 < params.problemCount; ++groupIdx) {
+                gmGroupOffsetB += groupLenB;
+                Arch::CrossCoreWaitFlagWithReverse<0x2, PIPE_MTE2>(flagAicStartGroup);
+                prologueB(gmB[gmGroupOffsetB], groupLenB);
+            }
+        }
     }
+
+private:
+    static constexpr Arch::FlagID FLAG_AIC_START_GROUP = 0;
+    static constexpr Arch::FlagID FLAG_AIV_FINISH_PREFETCH = 1;
+    Arch::CrossCoreFlagWithReverse<> flagAicStartGroup{FLAG_AIC_START_GROUP, FLAG_AIV_FINISH_PREFETCH};
 };
 
 } // namespace Catlass::Gemm::Kernel
@@ -99,10 +99,10 @@ public:
         GM_ADDR ptrWorkspace;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             GemmCoord problemShape_, uint32_t problemCount_, GM_ADDR ptrGroupList_,
             GM_ADDR ptrA_, LayoutA layoutA_,
@@ -124,6 +124,45 @@ public:
         }
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t problemCount;
+        GM_ADDR ptrGroupList;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        GM_ADDR ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        GM_ADDR ptrD;
+        LayoutD layoutD;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // Accumulators of the whole problem, dequantized by the AIV cores.
+        return static_cast<size_t>(args.problemShape.m()) * args.problemShape.n() * sizeof(ElementC);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape, args.problemCount, args.ptrGroupList,
+            args.ptrA, args.layoutA,
+            args.ptrB, args.layoutB,
+            args.ptrScale, args.layoutScale,
+            args.ptrPerTokenScale, args.layoutPerTokenScale,
+            args.ptrD, args.layoutD,
+            workspace};
+    }
+
     // Methods
     CATLASS_DEVICE
     GroupedMatmulSliceMPerTokenDequant() {}
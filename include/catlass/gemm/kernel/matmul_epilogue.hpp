@@ -61,10 +61,10 @@ public:
         EpilogueParams epilogueParams;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             GemmCoord const &problemShape_,
             GM_ADDR ptrA_, LayoutA const &layoutA_,
@@ -74,6 +74,32 @@ public:
             ptrWorkspace(ptrWorkspace_), epilogueParams(epilogueParams_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        EpilogueParams epilogueParams;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // Row major m x n result of the mmad, read back by the epilogue.
+        return static_cast<size_t>(args.problemShape.m()) * args.problemShape.n() * sizeof(ElementC);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, workspace,
+            args.epilogueParams};
+    }
+
     // Methods
     CATLASS_DEVICE
     MatmulEpilogue() {}
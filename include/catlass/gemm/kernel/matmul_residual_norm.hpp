@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_MATMUL_RESIDUAL_NORM_HPP
+#define CATLASS_GEMM_KERNEL_MATMUL_RESIDUAL_NORM_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+// Template for matmul residual norm kernel. Compute S = A * B + residual and D = norm(S) over the rows with an
+// EpilogueAtlasA2ResidualNorm block epilogue. If n <= L1TileShape::N every cube block holds full rows and they are
+// normalized by the epilogue of the block. Otherwise the statistics of a row are reduced across its blocks in the
+// workspace, and the rows are normalized after a barrier of all the AIVs.
+template <
+    class BlockMmad_,
+    class BlockEpilogue_,
+    class BlockScheduler_
+>
+class MatmulResidualNorm {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementD = typename BlockEpilogue::ElementD;
+    using LayoutD = typename BlockEpilogue::LayoutD;
+    using EpilogueParams = typename BlockEpilogue::Params;
+
+    using BlockScheduler = BlockScheduler_;
+
+    static_assert(std::is_same_v<typename BlockEpilogue::ElementC, ElementC> &&
+        std::is_same_v<typename BlockEpilogue::LayoutC, LayoutC>,
+        "The CType of Mmad and Epilogue should be consistent.");
+    static_assert(std::is_same_v<ElementC, float>, "The residual and the statistics are accumulated in fp32");
+    static_assert(BlockEpilogue::TileShape::COLUMN == L1TileShape::N,
+        "The epilogue tiles must span the columns of a cube block");
+
+    static constexpr bool IS_LAYER_NORM = BlockEpilogue::IS_LAYER_NORM;
+    static constexpr uint32_t WORKSPACE_ALIGN = 512;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrWorkspace;
+        EpilogueParams epilogueParams;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord const &problemShape_,
+            GM_ADDR ptrA_, LayoutA const &layoutA_,
+            GM_ADDR ptrB_, LayoutB const &layoutB_,
+            GM_ADDR ptrWorkspace_, EpilogueParams const &epilogueParams_
+        ) : problemShape(problemShape_), ptrA(ptrA_), layoutA(layoutA_), ptrB(ptrB_), layoutB(layoutB_),
+            ptrWorkspace(ptrWorkspace_), epilogueParams(epilogueParams_) {}
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        EpilogueParams epilogueParams;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    /// Offset of the row statistics, after the row major m x n fp32 C, which is overwritten with S.
+    CATLASS_HOST_DEVICE
+    static size_t GetRowStatsOffset(GemmCoord const &problemShape)
+    {
+        return RoundUp<WORKSPACE_ALIGN>(static_cast<size_t>(problemShape.m()) * problemShape.n() * sizeof(ElementC));
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return GetRowStatsOffset(args.problemShape) +
+            static_cast<size_t>(BlockEpilogue::ROW_STAT_NUM) * args.problemShape.m() * sizeof(float);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, workspace,
+            args.epilogueParams};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    MatmulResidualNorm() {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params)
+    {
+        BlockScheduler matmulBlockScheduler(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = matmulBlockScheduler.GetCoreLoops();
+
+        BlockMmad blockMmad(resource);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer((__gm__ ElementA *)params.ptrA);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer((__gm__ ElementB *)params.ptrB);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer((__gm__ ElementC *)params.ptrWorkspace);
+        layout::RowMajor layoutC(params.problemShape.m(), params.problemShape.n());
+
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < coreLoops; loopIdx += AscendC::GetBlockNum()) {
+            // Compute block location
+            GemmCoord blockCoord = matmulBlockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = matmulBlockScheduler.GetActualBlockShape(blockCoord);
+
+            // Compute initial location in logical coordinates
+            MatrixCoord offsetA{blockCoord.m() * L1TileShape::M, blockCoord.k() * L1TileShape::K};
+            MatrixCoord offsetB{blockCoord.k() * L1TileShape::K, blockCoord.n() * L1TileShape::N};
+            MatrixCoord offsetC{blockCoord.m() * L1TileShape::M, blockCoord.n() * L1TileShape::N};
+            int64_t gmOffsetA = params.layoutA.GetOffset(offsetA);
+            int64_t gmOffsetB = params.layoutB.GetOffset(offsetB);
+            int64_t gmOffsetC = layoutC.GetOffset(offsetC);
+
+            // Compute block-scoped matrix multiply-add
+            blockMmad(
+                gmA[gmOffsetA], params.layoutA,
+                gmB[gmOffsetB], params.layoutB,
+                gmC[gmOffsetC], layoutC,
+                actualBlockShape);
+
+            Arch::CrossCoreSetFlagWithReverse<0x2, PIPE_FIX>(flagAicFinishStore);
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params)
+    {
+        BlockScheduler matmulBlockScheduler(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = matmulBlockScheduler.GetCoreLoops();
+
+        BlockEpilogue blockEpilogue(resource, params.epilogueParams);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer((__gm__ ElementC *)params.ptrWorkspace);
+        layout::RowMajor layoutC(params.problemShape.m(), params.problemShape.n());
+        AscendC::GlobalTensor<float> gmRowStats;
+        gmRowStats.SetGlobalBuffer((__gm__ float *)(params.ptrWorkspace + GetRowStatsOffset(params.problemShape)));
+        blockEpilogue.SetWorkspace(gmC, layoutC, gmRowStats);
+
+        // Get aicore information
+        uint32_t aicoreIndex = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t aicoreNum = AscendC::GetBlockNum();
+        uint32_t aivIndex = AscendC::GetBlockIdx();
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+
+        bool fullRow = params.problemShape.n() <= L1TileShape::N;
+        if (!fullRow) {
+            blockEpilogue.ClearRowStats(aivIndex, aivNum);
+            Catlass::Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        }
+
+        // Loop through the epilogue calculations of each basic block
+        GemmCoord blockShape = L1TileShape::ToCoord();
+        for (uint32_t loopIdx = aicoreIndex; loopIdx < coreLoops; loopIdx += aicoreNum) {
+            // Compute block location
+            GemmCoord blockCoord = matmulBlockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = matmulBlockScheduler.GetActualBlockShape(blockCoord);
+            // Get the data and layout of C under the current basic block
+            auto gmBlockC = gmC[layoutC.GetOffset(blockCoord.GetCoordMN() * blockShape.GetCoordMN())];
+            auto layoutBlockC = layoutC.GetTileLayout(actualBlockShape.GetCoordMN());
+            // Synchronize cross core
+            Arch::CrossCoreWaitFlagWithReverse<0x2, PIPE_MTE3>(flagAicFinishStore);
+            // Residual add, and the norm itself if the block holds full rows
+            blockEpilogue(blockShape, blockCoord, actualBlockShape, gmBlockC, layoutBlockC);
+        }
+        if (fullRow) {
+            return;
+        }
+
+        // All the partial statistics of every row are in the workspace
+        Catlass::Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        if constexpr (IS_LAYER_NORM) {
+            blockEpilogue.AccumulateCenteredSquares(aivIndex, aivNum);
+            Catlass::Arch::CrossCoreBarrier<0x0, PIPE_MTE3>();
+        }
+        blockEpilogue.Normalize(aivIndex, aivNum);
+    }
+
+private:
+    // ID used for inter-core synchronization
+    static constexpr Arch::FlagID FLAG_AIC_FINISH_STORE = 0;
+    static constexpr Arch::FlagID RV_FLAG_AIC_FINISH_STORE = 1;
+    Arch::CrossCoreFlagWithReverse<> flagAicFinishStore{FLAG_AIC_FINISH_STORE, RV_FLAG_AIC_FINISH_STORE};
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_MATMUL_RESIDUAL_NORM_HPP
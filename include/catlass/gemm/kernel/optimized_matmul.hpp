@@ -73,10 +73,10 @@ public:
         LayoutWB layoutWB;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(GemmCoord const &problemShape_,
                GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrB_, LayoutB layoutB_, GM_ADDR ptrC_, LayoutC layoutC_,
                GM_ADDR ptrWA_, LayoutWA layoutWA_, GM_ADDR ptrWB_, LayoutWB layoutWB_)
@@ -84,6 +84,79 @@ public:
               ptrC(ptrC_), layoutC(layoutC_), ptrWA(ptrWA_), layoutWA(layoutWA_), ptrWB(ptrWB_), layoutWB(layoutWB_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+    };
+
+    /// The padded copy of B starts at this alignment in the workspace.
+    static constexpr size_t WORKSPACE_ALIGN_BYTE = 512;
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    /// Bytes of the padded copy of A, tiles of L1TileShape::M x L1TileShape::K.
+    static size_t GetWorkspaceSizeA(const Arguments &args)
+    {
+        if constexpr (std::is_void_v<PrologueA>) {
+            return 0;
+        } else {
+            size_t len = static_cast<size_t>(RoundUp(args.problemShape.m(), L1TileShape::M)) *
+                RoundUp(args.problemShape.k(), L1TileShape::K);
+            return RoundUp(len * sizeof(ElementA), WORKSPACE_ALIGN_BYTE);
+        }
+    }
+
+    /// Bytes of the padded copy of B, tiles of L1TileShape::K x L1TileShape::N.
+    static size_t GetWorkspaceSizeB(const Arguments &args)
+    {
+        if constexpr (std::is_void_v<PrologueB>) {
+            return 0;
+        } else {
+            return static_cast<size_t>(RoundUp(args.problemShape.k(), L1TileShape::K)) *
+                RoundUp(args.problemShape.n(), L1TileShape::N) * sizeof(ElementB);
+        }
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return GetWorkspaceSizeA(args) + GetWorkspaceSizeB(args);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        uint32_t m = args.problemShape.m();
+        uint32_t n = args.problemShape.n();
+        uint32_t k = args.problemShape.k();
+        GM_ADDR ptrWA = args.ptrA;
+        GM_ADDR ptrWB = args.ptrB;
+        LayoutWA layoutWA = [&]() {
+            if constexpr (std::is_void_v<PrologueA>) {
+                return args.layoutA;
+            } else {
+                ptrWA = workspace;
+                return LayoutWA(m, k, L1TileShape::M, L1TileShape::K);
+            }
+        }();
+        LayoutWB layoutWB = [&]() {
+            if constexpr (std::is_void_v<PrologueB>) {
+                return args.layoutB;
+            } else {
+                ptrWB = workspace + GetWorkspaceSizeA(args);
+                return LayoutWB(k, n, L1TileShape::K, L1TileShape::N);
+            }
+        }();
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, args.ptrC, args.layoutC,
+            ptrWA, layoutWA, ptrWB, layoutWB};
+    }
+
     // Methods
     CATLASS_DEVICE
     OptimizedMatmul() {}
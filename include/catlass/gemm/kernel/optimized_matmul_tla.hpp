@@ -290,10 +290,10 @@ public:
         LayoutWB layoutWB;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(GemmCoord const &problemShape_,
                GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrB_, LayoutB layoutB_, GM_ADDR ptrC_, LayoutC layoutC_,
                GM_ADDR ptrWA_, LayoutWA layoutWA_, GM_ADDR ptrWB_, LayoutWB layoutWB_)
@@ -301,6 +301,63 @@ public:
               ptrC(ptrC_), layoutC(layoutC_), ptrWA(ptrWA_), layoutWA(layoutWA_), ptrWB(ptrWB_), layoutWB(layoutWB_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        // Layouts of the padded copies, equal to layoutA/layoutB for an operand without padding.
+        LayoutWA layoutWA;
+        LayoutWB layoutWB;
+    };
+
+    /// The padded copy of B starts at this alignment in the workspace.
+    static constexpr size_t WORKSPACE_ALIGN_BYTE = 512;
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    /// Bytes of the padded copy of A, tiles of L1_TILE_M x L1_TILE_K.
+    static size_t GetWorkspaceSizeA(const Arguments &args)
+    {
+        if constexpr (std::is_void_v<PaddingA>) {
+            return 0;
+        } else {
+            size_t len = static_cast<size_t>(RoundUp(args.problemShape.m(), L1_TILE_M)) *
+                RoundUp(args.problemShape.k(), L1_TILE_K);
+            return RoundUp(len * sizeof(ElementA), WORKSPACE_ALIGN_BYTE);
+        }
+    }
+
+    /// Bytes of the padded copy of B, tiles of L1_TILE_K x L1_TILE_N.
+    static size_t GetWorkspaceSizeB(const Arguments &args)
+    {
+        if constexpr (std::is_void_v<PaddingB>) {
+            return 0;
+        } else {
+            return static_cast<size_t>(RoundUp(args.problemShape.k(), L1_TILE_K)) *
+                RoundUp(args.problemShape.n(), L1_TILE_N) * sizeof(ElementB);
+        }
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return GetWorkspaceSizeA(args) + GetWorkspaceSizeB(args);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        GM_ADDR ptrWA = std::is_void_v<PaddingA> ? args.ptrA : workspace;
+        GM_ADDR ptrWB = std::is_void_v<PaddingB> ? args.ptrB : workspace + GetWorkspaceSizeA(args);
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, args.ptrC, args.layoutC,
+            ptrWA, args.layoutWA, ptrWB, args.layoutWB};
+    }
+
     // Methods
     CATLASS_DEVICE
     OptimizedMatmulTla() {}
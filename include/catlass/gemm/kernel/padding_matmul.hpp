@@ -381,10 +381,10 @@ public:
         LayoutB layoutWB;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(GemmCoord const &problemShape_,
                GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrB_, LayoutB layoutB_, GM_ADDR ptrC_, LayoutC layoutC_,
                GM_ADDR ptrWA_, LayoutA layoutWA_, GM_ADDR ptrWB_, LayoutB layoutWB_)
@@ -392,6 +392,69 @@ public:
               ptrC(ptrC_), layoutC(layoutC_), ptrWA(ptrWA_), layoutWA(layoutWA_), ptrWB(ptrWB_), layoutWB(layoutWB_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+    };
+
+    /// Strides of the padded copies are aligned to this many bytes.
+    static constexpr uint32_t PADDING_ALIGN_BYTE = 512;
+
+    CATLASS_HOST_DEVICE
+    static layout::RowMajor GetPaddingLayout(layout::RowMajor const &layout, uint32_t align)
+    {
+        return layout::RowMajor(layout.shape(0), layout.shape(1), RoundUp(layout.shape(1), align));
+    }
+
+    CATLASS_HOST_DEVICE
+    static layout::ColumnMajor GetPaddingLayout(layout::ColumnMajor const &layout, uint32_t align)
+    {
+        return layout::ColumnMajor(layout.shape(0), layout.shape(1), RoundUp(layout.shape(0), align));
+    }
+
+    CATLASS_HOST_DEVICE
+    static size_t GetPaddingLen(layout::RowMajor const &layout)
+    {
+        return static_cast<size_t>(layout.shape(0)) * layout.stride(0);
+    }
+
+    CATLASS_HOST_DEVICE
+    static size_t GetPaddingLen(layout::ColumnMajor const &layout)
+    {
+        return static_cast<size_t>(layout.shape(1)) * layout.stride(1);
+    }
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    /// Bytes of the padded copy of A, rounded up so that the copy of B starts aligned.
+    static size_t GetWorkspaceSizeA(const Arguments &args)
+    {
+        auto layoutWA = GetPaddingLayout(args.layoutA, PADDING_ALIGN_BYTE / sizeof(ElementA));
+        return RoundUp(GetPaddingLen(layoutWA) * sizeof(ElementA), static_cast<size_t>(PADDING_ALIGN_BYTE));
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        auto layoutWB = GetPaddingLayout(args.layoutB, PADDING_ALIGN_BYTE / sizeof(ElementB));
+        return GetWorkspaceSizeA(args) + GetPaddingLen(layoutWB) * sizeof(ElementB);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        LayoutA layoutWA = GetPaddingLayout(args.layoutA, PADDING_ALIGN_BYTE / sizeof(ElementA));
+        LayoutB layoutWB = GetPaddingLayout(args.layoutB, PADDING_ALIGN_BYTE / sizeof(ElementB));
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, args.ptrC, args.layoutC,
+            workspace, layoutWA, workspace + GetWorkspaceSizeA(args), layoutWB};
+    }
+
     // Methods
     CATLASS_DEVICE
     PaddingMatmul() {}
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_PREFETCH_L2_HPP
+#define CATLASS_GEMM_KERNEL_PREFETCH_L2_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// @brief AIV prologue that warms a contiguous GM region into L2.
+/// All vector cores split the region evenly and stream their part through a single UB buffer,
+/// the loaded data is discarded. Only whole 32B blocks are touched, so a tail shorter than one
+/// block may stay cold.
+/// @tparam ArchTag_: Architecture tag.
+/// @tparam Element_: Type of the elements to prefetch.
+/// @tparam COMPUTE_LENGTH: Number of elements moved by one DataCopy.
+template<
+    class ArchTag_,
+    class Element_,
+    uint32_t COMPUTE_LENGTH
+>
+struct PrefetchGmToL2 {
+public:
+    using ArchTag = ArchTag_;
+    using Element = Element_;
+
+    static constexpr uint32_t ELE_NUM_PER_BLK = BYTE_PER_BLK / sizeof(Element);
+
+    CATLASS_DEVICE
+    PrefetchGmToL2(Arch::Resource<ArchTag> &resource)
+    {
+        ubBuffer = resource.ubBuf.template GetBufferByByte<Element>(0);
+    }
+
+    CATLASS_DEVICE
+    void operator()(AscendC::GlobalTensor<Element> const &src, uint64_t len)
+    {
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetSubBlockNum();
+        uint32_t aivId = AscendC::GetBlockIdx();
+
+        uint64_t blocksNum = len / ELE_NUM_PER_BLK;
+        uint64_t blocksPerAiv = blocksNum / aivNum;
+        uint64_t blocksRemain = blocksNum % aivNum;
+        uint64_t blockOffset = aivId * blocksPerAiv + ((aivId < blocksRemain) ? aivId : blocksRemain);
+        if (aivId < blocksRemain) {
+            blocksPerAiv++;
+        }
+
+        uint64_t offset = blockOffset * ELE_NUM_PER_BLK;
+        uint64_t remain = blocksPerAiv * ELE_NUM_PER_BLK;
+        // The UB data is never consumed, so consecutive MTE2 writes to the same buffer need no synchronization.
+        while (remain > 0) {
+            uint32_t actualLen = (remain < COMPUTE_LENGTH) ? static_cast<uint32_t>(remain) : COMPUTE_LENGTH;
+            AscendC::DataCopy(ubBuffer, src[offset], actualLen);
+            offset += actualLen;
+            remain -= actualLen;
+        }
+    }
+
+    CATLASS_DEVICE
+    ~PrefetchGmToL2() {}
+
+private:
+    AscendC::LocalTensor<Element> ubBuffer;
+    static_assert(COMPUTE_LENGTH % ELE_NUM_PER_BLK == 0, "COMPUTE_LENGTH must be aligned to 32B!");
+    static_assert(COMPUTE_LENGTH * sizeof(Element) <= ArchTag::UB_SIZE, "Excedding the UB space!");
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_PREFETCH_L2_HPP
@@ -95,10 +95,10 @@ public:
         GM_ADDR ptrWorkspace;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             GemmCoord problemShape_,
             GM_ADDR ptrA_, LayoutA layoutA_,
@@ -117,6 +117,43 @@ public:
             ptrWorkspace(ptrWorkspace_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        GM_ADDR ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        GM_ADDR ptrD;
+        LayoutD layoutD;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // Accumulators of the whole problem, dequantized by the AIV cores.
+        return static_cast<size_t>(args.problemShape.m()) * args.problemShape.n() * sizeof(ElementC);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape,
+            args.ptrA, args.layoutA,
+            args.ptrB, args.layoutB,
+            args.ptrScale, args.layoutScale,
+            args.ptrPerTokenScale, args.layoutPerTokenScale,
+            args.ptrD, args.layoutD,
+            workspace};
+    }
+
     // Methods
     CATLASS_DEVICE
     QuantMatmul() {}
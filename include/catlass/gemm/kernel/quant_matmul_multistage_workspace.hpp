@@ -70,10 +70,10 @@ public:
         GM_ADDR ptrWorkspace;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(
             GemmCoord problemShape_,
             GM_ADDR ptrA_, LayoutA layoutA_,
@@ -94,6 +94,46 @@ public:
         }
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        GM_ADDR ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        GM_ADDR ptrD;
+        LayoutD layoutD;
+        // Number of cube cores of the launch, each one owns WORKSPACE_STAGES tiles of the workspace.
+        uint32_t aicCoreNum;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return args.aicCoreNum > 0;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // WORKSPACE_STAGES L1 tiles of accumulators per cube core, reused across the tiles of the core.
+        return static_cast<size_t>(L1TileShape::M) * L1TileShape::N * args.aicCoreNum * WORKSPACE_STAGES *
+            sizeof(ElementC);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape,
+            args.ptrA, args.layoutA,
+            args.ptrB, args.layoutB,
+            args.ptrScale, args.layoutScale,
+            args.ptrPerTokenScale, args.layoutPerTokenScale,
+            args.ptrD, args.layoutD,
+            workspace};
+    }
+
     // Methods
     CATLASS_DEVICE
     QuantMatmulMultiStageWorkspace()
@@ -0,0 +1,375 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_QUANT_MATMUL_PER_GROUP_HPP
+#define CATLASS_GEMM_KERNEL_QUANT_MATMUL_PER_GROUP_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/detail/callback.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+// Template for W8A8 matmul kernel with per-group scales along k. The k axis is split into groups of groupSize: the
+// AIC core computes the int32 partial sum of every group of a block into a multi-stage workspace, and the
+// EpilogueAtlasA2PerGroupDequant block epilogue dequantizes each partial with the scales of its group,
+//   D = sum over g of (C_g * scale[g][n]) * perTokenScale[g][m]
+// accumulating in fp32 in a workspace tile per cube core. The scales are fp32, the weight scales being one row of n
+// per group and the activation scales one row of m per group: 1 x groupSize activation blocks and groupSize x 1
+// weight blocks. Coarser weight blocks such as 128 x 128 are expanded along n on the host.
+template <
+    class BlockMmad_,
+    class BlockEpilogue_,
+    class BlockScheduler_,
+    uint32_t WORKSPACE_STAGES_
+>
+class QuantMatmulPerGroup {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+    using ElementAccumulator = typename BlockMmad::ElementAccumulator;
+
+    using BlockEpilogue = BlockEpilogue_;
+    using ElementScale = typename BlockEpilogue::ElementScale;
+    using LayoutScale = typename BlockEpilogue::LayoutScale;
+    using ElementPerTokenScale = typename BlockEpilogue::ElementPerTokenScale;
+    using LayoutPerTokenScale = typename BlockEpilogue::LayoutPerTokenScale;
+    using ElementD = typename BlockEpilogue::ElementD;
+    using LayoutD = typename BlockEpilogue::LayoutD;
+    using EpilogueParams = typename BlockEpilogue::Params;
+
+    using BlockScheduler = BlockScheduler_;
+    static constexpr uint32_t WORKSPACE_STAGES = WORKSPACE_STAGES_;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        uint32_t groupSize;
+        __gm__ ElementA *ptrA;
+        LayoutA layoutA;
+        __gm__ ElementB *ptrB;
+        LayoutB layoutB;
+        __gm__ ElementScale *ptrScale;
+        LayoutScale layoutScale;
+        __gm__ ElementPerTokenScale *ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        __gm__ ElementD *ptrD;
+        LayoutD layoutD;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(
+            GemmCoord problemShape_, uint32_t groupSize_,
+            GM_ADDR ptrA_, LayoutA layoutA_,
+            GM_ADDR ptrB_, LayoutB layoutB_,
+            GM_ADDR ptrScale_, LayoutScale layoutScale_,
+            GM_ADDR ptrPerTokenScale_, LayoutPerTokenScale layoutPerTokenScale_,
+            GM_ADDR ptrD_, LayoutD layoutD_,
+            GM_ADDR ptrWorkspace_
+        ) : problemShape(problemShape_), groupSize(groupSize_),
+            ptrA(reinterpret_cast<__gm__ ElementA *>(ptrA_)), layoutA(layoutA_),
+            ptrB(reinterpret_cast<__gm__ ElementB *>(ptrB_)), layoutB(layoutB_),
+            ptrScale(reinterpret_cast<__gm__ ElementScale *>(ptrScale_)), layoutScale(layoutScale_),
+            ptrPerTokenScale(reinterpret_cast<__gm__ ElementPerTokenScale *>(ptrPerTokenScale_)),
+            layoutPerTokenScale(layoutPerTokenScale_),
+            ptrD(reinterpret_cast<__gm__ ElementD *>(ptrD_)), layoutD(layoutD_),
+            ptrWorkspace(ptrWorkspace_)
+        {
+        }
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        uint32_t groupSize;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrScale;
+        LayoutScale layoutScale;
+        GM_ADDR ptrPerTokenScale;
+        LayoutPerTokenScale layoutPerTokenScale;
+        GM_ADDR ptrD;
+        LayoutD layoutD;
+        // Number of cube cores of the launch, each one owns WORKSPACE_STAGES tiles of the workspace.
+        uint32_t aicCoreNum;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return (args.aicCoreNum > 0) && (args.groupSize > 0);
+    }
+
+    /// Bytes of the int32 partial sums, WORKSPACE_STAGES L1 tiles per cube core reused across the groups and tiles
+    /// of the core.
+    CATLASS_HOST_DEVICE
+    static size_t GetWorkspaceSizeC(uint32_t aicCoreNum)
+    {
+        return static_cast<size_t>(L1TileShape::M) * L1TileShape::N * aicCoreNum * WORKSPACE_STAGES *
+            sizeof(ElementC);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // Followed by one L1 tile of fp32 accumulators per cube core
+        return GetWorkspaceSizeC(args.aicCoreNum) +
+            static_cast<size_t>(L1TileShape::M) * L1TileShape::N * args.aicCoreNum * sizeof(float);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{
+            args.problemShape, args.groupSize,
+            args.ptrA, args.layoutA,
+            args.ptrB, args.layoutB,
+            args.ptrScale, args.layoutScale,
+            args.ptrPerTokenScale, args.layoutPerTokenScale,
+            args.ptrD, args.layoutD,
+            workspace};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    QuantMatmulPerGroup()
+    {
+        Arch::FlagID flagId = 0;
+        for (uint32_t stageId = 0; stageId < WORKSPACE_STAGES; ++stageId) {
+            flagAicFinishStoreList[stageId] = Arch::CrossCoreFlag(flagId++);
+            flagAivFinishComputeList[stageId] = Arch::CrossCoreFlag(flagId++);
+            aicWaitFuncList[stageId] = {this, stageId};
+            aicSetFuncList[stageId] = {this, stageId};
+        }
+    }
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params)
+    {
+        BlockScheduler blockScheduler;
+        blockScheduler.Update(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+        uint32_t k = params.problemShape.k();
+        uint32_t groupNum = CeilDiv(k, params.groupSize);
+
+        BlockMmad blockMmad(resource);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(params.ptrA);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer(params.ptrB);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC *>(params.ptrWorkspace));
+        auto layoutC = layout::RowMajor{L1TileShape::M * coreNum * WORKSPACE_STAGES, L1TileShape::N};
+
+        uint32_t stageId = 0;
+        uint32_t stageUsed = 0;
+
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            // Compute block location
+            GemmCoord blockCoord = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = blockScheduler.GetActualBlockShape(blockCoord);
+
+            // Every group of the block is a separate accumulation handed to the AIV
+            for (uint32_t groupIdx = 0; groupIdx < groupNum; ++groupIdx) {
+                uint32_t kOffset = groupIdx * params.groupSize;
+                uint32_t actualGroupSize = (k - kOffset < params.groupSize) ? (k - kOffset) : params.groupSize;
+                GemmCoord actualGroupShape{actualBlockShape.m(), actualBlockShape.n(), actualGroupSize};
+
+                Callback callbackBeforeFixpipe{};
+                if (stageUsed == WORKSPACE_STAGES) {
+                    callbackBeforeFixpipe = MakeCallback(&aicWaitFuncList[stageId]);
+                } else {
+                    ++stageUsed;
+                }
+                Callback callbackAfterFixpipe = MakeCallback(&aicSetFuncList[stageId]);
+
+                // Compute initial location in logical coordinates
+                MatrixCoord offsetA{blockCoord.m() * L1TileShape::M, kOffset};
+                MatrixCoord offsetB{kOffset, blockCoord.n() * L1TileShape::N};
+                MatrixCoord offsetC{(stageId * coreNum + coreIdx) * L1TileShape::M, 0};
+                int64_t gmOffsetA = params.layoutA.GetOffset(offsetA);
+                int64_t gmOffsetB = params.layoutB.GetOffset(offsetB);
+                int64_t gmOffsetC = layoutC.GetOffset(offsetC);
+
+                // Compute block-scoped matrix multiply-add of the group
+                if constexpr (BlockMmad::DispatchPolicy::ASYNC) {
+                    blockMmad(
+                        gmA[gmOffsetA], params.layoutA,
+                        gmB[gmOffsetB], params.layoutB,
+                        gmC[gmOffsetC], layoutC,
+                        actualGroupShape,
+                        callbackBeforeFixpipe, callbackAfterFixpipe
+                    );
+                } else {
+                    callbackBeforeFixpipe();
+                    blockMmad(
+                        gmA[gmOffsetA], params.layoutA,
+                        gmB[gmOffsetB], params.layoutB,
+                        gmC[gmOffsetC], layoutC,
+                        actualGroupShape
+                    );
+                    callbackAfterFixpipe();
+                }
+
+                stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+            }
+        }
+
+        if constexpr (BlockMmad::DispatchPolicy::ASYNC) {
+            blockMmad.SynchronizeBlock();
+        }
+
+        while (stageUsed > 0) {
+            uint32_t aivComputeStageId = (stageId >= stageUsed) ?
+                (stageId - stageUsed) : (stageId + WORKSPACE_STAGES - stageUsed);
+            Arch::CrossCoreWaitFlag(flagAivFinishComputeList[aivComputeStageId]);
+            --stageUsed;
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params)
+    {
+        BlockScheduler blockScheduler;
+        BlockEpilogue blockEpilogue(resource);
+
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t k = params.problemShape.k();
+        uint32_t groupNum = CeilDiv(k, params.groupSize);
+
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC *>(params.ptrWorkspace));
+        auto layoutC = layout::RowMajor{L1TileShape::M * coreNum * WORKSPACE_STAGES, L1TileShape::N};
+
+        // The fp32 accumulators of the block in flight on this core
+        AscendC::GlobalTensor<float> gmAcc;
+        gmAcc.SetGlobalBuffer(reinterpret_cast<__gm__ float *>(params.ptrWorkspace + GetWorkspaceSizeC(coreNum)));
+        auto layoutAcc = layout::RowMajor{L1TileShape::M * coreNum, L1TileShape::N};
+        auto gmCoreAcc = gmAcc[layoutAcc.GetOffset(MatrixCoord{coreIdx * L1TileShape::M, 0})];
+
+        uint32_t stageId = 0;
+
+        LayoutScale layoutScale = params.layoutScale.GetTileLayout(params.problemShape.template GetCoordByAxis<1>());
+        LayoutPerTokenScale layoutPerTokenScale =
+            params.layoutPerTokenScale.GetTileLayout(params.problemShape.template GetCoordByAxis<0>());
+        LayoutD layoutD = params.layoutD.GetTileLayout(params.problemShape.GetCoordMN());
+
+        blockScheduler.Update(params.problemShape, L1TileShape::ToCoordMN());
+        uint32_t coreLoops = blockScheduler.GetCoreLoops();
+
+        GemmCoord blockShapeMNK = L1TileShape::ToCoord();
+        for (uint32_t loopIdx = coreIdx; loopIdx < coreLoops; loopIdx += coreNum) {
+            GemmCoord blockCoordMNK = blockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShapeMNK = blockScheduler.GetActualBlockShape(blockCoordMNK);
+            auto layoutBlockAcc = layoutAcc.GetTileLayout(actualBlockShapeMNK.GetCoordMN());
+
+            for (uint32_t groupIdx = 0; groupIdx < groupNum; ++groupIdx) {
+                // The scales of the group
+                EpilogueParams epilogueParams{
+                    params.ptrScale + static_cast<int64_t>(groupIdx) * n, layoutScale,
+                    params.ptrPerTokenScale + static_cast<int64_t>(groupIdx) * m, layoutPerTokenScale,
+                    params.ptrD, layoutD
+                };
+                blockEpilogue.UpdateParams(epilogueParams);
+
+                MatrixCoord offsetC{(stageId * coreNum + coreIdx) * L1TileShape::M, 0};
+                int64_t gmOffsetC = layoutC.GetOffset(offsetC);
+                auto gmBlockC = gmC[gmOffsetC];
+                auto layoutBlockC = layoutC.GetTileLayout(actualBlockShapeMNK.GetCoordMN());
+
+                Arch::CrossCoreWaitFlag(flagAicFinishStoreList[stageId]);
+                blockEpilogue(blockShapeMNK, blockCoordMNK, actualBlockShapeMNK, gmBlockC, layoutBlockC,
+                    gmCoreAcc, layoutBlockAcc, groupIdx == 0, groupIdx + 1 == groupNum);
+                Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagAivFinishComputeList[stageId]);
+
+                stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+            }
+        }
+    }
+
+private:
+    friend struct AicWaitFunc;
+    friend struct AicSetFunc;
+
+    struct AicWaitFunc {
+        using MatmulKernel = QuantMatmulPerGroup<BlockMmad, BlockEpilogue, BlockScheduler,
+            WORKSPACE_STAGES>;
+
+        CATLASS_DEVICE
+        AicWaitFunc() = default;
+
+        CATLASS_DEVICE
+        void operator()() const
+        {
+            Arch::CrossCoreWaitFlag(ptr->flagAivFinishComputeList[stageId]);
+        }
+
+        MatmulKernel *ptr{nullptr};
+        uint32_t stageId;
+    };
+
+    struct AicSetFunc {
+        using MatmulKernel = QuantMatmulPerGroup<BlockMmad, BlockEpilogue, BlockScheduler,
+            WORKSPACE_STAGES>;
+
+        CATLASS_DEVICE
+        AicSetFunc() = default;
+
+        CATLASS_DEVICE
+        void operator()() const
+        {
+            Arch::CrossCoreSetFlag<0x2, PIPE_FIX>(ptr->flagAicFinishStoreList[stageId]);
+        }
+
+        MatmulKernel *ptr{nullptr};
+        uint32_t stageId;
+    };
+
+    Arch::CrossCoreFlag flagAicFinishStoreList[WORKSPACE_STAGES];
+    Arch::CrossCoreFlag flagAivFinishComputeList[WORKSPACE_STAGES];
+
+    AicWaitFunc aicWaitFuncList[WORKSPACE_STAGES];
+    AicSetFunc aicSetFuncList[WORKSPACE_STAGES];
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_QUANT_MATMUL_PER_GROUP_HPP
\ No newline at end of file
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_REQUANT_MATMUL_HPP
+#define CATLASS_GEMM_KERNEL_REQUANT_MATMUL_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/gemm/tile/copy_gm_to_l1.hpp"
+#include "catlass/gemm/tile/copy_l0c_to_gm.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+// Template for int8 matmul kernel with a requantized int8 output. Compute C = requant(A * B): the fixpipe turns
+// the int32_t accumulator into int8_t with one quant parameter for the whole matrix (PER_TENSOR) or one per column
+// of C (PER_CHANNEL), so the result feeds the next int8 GEMM without a separate quantization op. The quant
+// parameters are encoded by Tile::FixpipeRequantParam. BlockMmad must use a QuantTileCopy.
+template <
+    class BlockMmad_,
+    class BlockScheduler_
+>
+class RequantMatmul {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+    using ElementAccumulator = typename BlockMmad::ElementAccumulator;
+
+    using BlockScheduler = BlockScheduler_;
+
+    static constexpr Tile::ScaleGranularity DEQUANT_GRANULARITY = BlockMmad::CopyL0CToGm::DEQUANT_GRANULARITY;
+    static_assert(DEQUANT_GRANULARITY == Tile::ScaleGranularity::PER_TENSOR ||
+        DEQUANT_GRANULARITY == Tile::ScaleGranularity::PER_CHANNEL,
+        "RequantMatmul needs a PER_TENSOR or PER_CHANNEL quant parameter.");
+    static constexpr bool IS_PER_CHANNEL = DEQUANT_GRANULARITY == Tile::ScaleGranularity::PER_CHANNEL;
+
+    using ElementQuant = uint64_t;
+    using CopyGmToL1Quant = Tile::CopyGmToL1<ArchTag,
+        Gemm::GemmType<ElementQuant, layout::VectorLayout, AscendC::TPosition::GM>,
+        Gemm::GemmType<ElementQuant, layout::VectorLayout, AscendC::TPosition::A1>>;
+    static constexpr uint32_t QUANT_NUM_PER_C0 = BYTE_PER_C0 / sizeof(ElementQuant);
+    // The per channel quant parameters of one block are staged in L1 in front of the buffers of BlockMmad.
+    static constexpr uint32_t L1_QUANT_SIZE = IS_PER_CHANNEL ?
+        RoundUp<BYTE_PER_C0>(static_cast<uint32_t>(L1TileShape::N * sizeof(ElementQuant))) : 0;
+    static_assert(L1_QUANT_SIZE + (BlockMmad::L1A_SIZE + BlockMmad::L1B_SIZE) * BlockMmad::STAGES <=
+        ArchTag::L1_SIZE, "L1TileShape exceeding the L1 space with the quant parameters!");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        uint64_t quantScalar;
+        GM_ADDR ptrQuant;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(GemmCoord const &problemShape_, GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrB_,
+               LayoutB layoutB_, GM_ADDR ptrC_, LayoutC layoutC_, uint64_t quantScalar_, GM_ADDR ptrQuant_)
+            : problemShape(problemShape_), ptrA(ptrA_), layoutA(layoutA_), ptrB(ptrB_), layoutB(layoutB_),
+              ptrC(ptrC_), layoutC(layoutC_), quantScalar(quantScalar_), ptrQuant(ptrQuant_) {}
+    };
+
+    /// quantScalar is used for PER_TENSOR. For PER_CHANNEL ptrQuant holds n parameters; they are read in 32B
+    /// blocks, so the buffer must hold RoundUp(n, 4) of them.
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        uint64_t quantScalar;
+        GM_ADDR ptrQuant;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return !IS_PER_CHANNEL || (args.ptrQuant != nullptr);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, args.ptrC, args.layoutC,
+            args.quantScalar, args.ptrQuant};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    RequantMatmul() {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    /// Executes one Matmul
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params) {
+        BlockScheduler matmulBlockScheduler(params.problemShape, MakeCoord(L1TileShape::M, L1TileShape::N));
+        uint32_t coreLoops = matmulBlockScheduler.GetCoreLoops();
+
+        Arch::Resource<ArchTag> resource;
+        BlockMmad blockMmad(resource, L1_QUANT_SIZE);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer((__gm__ ElementA *)params.ptrA);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer((__gm__ ElementB *)params.ptrB);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer((__gm__ ElementC *)params.ptrC);
+        AscendC::GlobalTensor<ElementQuant> gmQuant;
+        AscendC::LocalTensor<ElementQuant> l1QuantTensor;
+        if constexpr (IS_PER_CHANNEL) {
+            gmQuant.SetGlobalBuffer((__gm__ ElementQuant *)params.ptrQuant);
+            l1QuantTensor = resource.l1Buf.template GetBufferByByte<ElementQuant>(0);
+            // The fixpipe of the previous block must have read the parameters before they are overwritten.
+            AscendC::SetFlag<AscendC::HardEvent::FIX_MTE2>(EVENT_ID0);
+        }
+
+        for (uint32_t loopIdx = AscendC::GetBlockIdx(); loopIdx < coreLoops; loopIdx += AscendC::GetBlockNum()) {
+            // Compute block location
+            GemmCoord blockCoord = matmulBlockScheduler.GetBlockCoord(loopIdx);
+            GemmCoord actualBlockShape = matmulBlockScheduler.GetActualBlockShape(blockCoord);
+
+            // Compute initial location in logical coordinates
+            MatrixCoord offsetA{blockCoord.m() * L1TileShape::M, blockCoord.k() * L1TileShape::K};
+            MatrixCoord offsetB{blockCoord.k() * L1TileShape::K, blockCoord.n() * L1TileShape::N};
+            MatrixCoord offsetC{blockCoord.m() * L1TileShape::M, blockCoord.n() * L1TileShape::N};
+            int64_t gmOffsetA = params.layoutA.GetOffset(offsetA);
+            int64_t gmOffsetB = params.layoutB.GetOffset(offsetB);
+            int64_t gmOffsetC = params.layoutC.GetOffset(offsetC);
+
+            // Compute block-scoped matrix multiply-add, requantizing in the fixpipe
+            if constexpr (IS_PER_CHANNEL) {
+                int64_t gmOffsetQuant = blockCoord.n() * L1TileShape::N;
+                auto layoutQuant = layout::VectorLayout(RoundUp<QUANT_NUM_PER_C0>(actualBlockShape.n()));
+                AscendC::WaitFlag<AscendC::HardEvent::FIX_MTE2>(EVENT_ID0);
+                copyGmToL1Quant(l1QuantTensor, gmQuant[gmOffsetQuant], layoutQuant, layoutQuant);
+                AscendC::SetFlag<AscendC::HardEvent::MTE2_FIX>(EVENT_ID0);
+                AscendC::WaitFlag<AscendC::HardEvent::MTE2_FIX>(EVENT_ID0);
+                blockMmad(gmA[gmOffsetA], params.layoutA,
+                          gmB[gmOffsetB], params.layoutB,
+                          gmC[gmOffsetC], params.layoutC,
+                          actualBlockShape, l1QuantTensor);
+                AscendC::SetFlag<AscendC::HardEvent::FIX_MTE2>(EVENT_ID0);
+            } else {
+                blockMmad(gmA[gmOffsetA], params.layoutA,
+                          gmB[gmOffsetB], params.layoutB,
+                          gmC[gmOffsetC], params.layoutC,
+                          actualBlockShape, params.quantScalar);
+            }
+        }
+
+        if constexpr (IS_PER_CHANNEL) {
+            AscendC::WaitFlag<AscendC::HardEvent::FIX_MTE2>(EVENT_ID0);
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params) {}
+
+private:
+    CopyGmToL1Quant copyGmToL1Quant;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_REQUANT_MATMUL_HPP
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_SKINNY_MATMUL_HPP
+#define CATLASS_GEMM_KERNEL_SKINNY_MATMUL_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/gemm/kernel/skinny_matmul_strategy.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+// Template for skinny Matmul kernel, e.g. decode with a batch of up to 16 tokens. Compute C = A * B with all m
+// rows of A in one 16 row cube tile, so B is streamed from GM exactly once. Instead of dealing L1 tiles round
+// robin, every core takes one contiguous, fractal aligned range of the n columns (SkinnyColumnPartition) and walks
+// it in L1TileShape::N steps over the full k, so all cores read B in a single wave. Use
+// SkinnyMatmulCostModel to choose between this kernel, KernelGemvAiv and BasicMatmul.
+template <
+    class BlockMmad_
+>
+class SkinnyMatmul {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+    using ElementAccumulator = typename BlockMmad::ElementAccumulator;
+
+    static_assert(L1TileShape::M == C0_NUM_PER_FRACTAL,
+        "SkinnyMatmul keeps all rows of A in one fractal, L1TileShape::M must be 16.");
+    static_assert(L1TileShape::N % SkinnyColumnPartition::COLUMN_ALIGN == 0,
+        "L1TileShape::N must be a multiple of SkinnyColumnPartition::COLUMN_ALIGN.");
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(GemmCoord const &problemShape_, GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrB_,
+               LayoutB layoutB_, GM_ADDR ptrC_, LayoutC layoutC_)
+            : problemShape(problemShape_), ptrA(ptrA_), layoutA(layoutA_), ptrB(ptrB_), layoutB(layoutB_),
+              ptrC(ptrC_), layoutC(layoutC_) {}
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        // Larger m belongs to BasicMatmul.
+        return args.problemShape.m() <= L1TileShape::M;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, args.ptrC, args.layoutC};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    SkinnyMatmul() {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    /// Executes one Matmul
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params) {
+        uint32_t n = params.problemShape.n();
+        uint32_t columnsPerCore = SkinnyColumnPartition::ColumnsPerCore(n, AscendC::GetBlockNum());
+        uint32_t nStart = AscendC::GetBlockIdx() * columnsPerCore;
+        if (nStart >= n) {
+            return;
+        }
+        uint32_t nEnd = (n - nStart > columnsPerCore) ? (nStart + columnsPerCore) : n;
+
+        Arch::Resource<ArchTag> resource;
+        BlockMmad blockMmad(resource);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer((__gm__ ElementA *)params.ptrA);
+        AscendC::GlobalTensor<ElementB> gmB;
+        gmB.SetGlobalBuffer((__gm__ ElementB *)params.ptrB);
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer((__gm__ ElementC *)params.ptrC);
+
+        for (uint32_t nOffset = nStart; nOffset < nEnd; nOffset += L1TileShape::N) {
+            uint32_t nActual = (nEnd - nOffset > L1TileShape::N) ? L1TileShape::N : (nEnd - nOffset);
+            GemmCoord actualBlockShape{params.problemShape.m(), nActual, params.problemShape.k()};
+
+            // Compute initial location in logical coordinates
+            MatrixCoord offsetB{0U, nOffset};
+            MatrixCoord offsetC{0U, nOffset};
+            int64_t gmOffsetB = params.layoutB.GetOffset(offsetB);
+            int64_t gmOffsetC = params.layoutC.GetOffset(offsetC);
+
+            // Compute block-scoped matrix multiply-add over the full k
+            blockMmad(gmA, params.layoutA,
+                      gmB[gmOffsetB], params.layoutB,
+                      gmC[gmOffsetC], params.layoutC,
+                      actualBlockShape);
+        }
+    }
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params) {}
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_SKINNY_MATMUL_HPP
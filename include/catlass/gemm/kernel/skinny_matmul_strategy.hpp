@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_SKINNY_MATMUL_STRATEGY_HPP
+#define CATLASS_GEMM_KERNEL_SKINNY_MATMUL_STRATEGY_HPP
+
+#include <cstdint>
+
+#include "catlass/detail/alignment.hpp"
+#include "catlass/detail/macros.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Split of the n columns of C over the cores for SkinnyMatmul: every core takes one contiguous range of
+/// COLUMN_ALIGN aligned columns, so all cores stream B in a single wave however n compares to the cube tile.
+struct SkinnyColumnPartition {
+    /// One fractal of C, which also keeps every range 32B aligned in GM.
+    static constexpr uint32_t COLUMN_ALIGN = 16;
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t ColumnsPerCore(uint32_t n, uint32_t coreNum)
+    {
+        return RoundUp<COLUMN_ALIGN>(CeilDiv(n, coreNum));
+    }
+
+    /// Number of cores with a non empty range.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t ActiveCores(uint32_t n, uint32_t coreNum)
+    {
+        return CeilDiv(n, ColumnsPerCore(n, coreNum));
+    }
+};
+
+enum class SkinnyMatmulPath : uint32_t {
+    GEMV = 0,       // KernelGemvAiv once per row of A
+    SKINNY_GEMM,    // SkinnyMatmul, all rows of A in one 16 row cube tile
+    GEMM            // BasicMatmul with 128 x 256 tiles
+};
+
+/// Host side choice between the three ways of computing C (m x n) = A (m x k) * B (k x n) for small m, e.g. decode
+/// with a small batch. Every path is modelled as max(GM traffic, compute) plus its fixed costs:
+/// - GEMV streams all of B once per row of A on the AIV cores, in blocks of GEMV_TILE_ROWS output elements dealt
+///   round robin to the cores;
+/// - SKINNY_GEMM streams B once on the AIC cores, one SkinnyColumnPartition range per core, computing 16 padded
+///   rows in tiles of SKINNY_TILE_N columns;
+/// - GEMM reads B once per GEMM_TILE_M rows and A once per GEMM_TILE_N columns, in 128 x 256 blocks dealt round
+///   robin to the cores.
+/// GM traffic is limited both per core (MTE2) and by the shared HBM, so a wave of blocks that leaves cores idle
+/// reads at a lower rate. Ties go to the earlier path in SkinnyMatmulPath, which has the lower fixed cost. The
+/// cycle counts are relative estimates, only their ratio decides the path.
+struct SkinnyMatmulCostModel {
+    static constexpr uint32_t CORE_BYTES_PER_CYCLE = 32;
+    static constexpr uint32_t HBM_BYTES_PER_CYCLE = 768;
+    static constexpr uint32_t CUBE_MACS_PER_CYCLE = 16 * 16 * 16;
+    static constexpr uint32_t VECTOR_MACS_PER_CYCLE = 64;
+    static constexpr uint32_t LAUNCH_CYCLES = 4000;
+    static constexpr uint32_t CUBE_BLOCK_CYCLES = 1000;
+    static constexpr uint32_t VECTOR_BLOCK_CYCLES = 300;
+
+    static constexpr uint32_t GEMV_TILE_ROWS = 32;
+    static constexpr uint32_t SKINNY_TILE_M = 16;
+    static constexpr uint32_t SKINNY_TILE_N = 128;
+    static constexpr uint32_t GEMM_TILE_M = 128;
+    static constexpr uint32_t GEMM_TILE_N = 256;
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t Max(uint64_t a, uint64_t b)
+    {
+        return (a > b) ? a : b;
+    }
+
+    /// Cycles to read `bytes` with `activeCores` cores reading in parallel.
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t TrafficCycles(uint64_t bytes, uint32_t activeCores)
+    {
+        uint64_t bytesPerCycle = static_cast<uint64_t>(activeCores) * CORE_BYTES_PER_CYCLE;
+        if (bytesPerCycle > HBM_BYTES_PER_CYCLE) {
+            bytesPerCycle = HBM_BYTES_PER_CYCLE;
+        }
+        return CeilDiv(bytes, bytesPerCycle);
+    }
+
+    /// Cycles to read blockNum blocks of blockBytes each, dealt round robin to coreNum cores.
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t WaveTrafficCycles(uint64_t blockBytes, uint32_t blockNum, uint32_t coreNum)
+    {
+        uint32_t fullWaves = blockNum / coreNum;
+        uint32_t lastWave = blockNum % coreNum;
+        return fullWaves * TrafficCycles(blockBytes * coreNum, coreNum) +
+            ((lastWave == 0) ? 0 : TrafficCycles(blockBytes * lastWave, lastWave));
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t GemvCycles(uint32_t m, uint32_t n, uint32_t k, uint32_t elementBytes,
+        uint32_t aivNum)
+    {
+        uint32_t blockNum = CeilDiv(n, GEMV_TILE_ROWS);
+        uint32_t waves = CeilDiv(blockNum, aivNum);
+        uint64_t blockBytes = static_cast<uint64_t>(GEMV_TILE_ROWS) * k * elementBytes;
+        uint64_t macCycles = waves * CeilDiv<VECTOR_MACS_PER_CYCLE>(static_cast<uint64_t>(GEMV_TILE_ROWS) * k);
+        uint64_t perRow = Max(WaveTrafficCycles(blockBytes, blockNum, aivNum), macCycles) +
+            waves * VECTOR_BLOCK_CYCLES + LAUNCH_CYCLES;
+        return m * perRow;
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t SkinnyGemmCycles(uint32_t m, uint32_t n, uint32_t k, uint32_t elementBytes,
+        uint32_t aicNum)
+    {
+        uint32_t columnsPerCore = SkinnyColumnPartition::ColumnsPerCore(n, aicNum);
+        uint32_t activeCores = SkinnyColumnPartition::ActiveCores(n, aicNum);
+        uint32_t tilesPerCore = CeilDiv(columnsPerCore, SKINNY_TILE_N);
+        // B once, A once per tile
+        uint64_t bytes = (static_cast<uint64_t>(n) + static_cast<uint64_t>(m) * tilesPerCore * activeCores) *
+            k * elementBytes;
+        uint64_t macCycles = tilesPerCore *
+            CeilDiv<CUBE_MACS_PER_CYCLE>(static_cast<uint64_t>(SKINNY_TILE_M) * SKINNY_TILE_N * k);
+        return Max(TrafficCycles(bytes, activeCores), macCycles) + tilesPerCore * CUBE_BLOCK_CYCLES + LAUNCH_CYCLES;
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t GemmCycles(uint32_t m, uint32_t n, uint32_t k, uint32_t elementBytes,
+        uint32_t aicNum)
+    {
+        uint32_t mBlocks = CeilDiv(m, GEMM_TILE_M);
+        uint32_t nBlocks = CeilDiv(n, GEMM_TILE_N);
+        uint32_t blockNum = mBlocks * nBlocks;
+        uint32_t waves = CeilDiv(blockNum, aicNum);
+        uint32_t mRound = RoundUp<SKINNY_TILE_M>((m < GEMM_TILE_M) ? m : GEMM_TILE_M);
+        // One row block of B and one column block of A
+        uint64_t blockBytes = (static_cast<uint64_t>(GEMM_TILE_N) + mRound) * k * elementBytes;
+        uint64_t macCycles = waves * CeilDiv<CUBE_MACS_PER_CYCLE>(static_cast<uint64_t>(mRound) * GEMM_TILE_N * k);
+        return Max(WaveTrafficCycles(blockBytes, blockNum, aicNum), macCycles) + waves * CUBE_BLOCK_CYCLES +
+            LAUNCH_CYCLES;
+    }
+
+    /// SKINNY_GEMM is only eligible while A fits in one 16 row tile.
+    CATLASS_HOST_DEVICE
+    static constexpr SkinnyMatmulPath Select(uint32_t m, uint32_t n, uint32_t k, uint32_t elementBytes,
+        uint32_t aicNum)
+    {
+        uint64_t gemv = GemvCycles(m, n, k, elementBytes, 2 * aicNum);
+        uint64_t gemm = GemmCycles(m, n, k, elementBytes, aicNum);
+        uint64_t skinny = (m <= SKINNY_TILE_M) ? SkinnyGemmCycles(m, n, k, elementBytes, aicNum) : gemm + 1;
+        if (gemv <= skinny && gemv <= gemm) {
+            return SkinnyMatmulPath::GEMV;
+        }
+        return (skinny <= gemm) ? SkinnyMatmulPath::SKINNY_GEMM : SkinnyMatmulPath::GEMM;
+    }
+
+    /// The smallest m in [1, maxM] at which Select picks a later path than `from`, or maxM + 1 if it never does.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t Crossover(SkinnyMatmulPath from, uint32_t n, uint32_t k, uint32_t elementBytes,
+        uint32_t aicNum, uint32_t maxM)
+    {
+        for (uint32_t m = 1; m <= maxM; ++m) {
+            if (Select(m, n, k, elementBytes, aicNum) > from) {
+                return m;
+            }
+        }
+        return maxM + 1;
+    }
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_SKINNY_MATMUL_STRATEGY_HPP
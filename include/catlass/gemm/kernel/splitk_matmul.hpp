@@ -197,16 +197,47 @@ public:
         uint32_t splitkFactor = 1;
 
         // Methods
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params() {}
 
-        CATLASS_DEVICE
+        CATLASS_HOST_DEVICE
         Params(GemmCoord const &problemShape_, GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrB_,
                LayoutB layoutB_, GM_ADDR ptrC_, LayoutC layoutC_, GM_ADDR ptrWorkspace_, uint32_t splitkFactor_)
             : problemShape(problemShape_), ptrA(ptrA_), layoutA(layoutA_), ptrB(ptrB_), layoutB(layoutB_),
               ptrC(ptrC_), layoutC(layoutC_), ptrWorkspace(ptrWorkspace_), splitkFactor(splitkFactor_) {}
     };
 
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        LayoutB layoutB;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        uint32_t splitkFactor;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        // Every slice must own at least one k tile, an empty slice would leave its partial sums unwritten.
+        return (args.splitkFactor > 0) &&
+            (args.splitkFactor <= CeilDiv(args.problemShape.k(), static_cast<uint32_t>(L1TileShape::K)));
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // One m x n partial result per k slice, summed up by the AIV cores.
+        return static_cast<size_t>(args.problemShape.m()) * args.problemShape.n() * args.splitkFactor *
+            sizeof(ElementC);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrB, args.layoutB, args.ptrC, args.layoutC,
+            workspace, args.splitkFactor};
+    }
+
     // Methods
     CATLASS_DEVICE
     SplitkMatmul() {}
@@ -0,0 +1,465 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_KERNEL_WEIGHT_ONLY_QUANT_MATMUL_HPP
+#define CATLASS_GEMM_KERNEL_WEIGHT_ONLY_QUANT_MATMUL_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/gemm_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/arch/cross_core_sync.hpp"
+#include "catlass/epilogue/tile/copy_gm_to_ub.hpp"
+#include "catlass/epilogue/tile/copy_ub_to_gm.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_add.hpp"
+#include "catlass/epilogue/tile/tile_broadcast_mul.hpp"
+#include "catlass/layout/layout.hpp"
+
+namespace Catlass::Gemm::Kernel {
+
+/// Number of quantized weight elements stored in one byte of GM.
+template <class ElementQuant>
+struct QuantElementsPerByte {
+    static constexpr uint32_t VALUE = 1;
+};
+
+/// int4 weights are packed two per byte along n, the even column in the low nibble.
+template <>
+struct QuantElementsPerByte<AscendC::int4b_t> {
+    static constexpr uint32_t VALUE = 2;
+};
+
+// Dequantize a k x TileShape::COLUMN panel of a row major int8 or packed int4 weight with per-group scales and zero
+// points: W[r][c] = (Q[r][c] - zero[r / groupSize][c]) * scale[r / groupSize][c]. The panel is processed in tiles of
+// TileShape::ROW rows, a tile never crosses a group, shared by the subblocks of an AIV core. Every value is
+// dequantized in fp32 and rounded once to ElementOut.
+template <
+    class ArchTag_,
+    class ElementQuant_,
+    class ElementScale_,
+    class ElementOut_,
+    class TileShape_
+>
+struct WeightDequantPanel {
+public:
+    using ArchTag = ArchTag_;
+    using ElementQuant = ElementQuant_;
+    using ElementScale = ElementScale_;
+    using ElementOut = ElementOut_;
+    using TileShape = TileShape_;
+
+    using ComputeType = Gemm::GemmType<float, layout::RowMajor>;
+    using CopyGmToUbQuant = Epilogue::Tile::CopyGm2Ub<ArchTag, Gemm::GemmType<int8_t, layout::RowMajor>>;
+    using CopyGmToUbScale = Epilogue::Tile::CopyGm2Ub<ArchTag, Gemm::GemmType<ElementScale, layout::VectorLayout>>;
+    using CopyUbToGmOut = Epilogue::Tile::CopyUb2Gm<ArchTag, Gemm::GemmType<ElementOut, layout::RowMajor>>;
+    using TileRowBroadcastAdd = Epilogue::Tile::TileRowBroadcastAdd<ArchTag, ComputeType, TileShape>;
+    using TileRowBroadcastMul = Epilogue::Tile::TileRowBroadcastMul<ArchTag, ComputeType, TileShape>;
+
+    static constexpr uint32_t QUANT_PER_BYTE = QuantElementsPerByte<ElementQuant>::VALUE;
+    static constexpr uint32_t UB_STAGES = 2;
+    static constexpr uint32_t STAGE_BYTES = TileShape::COUNT / QUANT_PER_BYTE + TileShape::COUNT * sizeof(half) +
+        TileShape::COUNT * sizeof(float) + TileShape::COUNT * sizeof(ElementOut) +
+        TileShape::COLUMN * (sizeof(ElementScale) + sizeof(float)) * 2;
+
+    static_assert(TileShape::COLUMN % (BYTE_PER_BLK * QUANT_PER_BYTE) == 0,
+        "The columns of a dequant tile must fill whole UB blocks of quantized weights");
+    static_assert(UB_STAGES * STAGE_BYTES <= ArchTag::UB_SIZE, "Excedding the UB space!");
+
+    CATLASS_DEVICE
+    WeightDequantPanel(Arch::Resource<ArchTag> &resource)
+    {
+        uint32_t ubOffset = 0;
+        for (uint32_t i = 0; i < UB_STAGES; ++i) {
+            ubQuantList[i] = resource.ubBuf.template GetBufferByByte<int8_t>(ubOffset);
+            ubOffset += TileShape::COUNT / QUANT_PER_BYTE;
+            ubHalfList[i] = resource.ubBuf.template GetBufferByByte<half>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(half);
+            ubWeightList[i] = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(float);
+            ubOutList[i] = resource.ubBuf.template GetBufferByByte<ElementOut>(ubOffset);
+            ubOffset += TileShape::COUNT * sizeof(ElementOut);
+            ubScaleList[i] = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+            ubOffset += TileShape::COLUMN * sizeof(ElementScale);
+            ubZeroList[i] = resource.ubBuf.template GetBufferByByte<ElementScale>(ubOffset);
+            ubOffset += TileShape::COLUMN * sizeof(ElementScale);
+            ubScaleFp32List[i] = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += TileShape::COLUMN * sizeof(float);
+            ubZeroFp32List[i] = resource.ubBuf.template GetBufferByByte<float>(ubOffset);
+            ubOffset += TileShape::COLUMN * sizeof(float);
+
+            eventUbMte3Mte2List[i] = eventMte3Mte2++;
+            eventUbMte2VList[i] = eventMte2V++;
+            eventUbVMte3List[i] = eventVMte3++;
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventUbMte3Mte2List[i]);
+        }
+    }
+
+    CATLASS_DEVICE
+    ~WeightDequantPanel()
+    {
+        for (uint32_t i = 0; i < UB_STAGES; ++i) {
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventUbMte3Mte2List[i]);
+        }
+    }
+
+    /// Dequantize the columns [nOffset, nOffset + actualN) of all the k rows into the k x actualN strip gmOut.
+    /// gmQuant, gmScale and gmZero address the whole matrices; gmZero is ignored for symmetric weights.
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::GlobalTensor<int8_t> const &gmQuant,
+        AscendC::GlobalTensor<ElementScale> const &gmScale,
+        AscendC::GlobalTensor<ElementScale> const &gmZero, bool hasZero,
+        AscendC::GlobalTensor<ElementOut> const &gmOut, layout::RowMajor const &layoutOut,
+        uint32_t k, uint32_t n, uint32_t groupSize, uint32_t nOffset, uint32_t actualN)
+    {
+        uint32_t subblockIdx = AscendC::GetSubBlockIdx();
+        uint32_t subblockNum = AscendC::GetSubBlockNum();
+
+        uint32_t tileLoops = CeilDiv(k, TileShape::ROW);
+        uint32_t quantRowBytes = n / QUANT_PER_BYTE;
+        uint32_t actualQuantBytes = actualN / QUANT_PER_BYTE;
+        for (uint32_t loopIdx = subblockIdx; loopIdx < tileLoops; loopIdx += subblockNum) {
+            uint32_t rowOffset = loopIdx * TileShape::ROW;
+            uint32_t actualRows = (k - rowOffset < TileShape::ROW) ? (k - rowOffset) : TileShape::ROW;
+            uint32_t groupIdx = rowOffset / groupSize;
+
+            auto &ubQuant = ubQuantList[ubListId];
+            auto &ubHalf = ubHalfList[ubListId];
+            auto &ubWeight = ubWeightList[ubListId];
+            auto &ubOut = ubOutList[ubListId];
+            auto &ubScale = ubScaleList[ubListId];
+            auto &ubZero = ubZeroList[ubListId];
+            auto &ubScaleFp32 = ubScaleFp32List[ubListId];
+            auto &ubZeroFp32 = ubZeroFp32List[ubListId];
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>(eventUbMte3Mte2List[ubListId]);
+            layout::RowMajor layoutQuantGm{actualRows, actualQuantBytes, quantRowBytes};
+            layout::RowMajor layoutQuantUb{actualRows, RoundUp<BYTE_PER_BLK>(actualQuantBytes),
+                TileShape::COLUMN / QUANT_PER_BYTE};
+            copyGmToUbQuant(ubQuant, gmQuant[static_cast<int64_t>(rowOffset) * quantRowBytes +
+                nOffset / QUANT_PER_BYTE], layoutQuantUb, layoutQuantGm);
+            int64_t gmScaleOffset = static_cast<int64_t>(groupIdx) * n + nOffset;
+            copyGmToUbScale(ubScale, gmScale[gmScaleOffset], layout::VectorLayout{actualN},
+                layout::VectorLayout{actualN});
+            if (hasZero) {
+                copyGmToUbScale(ubZero, gmZero[gmScaleOffset], layout::VectorLayout{actualN},
+                    layout::VectorLayout{actualN});
+            }
+            AscendC::SetFlag<AscendC::HardEvent::MTE2_V>(eventUbMte2VList[ubListId]);
+
+            AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>(eventUbMte2VList[ubListId]);
+            // The quantized integers and the zero points are exact in fp16 and fp32
+            if constexpr (QUANT_PER_BYTE == 2) {
+                AscendC::Cast(ubHalf, ubQuant.template ReinterpretCast<AscendC::int4b_t>(),
+                    AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+            } else {
+                AscendC::Cast(ubHalf, ubQuant, AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Cast(ubWeight, ubHalf, AscendC::RoundMode::CAST_NONE, TileShape::COUNT);
+            AscendC::Cast(ubScaleFp32, ubScale, AscendC::RoundMode::CAST_NONE, TileShape::COLUMN);
+            if (hasZero) {
+                AscendC::Cast(ubZeroFp32, ubZero, AscendC::RoundMode::CAST_NONE, TileShape::COLUMN);
+                AscendC::PipeBarrier<PIPE_V>();
+                AscendC::Muls(ubZeroFp32, ubZeroFp32, -1.0f, TileShape::COLUMN);
+                AscendC::PipeBarrier<PIPE_V>();
+                tileRowBroadcastAdd(ubWeight, ubWeight, ubZeroFp32);
+            }
+            AscendC::PipeBarrier<PIPE_V>();
+            tileRowBroadcastMul(ubWeight, ubWeight, ubScaleFp32);
+            AscendC::PipeBarrier<PIPE_V>();
+            AscendC::Cast(ubOut, ubWeight, AscendC::RoundMode::CAST_RINT, TileShape::COUNT);
+            AscendC::SetFlag<AscendC::HardEvent::V_MTE3>(eventUbVMte3List[ubListId]);
+
+            AscendC::WaitFlag<AscendC::HardEvent::V_MTE3>(eventUbVMte3List[ubListId]);
+            layout::RowMajor layoutOutUb{actualRows, RoundUp<BYTE_PER_BLK / sizeof(ElementOut)>(actualN),
+                TileShape::COLUMN};
+            auto layoutOutGm = layoutOut.GetTileLayout(MatrixCoord{actualRows, actualN});
+            copyUbToGmOut(gmOut[layoutOut.GetOffset(MatrixCoord{rowOffset, 0})], ubOut,
+                layoutOutGm, layoutOutUb);
+            AscendC::SetFlag<AscendC::HardEvent::MTE3_MTE2>(eventUbMte3Mte2List[ubListId]);
+
+            ubListId = (ubListId + 1 < UB_STAGES) ? (ubListId + 1) : 0;
+        }
+    }
+
+private:
+    AscendC::LocalTensor<int8_t> ubQuantList[UB_STAGES];
+    AscendC::LocalTensor<half> ubHalfList[UB_STAGES];
+    AscendC::LocalTensor<float> ubWeightList[UB_STAGES];
+    AscendC::LocalTensor<ElementOut> ubOutList[UB_STAGES];
+    AscendC::LocalTensor<ElementScale> ubScaleList[UB_STAGES];
+    AscendC::LocalTensor<ElementScale> ubZeroList[UB_STAGES];
+    AscendC::LocalTensor<float> ubScaleFp32List[UB_STAGES];
+    AscendC::LocalTensor<float> ubZeroFp32List[UB_STAGES];
+
+    int32_t eventUbMte3Mte2List[UB_STAGES];
+    int32_t eventUbMte2VList[UB_STAGES];
+    int32_t eventUbVMte3List[UB_STAGES];
+    int32_t eventMte3Mte2{0};
+    int32_t eventMte2V{0};
+    int32_t eventVMte3{0};
+
+    uint32_t ubListId{0};
+
+    CopyGmToUbQuant copyGmToUbQuant;
+    CopyGmToUbScale copyGmToUbScale;
+    CopyUbToGmOut copyUbToGmOut;
+    TileRowBroadcastAdd tileRowBroadcastAdd;
+    TileRowBroadcastMul tileRowBroadcastMul;
+};
+
+// Template for weight-only quantized matmul kernel. Compute C = A * dequant(B), B being an int8 or packed int4
+// (ElementQuant) row major k x n weight with per-group scales and optional zero points of ElementScale, one row of n
+// per group of groupSize rows along k. The AIV cores dequantize B panel by panel, L1TileShape::N columns at a time,
+// into a ring of WORKSPACE_STAGES k x L1TileShape::N strips of ElementB owned by the AIC core of the same group; the
+// AIC consumes every strip as soon as its AIVs flag it and hands it back once all its m tiles are loaded, so the
+// dequantization of the next panels overlaps the matmul of the current one. Panels are distributed over the cores in
+// turn and each panel is dequantized exactly once.
+// A dequantized panel is written to its strip once and read back by the AIC once per m tile. The workspace only
+// holds the strips in flight, whatever n is, and CanImplement rejects the problems whose ring exceeds
+// L2_WORKSPACE_BUDGET, so that this staging traffic stays in L2.
+template <
+    class BlockMmad_,
+    class ElementQuant_,
+    class ElementScale_,
+    uint32_t DEQUANT_TILE_ROWS_ = 32,
+    uint32_t WORKSPACE_STAGES_ = 2
+>
+class WeightOnlyQuantMatmul {
+public:
+    using BlockMmad = BlockMmad_;
+    using ArchTag = typename BlockMmad::ArchTag;
+    using L1TileShape = typename BlockMmad::L1TileShape;
+    using ElementA = typename BlockMmad::ElementA;
+    using LayoutA = typename BlockMmad::LayoutA;
+    using ElementB = typename BlockMmad::ElementB;
+    using LayoutB = typename BlockMmad::LayoutB;
+    using ElementC = typename BlockMmad::ElementC;
+    using LayoutC = typename BlockMmad::LayoutC;
+
+    using ElementQuant = ElementQuant_;
+    using ElementScale = ElementScale_;
+    static constexpr uint32_t DEQUANT_TILE_ROWS = DEQUANT_TILE_ROWS_;
+    using DequantTileShape = MatrixShape<DEQUANT_TILE_ROWS, L1TileShape::N>;
+    using WeightDequant = WeightDequantPanel<ArchTag, ElementQuant, ElementScale, ElementB, DequantTileShape>;
+    static constexpr uint32_t QUANT_PER_BYTE = WeightDequant::QUANT_PER_BYTE;
+    static constexpr uint32_t WORKSPACE_STAGES = WORKSPACE_STAGES_;
+
+    static_assert(std::is_same_v<LayoutB, layout::RowMajor>, "The dequantized weight is row major");
+    static_assert(WORKSPACE_STAGES > 0, "The ring of dequantized strips must have a stage");
+    static_assert(2 * WORKSPACE_STAGES <= Arch::FFTS_MAX_FLAG + 1, "Excedding the cross core flags!");
+
+    /// Upper bound of the ring of dequantized strips of all the cores, a conservative share of the L2 of AtlasA2
+    /// that leaves room for A, C and the quantized weight.
+    static constexpr size_t L2_WORKSPACE_BUDGET = 64 * 1024 * 1024;
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        GM_ADDR ptrScale;
+        GM_ADDR ptrZero;
+        uint32_t groupSize;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        GM_ADDR ptrWorkspace;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(GemmCoord const &problemShape_, GM_ADDR ptrA_, LayoutA layoutA_,
+               GM_ADDR ptrB_, GM_ADDR ptrScale_, GM_ADDR ptrZero_, uint32_t groupSize_,
+               GM_ADDR ptrC_, LayoutC layoutC_, GM_ADDR ptrWorkspace_)
+            : problemShape(problemShape_), ptrA(ptrA_), layoutA(layoutA_),
+              ptrB(ptrB_), ptrScale(ptrScale_), ptrZero(ptrZero_), groupSize(groupSize_),
+              ptrC(ptrC_), layoutC(layoutC_), ptrWorkspace(ptrWorkspace_) {}
+    };
+
+    struct Arguments {
+        GemmCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrB;
+        GM_ADDR ptrScale;
+        GM_ADDR ptrZero;
+        uint32_t groupSize;
+        GM_ADDR ptrC;
+        LayoutC layoutC;
+        // Number of cube cores of the launch, each one owns WORKSPACE_STAGES strips of the workspace.
+        uint32_t aicCoreNum;
+    };
+
+    /// Layout of a dequantized k x L1TileShape::N strip in the workspace.
+    CATLASS_HOST_DEVICE
+    static layout::RowMajor GetWorkspaceLayout(GemmCoord const &problemShape)
+    {
+        return layout::RowMajor(problemShape.k(), L1TileShape::N);
+    }
+
+    /// Offset of the strip stageId of the AIC core coreIdx in the workspace.
+    CATLASS_HOST_DEVICE
+    static int64_t GetStripOffset(GemmCoord const &problemShape, uint32_t coreIdx, uint32_t stageId)
+    {
+        return (static_cast<int64_t>(coreIdx) * WORKSPACE_STAGES + stageId) * problemShape.k() * L1TileShape::N;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return static_cast<size_t>(args.aicCoreNum) * WORKSPACE_STAGES * args.problemShape.k() * L1TileShape::N *
+            sizeof(ElementB);
+    }
+
+    static bool CanImplement(const Arguments &args)
+    {
+        // A dequant tile must not cross a group, int4 rows must be whole bytes, and the ring must fit in L2.
+        return (args.aicCoreNum > 0) && (args.groupSize > 0) && (args.groupSize % DEQUANT_TILE_ROWS == 0) &&
+            (args.problemShape.n() % QUANT_PER_BYTE == 0) && (GetWorkspaceSize(args) <= L2_WORKSPACE_BUDGET);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA,
+            args.ptrB, args.ptrScale, args.ptrZero, args.groupSize,
+            args.ptrC, args.layoutC, workspace};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    WeightOnlyQuantMatmul()
+    {
+        Arch::FlagID flagId = 0;
+        for (uint32_t stageId = 0; stageId < WORKSPACE_STAGES; ++stageId) {
+            flagAivFinishDequantList[stageId] = Arch::CrossCoreFlag(flagId++);
+            flagAicFinishLoadList[stageId] = Arch::CrossCoreFlag(flagId++);
+        }
+    }
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    /// Dequantize the panels consumed by the AIC core of this group
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params)
+    {
+        uint32_t coreIdx = AscendC::GetBlockIdx() / AscendC::GetSubBlockNum();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t n = params.problemShape.n();
+        uint32_t panelNum = CeilDiv(n, L1TileShape::N);
+
+        AscendC::GlobalTensor<int8_t> gmB;
+        gmB.SetGlobalBuffer(reinterpret_cast<__gm__ int8_t *>(params.ptrB));
+        AscendC::GlobalTensor<ElementScale> gmScale;
+        gmScale.SetGlobalBuffer(reinterpret_cast<__gm__ ElementScale *>(params.ptrScale));
+        AscendC::GlobalTensor<ElementScale> gmZero;
+        gmZero.SetGlobalBuffer(reinterpret_cast<__gm__ ElementScale *>(params.ptrZero));
+        AscendC::GlobalTensor<ElementB> gmWB;
+        gmWB.SetGlobalBuffer(reinterpret_cast<__gm__ ElementB *>(params.ptrWorkspace));
+        auto layoutWB = GetWorkspaceLayout(params.problemShape);
+        bool hasZero = (params.ptrZero != nullptr);
+
+        uint32_t stageId = 0;
+        uint32_t stageUsed = 0;
+
+        WeightDequant weightDequant(resource);
+        for (uint32_t panelIdx = coreIdx; panelIdx < panelNum; panelIdx += coreNum) {
+            uint32_t nOffset = panelIdx * L1TileShape::N;
+            uint32_t actualN = (n - nOffset < L1TileShape::N) ? (n - nOffset) : L1TileShape::N;
+            // Reuse a strip once the AIC has loaded all of it
+            if (stageUsed == WORKSPACE_STAGES) {
+                Arch::CrossCoreWaitFlag(flagAicFinishLoadList[stageId]);
+            } else {
+                ++stageUsed;
+            }
+            int64_t gmOffsetWB = GetStripOffset(params.problemShape, coreIdx, stageId);
+            weightDequant(gmB, gmScale, gmZero, hasZero, gmWB[gmOffsetWB], layoutWB,
+                params.problemShape.k(), n, params.groupSize, nOffset, actualN);
+            Arch::CrossCoreSetFlag<0x2, PIPE_MTE3>(flagAivFinishDequantList[stageId]);
+
+            stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+        }
+
+        while (stageUsed > 0) {
+            uint32_t aicLoadStageId = (stageId >= stageUsed) ?
+                (stageId - stageUsed) : (stageId + WORKSPACE_STAGES - stageUsed);
+            Arch::CrossCoreWaitFlag(flagAicFinishLoadList[aicLoadStageId]);
+            --stageUsed;
+        }
+    }
+
+    /// Executes matmul over the dequantized panels
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params)
+    {
+        uint32_t coreIdx = AscendC::GetBlockIdx();
+        uint32_t coreNum = AscendC::GetBlockNum();
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t k = params.problemShape.k();
+        uint32_t panelNum = CeilDiv(n, L1TileShape::N);
+        uint32_t mLoops = CeilDiv(m, L1TileShape::M);
+
+        BlockMmad blockMmad(resource);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer(reinterpret_cast<__gm__ ElementA *>(params.ptrA));
+        AscendC::GlobalTensor<ElementB> gmWB;
+        gmWB.SetGlobalBuffer(reinterpret_cast<__gm__ ElementB *>(params.ptrWorkspace));
+        AscendC::GlobalTensor<ElementC> gmC;
+        gmC.SetGlobalBuffer(reinterpret_cast<__gm__ ElementC *>(params.ptrC));
+        auto layoutWB = GetWorkspaceLayout(params.problemShape);
+
+        uint32_t stageId = 0;
+        for (uint32_t panelIdx = coreIdx; panelIdx < panelNum; panelIdx += coreNum) {
+            uint32_t nOffset = panelIdx * L1TileShape::N;
+            uint32_t actualN = (n - nOffset < L1TileShape::N) ? (n - nOffset) : L1TileShape::N;
+            int64_t gmOffsetWB = GetStripOffset(params.problemShape, coreIdx, stageId);
+            Arch::CrossCoreWaitFlag(flagAivFinishDequantList[stageId]);
+
+            for (uint32_t mIdx = 0; mIdx < mLoops; ++mIdx) {
+                uint32_t mOffset = mIdx * L1TileShape::M;
+                uint32_t actualM = (m - mOffset < L1TileShape::M) ? (m - mOffset) : L1TileShape::M;
+                GemmCoord actualBlockShape{actualM, actualN, k};
+
+                int64_t gmOffsetA = params.layoutA.GetOffset(MatrixCoord{mOffset, 0});
+                int64_t gmOffsetC = params.layoutC.GetOffset(MatrixCoord{mOffset, nOffset});
+
+                // Compute block-scoped matrix multiply-add
+                blockMmad(gmA[gmOffsetA], params.layoutA,
+                          gmWB[gmOffsetWB], layoutWB,
+                          gmC[gmOffsetC], params.layoutC,
+                          actualBlockShape);
+            }
+            // The strip is free once its last loads are done
+            Arch::CrossCoreSetFlag<0x2, PIPE_MTE2>(flagAicFinishLoadList[stageId]);
+
+            stageId = (stageId + 1 < WORKSPACE_STAGES) ? (stageId + 1) : 0;
+        }
+    }
+
+private:
+    Arch::CrossCoreFlag flagAivFinishDequantList[WORKSPACE_STAGES];
+    Arch::CrossCoreFlag flagAicFinishLoadList[WORKSPACE_STAGES];
+    Arch::Resource<ArchTag> resource;
+};
+
+} // namespace Catlass::Gemm::Kernel
+
+#endif // CATLASS_GEMM_KERNEL_WEIGHT_ONLY_QUANT_MATMUL_HPP
@@ -15,6 +15,7 @@
 #include "catlass/arch/arch.hpp"
 #include "catlass/layout/layout.hpp"
 #include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/tile/copy_gm_to_l1_strategy.hpp"
 #include "catlass/gemm/tile/tile_copy_tla.hpp"
 #include "tla/tensor.hpp"
 
@@ -43,12 +44,11 @@ struct CopyGmToL1IntervalDataCopy {
 ////////////////////////////////////////
 /// Using the standard strided DataCopy interface to implement nd2nz
 /// transfer may achieve higher data transfer efficiency when the data block shape is short and wide
-/// Partial specialization for AtlasA2, half, RowMajor in and zN out.
-template<>
-struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::RowMajor>> {
+/// Partial specialization for AtlasA2, RowMajor in and zN out.
+template <class Element>
+struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<Element, layout::RowMajor>> {
     using LayoutDst = layout::zN;
     using LayoutSrc = layout::RowMajor;
-    using Element = half;
 
     static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
 
@@ -75,14 +75,13 @@ struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::Ro
     }
 };
 
-/// Partial specialization for AtlasA2, half, PaddingRowMajor in and zN out.
+/// Partial specialization for AtlasA2, PaddingRowMajor in and zN out.
 /// Using the standard strided DataCopy interface to implement nd2nz
 /// transfer may achieve higher data transfer efficiency when the data block shape is short and wide
-template<>
-struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::PaddingRowMajor>> {
+template <class Element>
+struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<Element, layout::PaddingRowMajor>> {
     using LayoutDst = layout::zN;
     using LayoutSrc = layout::PaddingRowMajor;
-    using Element = half;
 
     static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
 
@@ -109,14 +108,13 @@ struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::Pa
     }
 };
 
-/// Partial specialization for AtlasA2, half, ColumnMajor in and zN out.
+/// Partial specialization for AtlasA2, ColumnMajor in and nZ out.
 /// Using the standard strided DataCopy interface to implement nd2nz
 /// transfer may achieve higher data transfer efficiency when the data block shape is tall and narrow
-template<>
-struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::ColumnMajor>> {
+template <class Element>
+struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<Element, layout::ColumnMajor>> {
     using LayoutDst = layout::nZ;
     using LayoutSrc = layout::ColumnMajor;
-    using Element = half;
 
     static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
 
@@ -143,14 +141,13 @@ struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::Co
     }
 };
 
-/// Partial specialization for AtlasA2, half, PaddingColumnMajor in and zN out.
+/// Partial specialization for AtlasA2, PaddingColumnMajor in and nZ out.
 /// Using the standard strided DataCopy interface to implement nd2nz
 /// transfer may achieve higher data transfer efficiency when the data block shape is tall and narrow
-template<>
-struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<half, layout::PaddingColumnMajor>> {
+template <class Element>
+struct CopyGmToL1IntervalDataCopy<Arch::AtlasA2, Gemm::GemmType<Element, layout::PaddingColumnMajor>> {
     using LayoutDst = layout::nZ;
     using LayoutSrc = layout::PaddingColumnMajor;
-    using Element = half;
 
     static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
 
@@ -821,6 +818,110 @@ struct CopyGmToL1<Arch::AtlasA2, Gemm::GemmType<Element, layout::ColumnMajor>> {
     }
 };
 
+/// Partial specialization for AtlasA2, int4b_t, RowMajor in and zN out.
+/// Rows are packed two elements per byte along k, the even element in the low nibble. nd2nz moves bytes, so the
+/// tile is copied through an int8_t view with half as many columns: an int4b_t fractal of 16 x 64 holds the same
+/// bytes as an int8_t fractal of 16 x 32. Column counts and offsets along k must be even.
+template <>
+struct CopyGmToL1<Arch::AtlasA2, Gemm::GemmType<AscendC::int4b_t, layout::RowMajor>> {
+    using Element = AscendC::int4b_t;
+    using LayoutDst = layout::zN;
+    using LayoutSrc = layout::RowMajor;
+
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
+    static constexpr uint32_t ELE_NUM_PER_BYTE = 8 / SizeOfBits<Element>::VALUE;
+
+    // Mehtods
+
+    CATLASS_DEVICE
+    CopyGmToL1() {};
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<Element> const &dstTensor,
+        AscendC::GlobalTensor<Element> const &srcTensor,
+        LayoutDst const &layoutDst, LayoutSrc const &layoutSrc)
+    {
+        AscendC::LocalTensor<int8_t> dstBytes = dstTensor.template ReinterpretCast<int8_t>();
+        AscendC::GlobalTensor<int8_t> srcBytes;
+        srcBytes.SetGlobalBuffer(reinterpret_cast<__gm__ int8_t *>(srcTensor.GetPhyAddr()));
+        uint32_t srcByteStride = layoutSrc.stride(0) / ELE_NUM_PER_BYTE;
+
+        AscendC::Nd2NzParams intriParams;
+
+        intriParams.ndNum = 1;
+        intriParams.dValue = layoutSrc.shape(1) / ELE_NUM_PER_BYTE;
+        intriParams.srcNdMatrixStride = 0;
+        intriParams.dstNzC0Stride = layoutDst.stride(3) / ELE_NUM_PER_C0;
+        intriParams.dstNzMatrixStride = 0;
+
+        if (srcByteStride < STRIDE_LIMIT) {
+            intriParams.nValue = layoutSrc.shape(0);
+            intriParams.srcDValue = srcByteStride;
+            intriParams.dstNzNStride = layoutDst.stride(0) / ELE_NUM_PER_C0;
+            AscendC::DataCopy(dstBytes, srcBytes, intriParams);
+        } else {
+            intriParams.nValue = 1;
+            intriParams.srcDValue = 0;
+            intriParams.dstNzNStride = 0;
+            for (uint32_t i = 0; i < layoutSrc.shape(0); i++) {
+                AscendC::DataCopy(dstBytes[i * BYTE_PER_C0], srcBytes[i * srcByteStride], intriParams);
+            }
+        }
+    }
+};
+
+/// Partial specialization for AtlasA2, int4b_t, ColumnMajor in and nZ out.
+/// Columns are packed two elements per byte along k and copied through an int8_t view like the RowMajor case.
+template <>
+struct CopyGmToL1<Arch::AtlasA2, Gemm::GemmType<AscendC::int4b_t, layout::ColumnMajor>> {
+    using Element = AscendC::int4b_t;
+    using LayoutDst = layout::nZ;
+    using LayoutSrc = layout::ColumnMajor;
+
+    static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
+    static constexpr uint32_t ELE_NUM_PER_BYTE = 8 / SizeOfBits<Element>::VALUE;
+
+    // Mehtods
+
+    CATLASS_DEVICE
+    CopyGmToL1() {};
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<Element> const &dstTensor,
+        AscendC::GlobalTensor<Element> const &srcTensor,
+        LayoutDst const &layoutDst, LayoutSrc const &layoutSrc)
+    {
+        AscendC::LocalTensor<int8_t> dstBytes = dstTensor.template ReinterpretCast<int8_t>();
+        AscendC::GlobalTensor<int8_t> srcBytes;
+        srcBytes.SetGlobalBuffer(reinterpret_cast<__gm__ int8_t *>(srcTensor.GetPhyAddr()));
+        uint32_t srcByteStride = layoutSrc.stride(1) / ELE_NUM_PER_BYTE;
+
+        AscendC::Nd2NzParams intriParams;
+
+        intriParams.ndNum = 1;
+        intriParams.dValue = layoutSrc.shape(0) / ELE_NUM_PER_BYTE;
+        intriParams.srcNdMatrixStride = 0;
+        intriParams.dstNzC0Stride = layoutDst.stride(1) / ELE_NUM_PER_C0;
+        intriParams.dstNzMatrixStride = 0;
+
+        if (srcByteStride < STRIDE_LIMIT) {
+            intriParams.nValue = layoutSrc.shape(1);
+            intriParams.srcDValue = srcByteStride;
+            intriParams.dstNzNStride = layoutDst.stride(2) / ELE_NUM_PER_C0;
+            AscendC::DataCopy(dstBytes, srcBytes, intriParams);
+        } else {
+            intriParams.nValue = 1;
+            intriParams.srcDValue = 0;
+            intriParams.dstNzNStride = 0;
+            for (uint32_t i = 0; i < layoutSrc.shape(1); i++) {
+                AscendC::DataCopy(dstBytes[i * BYTE_PER_C0], srcBytes[i * srcByteStride], intriParams);
+            }
+        }
+    }
+};
+
 /// Partial specialization for zN in and zN out.
 template <
     class ArchTag,
@@ -1307,6 +1408,87 @@ struct CopyGmToL1<ArchTag, Gemm::GemmType<Element, layout::VectorLayout, AscendC
     }
 };
 
+/// Chooses per tile between nd2nz and the interval DataCopy, using CopyGmToL1CostModel on the actual tile shape.
+/// Tiles with few lines (e.g. row major A with a small M tail) take the interval copy, the others nd2nz.
+/// Tiles with a stride of STRIDE_LIMIT or more take the interval copy as well, one DataCopy per line instead of
+/// one nd2nz per line, so such operands can be read in place without the padding prologue.
+/// The interval copy moves whole 32B blocks, so it is only taken when the line length is block aligned.
+template <
+    class ArchTag,
+    /// GemmType for matrix operand
+    class GmType
+>
+struct CopyGmToL1Adaptive {
+    using Element = typename GmType::Element;
+    using CopyNd2Nz = CopyGmToL1<ArchTag, GmType>;
+    using CopyInterval = CopyGmToL1IntervalDataCopy<ArchTag, GmType>;
+    using LayoutDst = typename CopyNd2Nz::LayoutDst;
+    using LayoutSrc = typename CopyNd2Nz::LayoutSrc;
+
+    static constexpr bool IS_ROW_MAJOR = std::is_same_v<LayoutSrc, layout::RowMajor> ||
+        std::is_same_v<LayoutSrc, layout::PaddingRowMajor>;
+    static constexpr bool IS_PADDING = std::is_same_v<LayoutSrc, layout::PaddingRowMajor> ||
+        std::is_same_v<LayoutSrc, layout::PaddingColumnMajor>;
+
+    // Mehtods
+
+    CATLASS_DEVICE
+    CopyGmToL1Adaptive() {};
+
+    CATLASS_DEVICE
+    void operator()(
+        AscendC::LocalTensor<Element> const &dstTensor,
+        AscendC::GlobalTensor<Element> const &srcTensor,
+        LayoutDst const &layoutDst, LayoutSrc const &layoutSrc)
+    {
+        uint32_t rows;
+        uint32_t cols;
+        if constexpr (IS_PADDING) {
+            rows = layoutSrc.orgShape(0);
+            cols = layoutSrc.orgShape(1);
+        } else {
+            rows = layoutSrc.shape(0);
+            cols = layoutSrc.shape(1);
+        }
+        // A line is a row of a row major tile and a column of a column major one.
+        uint32_t lineCount = IS_ROW_MAJOR ? rows : cols;
+        uint32_t lineLen = IS_ROW_MAJOR ? cols : rows;
+        // Padded layouts are tile blocked, their strides never reach the limit.
+        bool largeStride = false;
+        if constexpr (!IS_PADDING) {
+            largeStride = (IS_ROW_MAJOR ? layoutSrc.stride(0) : layoutSrc.stride(1)) >= STRIDE_LIMIT;
+        }
+        if (CopyGmToL1CostModel::SelectIntervalCopy(lineCount, lineLen * sizeof(Element), largeStride)) {
+            copyInterval(dstTensor, srcTensor, layoutDst, layoutSrc);
+        } else {
+            copyNd2Nz(dstTensor, srcTensor, layoutDst, layoutSrc);
+        }
+    }
+
+private:
+    CopyNd2Nz copyNd2Nz;
+    CopyInterval copyInterval;
+};
+
+/// GM to L1 copy used by TileCopyAdaptive: the adaptive copy wherever an interval copy exists,
+/// the plain CopyGmToL1 otherwise.
+template <
+    class ArchTag,
+    /// GemmType for matrix operand
+    class GmType
+>
+struct CopyGmToL1Selector {
+    using Element = typename GmType::Element;
+    // int4b_t operands only have the nd2nz copy through an int8_t view.
+    static constexpr bool HAS_INTERVAL_COPY = std::is_same_v<ArchTag, Arch::AtlasA2> &&
+        !std::is_same_v<Element, AscendC::int4b_t> &&
+        (std::is_same_v<GmType, Gemm::GemmType<Element, layout::RowMajor>> ||
+         std::is_same_v<GmType, Gemm::GemmType<Element, layout::PaddingRowMajor>> ||
+         std::is_same_v<GmType, Gemm::GemmType<Element, layout::ColumnMajor>> ||
+         std::is_same_v<GmType, Gemm::GemmType<Element, layout::PaddingColumnMajor>>);
+    using CopyGmToL1 = std::conditional_t<HAS_INTERVAL_COPY,
+        CopyGmToL1Adaptive<ArchTag, GmType>, Gemm::Tile::CopyGmToL1<ArchTag, GmType>>;
+};
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////
 
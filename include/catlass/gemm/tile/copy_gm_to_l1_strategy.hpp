@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_COPY_GM_TO_L1_STRATEGY_HPP
+#define CATLASS_GEMM_TILE_COPY_GM_TO_L1_STRATEGY_HPP
+
+#include "catlass/detail/alignment.hpp"
+#include "catlass/detail/constants.hpp"
+#include "catlass/detail/macros.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// Estimated MTE2 cost of moving a tile of `lineCount` contiguous GM lines, each `lineBlocks` 32B blocks long,
+/// into a fractal L1 layout (zN for row major, nZ for column major).
+/// - nd2nz is a single instruction that fills every fractal column from 16 lines in parallel. With fewer lines
+///   (e.g. decode M < 16) the remaining lanes idle, so a partial fractal costs as much as a full one.
+/// - The interval copy issues one strided DataCopy per line. Every line is a contiguous burst at full rate,
+///   but each instruction pays its issue cost.
+/// - nd2nz takes the line stride in a 16 bit field. A tile with a larger stride is copied one line per nd2nz,
+///   each paying for a full fractal column, so the interval copy always wins there.
+/// The cycle counts are relative estimates, only their ratio decides the strategy.
+struct CopyGmToL1CostModel {
+    static constexpr uint32_t DATA_COPY_ISSUE_CYCLES = 12;
+    static constexpr uint32_t ND2NZ_ISSUE_CYCLES = 24;
+    static constexpr uint32_t ND2NZ_PARALLEL_LINES = 16;
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t IntervalCycles(uint32_t lineCount, uint32_t lineBlocks)
+    {
+        return lineCount * (DATA_COPY_ISSUE_CYCLES + lineBlocks);
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t Nd2NzCycles(uint32_t lineCount, uint32_t lineBlocks)
+    {
+        return ND2NZ_ISSUE_CYCLES + CeilDiv(lineCount, ND2NZ_PARALLEL_LINES) * ND2NZ_PARALLEL_LINES * lineBlocks;
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t Nd2NzCycles(uint32_t lineCount, uint32_t lineBlocks, bool largeStride)
+    {
+        return largeStride ? lineCount * Nd2NzCycles(1, lineBlocks) : Nd2NzCycles(lineCount, lineBlocks);
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr bool UseIntervalCopy(uint32_t lineCount, uint32_t lineBlocks, bool largeStride = false)
+    {
+        return IntervalCycles(lineCount, lineBlocks) < Nd2NzCycles(lineCount, lineBlocks, largeStride);
+    }
+
+    /// The choice of CopyGmToL1Adaptive for a tile whose lines are lineBytes long. The interval copy moves whole
+    /// 32B blocks, so lines that are not block aligned always take nd2nz.
+    CATLASS_HOST_DEVICE
+    static constexpr bool SelectIntervalCopy(uint32_t lineCount, uint32_t lineBytes, bool largeStride)
+    {
+        return (lineBytes % BYTE_PER_BLK == 0) && UseIntervalCopy(lineCount, lineBytes / BYTE_PER_BLK, largeStride);
+    }
+};
+
+/// Host side choice of the padding prologue of OptimizedMatmul for one operand. The prologue (PaddingMatrixBlockND)
+/// reads the operand once and writes it as L1 tiles, after which every tile load is an aligned nd2nz. Without it
+/// every load reads the original layout through CopyGmToL1Adaptive:
+/// - a line starting off a 512B boundary touches one more GM segment, charged as UNALIGNED_LINE_CYCLES per line;
+/// - a stride of STRIDE_LIMIT or more takes the interval copy when lines are 32B aligned, and one nd2nz
+///   per line otherwise.
+/// The prologue pays off once a tile is loaded often enough (reuseCount, e.g. the number of N tiles for A) for
+/// the per load penalty to exceed the extra read and write of the prologue.
+/// lineCount and lineLen describe one L1 tile: rows and row length (elements) of a row major operand,
+/// columns and column length of a column major one. stride is the leading stride of the operand in elements.
+struct OperandPaddingCostModel {
+    static constexpr uint32_t BYTE_PER_BLOCK = 32;
+    static constexpr uint32_t GM_SEGMENT_BYTES = 512;
+    static constexpr uint32_t UNALIGNED_LINE_CYCLES = GM_SEGMENT_BYTES / BYTE_PER_BLOCK;
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t UnalignedCycles(uint32_t lineCount, uint32_t stride, uint32_t elementBytes)
+    {
+        return (static_cast<uint64_t>(stride) * elementBytes % GM_SEGMENT_BYTES == 0) ?
+            0 : lineCount * UNALIGNED_LINE_CYCLES;
+    }
+
+    /// One tile load straight from the original layout, with the copy CopyGmToL1Adaptive picks for it.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t DirectTileCycles(uint32_t lineCount, uint32_t lineLen, uint32_t stride,
+        uint32_t elementBytes)
+    {
+        uint32_t lineBytes = lineLen * elementBytes;
+        uint32_t lineBlocks = CeilDiv(lineBytes, BYTE_PER_BLOCK);
+        bool largeStride = stride >= STRIDE_LIMIT;
+        uint32_t copyCycles = CopyGmToL1CostModel::SelectIntervalCopy(lineCount, lineBytes, largeStride) ?
+            CopyGmToL1CostModel::IntervalCycles(lineCount, lineBlocks) :
+            CopyGmToL1CostModel::Nd2NzCycles(lineCount, lineBlocks, largeStride);
+        return copyCycles + UnalignedCycles(lineCount, stride, elementBytes);
+    }
+
+    /// One tile load from the padded workspace, whose tiles are contiguous and aligned.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t PaddedTileCycles(uint32_t lineCount, uint32_t lineLen, uint32_t elementBytes)
+    {
+        return CopyGmToL1CostModel::Nd2NzCycles(lineCount, CeilDiv(lineLen * elementBytes, BYTE_PER_BLOCK));
+    }
+
+    /// Share of the prologue for one tile: reading it from the original layout and writing it back aligned.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t PaddingPassCycles(uint32_t lineCount, uint32_t lineLen, uint32_t stride,
+        uint32_t elementBytes)
+    {
+        return 2 * lineCount * CeilDiv(lineLen * elementBytes, BYTE_PER_BLOCK) +
+            UnalignedCycles(lineCount, stride, elementBytes);
+    }
+
+    CATLASS_HOST_DEVICE
+    static constexpr bool NeedPadding(uint32_t lineCount, uint32_t lineLen, uint32_t stride, uint32_t elementBytes,
+        uint32_t reuseCount)
+    {
+        uint64_t directCycles = static_cast<uint64_t>(reuseCount) *
+            DirectTileCycles(lineCount, lineLen, stride, elementBytes);
+        uint64_t paddedCycles = PaddingPassCycles(lineCount, lineLen, stride, elementBytes) +
+            static_cast<uint64_t>(reuseCount) * PaddedTileCycles(lineCount, lineLen, elementBytes);
+        return paddedCycles < directCycles;
+    }
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_COPY_GM_TO_L1_STRATEGY_HPP
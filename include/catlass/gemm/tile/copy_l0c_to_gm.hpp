@@ -14,6 +14,7 @@
 #include "catlass/catlass.hpp"
 #include "catlass/arch/arch.hpp"
 #include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemm/tile/fixpipe_quant_param.hpp"
 #include "tla/tensor.hpp"
 
 namespace Catlass::Gemm::Tile {
@@ -95,6 +96,80 @@ struct CopyL0CToGmQuantMode<
     static constexpr auto VALUE = QuantMode_t::VDEQF16;
 };
 
+// CopyL0CToGm quantize fp32 to int8_t
+template <>
+struct CopyL0CToGmQuantMode<
+    Catlass::Arch::AtlasA2,
+    float, int8_t,
+    ScaleGranularity::PER_TENSOR
+> {
+    static constexpr auto VALUE = QuantMode_t::QF322B8_PRE;
+};
+
+template <>
+struct CopyL0CToGmQuantMode<
+    Catlass::Arch::AtlasA2,
+    float, int8_t,
+    ScaleGranularity::PER_CHANNEL
+> {
+    static constexpr auto VALUE = QuantMode_t::VQF322B8_PRE;
+};
+
+// CopyL0CToGm requantize int32_t to int8_t, the quant parameters are encoded by FixpipeRequantParam
+template <>
+struct CopyL0CToGmQuantMode<
+    Catlass::Arch::AtlasA2,
+    int32_t, int8_t,
+    ScaleGranularity::PER_TENSOR
+> {
+    static constexpr auto VALUE = QuantMode_t::REQ8;
+};
+
+template <>
+struct CopyL0CToGmQuantMode<
+    Catlass::Arch::AtlasA2,
+    int32_t, int8_t,
+    ScaleGranularity::PER_CHANNEL
+> {
+    static constexpr auto VALUE = QuantMode_t::VREQ8;
+};
+
+// Diagnostics of the combinations the fixpipe does not support
+template <class ElementDst, ScaleGranularity DEQUANT_GRANULARITY>
+struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, half, ElementDst, DEQUANT_GRANULARITY> {
+    static_assert(DEPENDENT_FALSE<ElementDst>,
+        "L0C holds float or int32_t accumulators only, there is no half accumulation. Accumulate in float and "
+        "write half with the F322F16 cast.");
+};
+
+template <class ElementDst, ScaleGranularity DEQUANT_GRANULARITY>
+struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, bfloat16_t, ElementDst, DEQUANT_GRANULARITY> {
+    static_assert(DEPENDENT_FALSE<ElementDst>,
+        "L0C holds float or int32_t accumulators only, there is no bfloat16_t accumulation. Accumulate in float "
+        "and write bfloat16_t with the F322BF16 cast.");
+};
+
+template <ScaleGranularity DEQUANT_GRANULARITY>
+struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, int32_t, half, DEQUANT_GRANULARITY> {
+    static_assert(DEPENDENT_FALSE<std::integral_constant<ScaleGranularity, DEQUANT_GRANULARITY>>,
+        "int32_t accumulators are written as half with a dequant scale only, use ScaleGranularity::PER_TENSOR "
+        "or ScaleGranularity::PER_CHANNEL.");
+};
+
+template <ScaleGranularity DEQUANT_GRANULARITY>
+struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, int32_t, int8_t, DEQUANT_GRANULARITY> {
+    static_assert(DEPENDENT_FALSE<std::integral_constant<ScaleGranularity, DEQUANT_GRANULARITY>>,
+        "int32_t accumulators are written as int8_t with a requant parameter only, use ScaleGranularity::PER_TENSOR "
+        "or ScaleGranularity::PER_CHANNEL and encode it with FixpipeRequantParam.");
+};
+
+template <ScaleGranularity DEQUANT_GRANULARITY>
+struct CopyL0CToGmQuantMode<Catlass::Arch::AtlasA2, int32_t, bfloat16_t, DEQUANT_GRANULARITY> {
+    static_assert(DEPENDENT_FALSE<std::integral_constant<ScaleGranularity, DEQUANT_GRANULARITY>>,
+        "The fixpipe has no int32_t to bfloat16_t dequant. Write int32_t and dequantize on AIV, e.g. with "
+        "Epilogue::EpilogueAtlasA2PerTokenDequant.");
+};
+
 template <
     class ArchTag,
     class ElementAccumulator,
@@ -190,6 +265,98 @@ struct CopyL0CToGm<Catlass::Arch::AtlasA2,
     }
 };
 
+/// Quantizing copy with one quant parameter for the whole tensor, passed as FixpipeParamsV220::deqScalar.
+/// For REQ8 the parameter is encoded by FixpipeRequantParam, for DEQF16 and QF322B8_PRE it is the fp32 scale bits.
+template <
+    class ElementAccumulator_,
+    class ElementDst_,
+    bool ReluEnable_
+>
+struct CopyL0CToGm<Catlass::Arch::AtlasA2,
+                   ElementAccumulator_,
+                   Gemm::GemmType<ElementDst_, layout::RowMajor>,
+                   ScaleGranularity::PER_TENSOR,
+                   ReluEnable_>
+{
+    using ArchTag = Catlass::Arch::AtlasA2;
+    using ElementDst = ElementDst_;
+    using ElementSrc = ElementAccumulator_;
+    using LayoutSrc = Catlass::layout::zN;
+    using LayoutDst = Catlass::layout::RowMajor;
+    static constexpr auto DEQUANT_GRANULARITY = ScaleGranularity::PER_TENSOR;
+    static constexpr auto quantPre = CopyL0CToGmQuantMode<ArchTag, ElementSrc, ElementDst,
+        ScaleGranularity::PER_TENSOR>::VALUE;
+    static constexpr auto reluEn = ReluEnable_;
+
+    CATLASS_DEVICE
+    void operator()(AscendC::GlobalTensor<ElementDst> const &dst, AscendC::LocalTensor<ElementSrc> const &src,
+        uint64_t quantScalar, LayoutDst const &dstLayout, LayoutSrc const &srcLayout, uint8_t unitFlag = 0)
+    {
+        AscendC::FixpipeParamsV220 intriParams;
+
+        // Fixpipe layout information
+        intriParams.nSize = dstLayout.shape(1);
+        intriParams.mSize = dstLayout.shape(0);
+        intriParams.srcStride = srcLayout.stride(3) / srcLayout.stride(0);
+        intriParams.dstStride = dstLayout.stride(0);
+
+        // Fixpipe auxiliary arguments
+        intriParams.quantPre = quantPre;
+        intriParams.deqScalar = quantScalar;
+        intriParams.reluEn = reluEn;
+        intriParams.unitFlag = unitFlag;
+
+        // Call AscendC Fixpipe
+        AscendC::Fixpipe<ElementDst, ElementSrc, AscendC::CFG_ROW_MAJOR>(dst, src, intriParams);
+    }
+};
+
+/// Quantizing copy with one quant parameter per output column. quantTensor holds the parameters of the copied
+/// columns in L1; the fixpipe moves them to its own buffer before the copy, so they must be in L1 before FIX starts.
+template <
+    class ElementAccumulator_,
+    class ElementDst_,
+    bool ReluEnable_
+>
+struct CopyL0CToGm<Catlass::Arch::AtlasA2,
+                   ElementAccumulator_,
+                   Gemm::GemmType<ElementDst_, layout::RowMajor>,
+                   ScaleGranularity::PER_CHANNEL,
+                   ReluEnable_>
+{
+    using ArchTag = Catlass::Arch::AtlasA2;
+    using ElementDst = ElementDst_;
+    using ElementSrc = ElementAccumulator_;
+    using LayoutSrc = Catlass::layout::zN;
+    using LayoutDst = Catlass::layout::RowMajor;
+    static constexpr auto DEQUANT_GRANULARITY = ScaleGranularity::PER_CHANNEL;
+    static constexpr auto quantPre = CopyL0CToGmQuantMode<ArchTag, ElementSrc, ElementDst,
+        ScaleGranularity::PER_CHANNEL>::VALUE;
+    static constexpr auto reluEn = ReluEnable_;
+
+    CATLASS_DEVICE
+    void operator()(AscendC::GlobalTensor<ElementDst> const &dst, AscendC::LocalTensor<ElementSrc> const &src,
+        AscendC::LocalTensor<uint64_t> const &quantTensor, LayoutDst const &dstLayout, LayoutSrc const &srcLayout,
+        uint8_t unitFlag = 0)
+    {
+        AscendC::FixpipeParamsV220 intriParams;
+
+        // Fixpipe layout information
+        intriParams.nSize = dstLayout.shape(1);
+        intriParams.mSize = dstLayout.shape(0);
+        intriParams.srcStride = srcLayout.stride(3) / srcLayout.stride(0);
+        intriParams.dstStride = dstLayout.stride(0);
+
+        // Fixpipe auxiliary arguments
+        intriParams.quantPre = quantPre;
+        intriParams.reluEn = reluEn;
+        intriParams.unitFlag = unitFlag;
+
+        // Call AscendC Fixpipe
+        AscendC::Fixpipe<ElementDst, ElementSrc, AscendC::CFG_ROW_MAJOR>(dst, src, quantTensor, intriParams);
+    }
+};
+
 ///////////////////////////////////////////CopyL0CToGmTla/////////////////////////////////////////////////
 template <
     class ArchTag,
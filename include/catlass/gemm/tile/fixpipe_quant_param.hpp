@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMM_TILE_FIXPIPE_QUANT_PARAM_HPP
+#define CATLASS_GEMM_TILE_FIXPIPE_QUANT_PARAM_HPP
+
+#include <cstdint>
+
+#include "catlass/detail/macros.hpp"
+
+namespace Catlass::Gemm::Tile {
+
+/// 64 bit quant parameter of the fixpipe requantization of int32_t accumulators to int8_t (REQ8 per tensor as
+/// FixpipeParamsV220::deqScalar, VREQ8 per output channel as a vector in L1):
+/// - bits [31:13]: the fp32 scale truncated to its upper 19 bits (sign, exponent and 10 mantissa bits);
+/// - bits [45:37]: the offset, a 9 bit signed integer added after rounding;
+/// - bit 46: set for a signed int8_t result.
+/// The fixpipe computes out = saturate(round(acc * scale) + offset), see golden/requant.hpp for the reference.
+struct FixpipeRequantParam {
+    static constexpr uint32_t SCALE_MASK = 0xFFFFE000;
+    static constexpr uint32_t OFFSET_SHIFT = 37;
+    static constexpr uint64_t OFFSET_MASK = 0x1FF;
+    static constexpr uint32_t SIGN_SHIFT = 46;
+    static constexpr int32_t OFFSET_MIN = -256;
+    static constexpr int32_t OFFSET_MAX = 255;
+
+    CATLASS_HOST_DEVICE
+    static uint64_t Encode(float scale, int32_t offset, bool isSigned = true)
+    {
+        union {
+            float f;
+            uint32_t u;
+        } scaleBits;
+        scaleBits.f = scale;
+        // The offset is saturated to its 9 bit field.
+        int32_t offsetClamped = offset < OFFSET_MIN ? OFFSET_MIN : (offset > OFFSET_MAX ? OFFSET_MAX : offset);
+        return static_cast<uint64_t>(scaleBits.u & SCALE_MASK) |
+            ((static_cast<uint64_t>(static_cast<uint32_t>(offsetClamped)) & OFFSET_MASK) << OFFSET_SHIFT) |
+            (static_cast<uint64_t>(isSigned ? 1 : 0) << SIGN_SHIFT);
+    }
+};
+
+} // namespace Catlass::Gemm::Tile
+
+#endif // CATLASS_GEMM_TILE_FIXPIPE_QUANT_PARAM_HPP
@@ -65,6 +65,45 @@ struct TileCopy {
             typename BiasTypeSelector::L0BiasType>>;
 };
 
+/// TileCopy whose GM to L1 copies choose per tile between nd2nz and the interval copy (CopyGmToL1Adaptive), for
+/// kernels with a small M (decode) or operands with strides of STRIDE_LIMIT or more. The choice follows the
+/// relative estimates of CopyGmToL1CostModel, which are not calibrated on hardware, so kernels opt in explicitly.
+template <
+    /// Tag indicating architecture
+    class ArchTag,
+    /// GemmType for A matrix operand
+    class AType,
+    /// GemmType type for B matrix operand
+    class BType,
+    /// GemmType type for C matrix operand
+    class CType,
+    /// GemmType type for Bias operand
+    class BiasType = void
+>
+struct TileCopyAdaptive : public TileCopy<ArchTag, AType, BType, CType, BiasType> {
+    using CopyGmToL1A = typename Gemm::Tile::CopyGmToL1Selector<ArchTag, AType>::CopyGmToL1;
+    using CopyGmToL1B = typename Gemm::Tile::CopyGmToL1Selector<ArchTag, BType>::CopyGmToL1;
+};
+
+/// TileCopy whose L0C to GM copy quantizes the accumulator in the fixpipe, with one quant parameter for the whole
+/// tensor (PER_TENSOR) or one per output column (PER_CHANNEL), e.g. int32_t to int8_t requantization.
+template <
+    /// Tag indicating architecture
+    class ArchTag,
+    /// GemmType for A matrix operand
+    class AType,
+    /// GemmType type for B matrix operand
+    class BType,
+    /// GemmType type for C matrix operand
+    class CType,
+    /// Granularity of the quant parameters
+    ScaleGranularity DEQUANT_GRANULARITY
+>
+struct QuantTileCopy : public TileCopy<ArchTag, AType, BType, CType> {
+    using ElementAccumulator = typename TileCopy<ArchTag, AType, BType, CType>::ElementAccumulator;
+    using CopyL0CToGm = Gemm::Tile::CopyL0CToGm<ArchTag, ElementAccumulator, CType, DEQUANT_GRANULARITY>;
+};
+
 template <
     /// Tag indicating architecture
     class ArchTag,
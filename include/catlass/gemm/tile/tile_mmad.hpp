@@ -33,6 +33,9 @@ struct TileMmad {
     using ElementB = typename BType_::Element;
     using ElementAccumulator =
         typename Gemm::helper::ElementAccumulatorSelector<ElementA, ElementB>::ElementAccumulator;
+    static_assert(Gemm::helper::CubeOperandSupport<ArchTag_, ElementA, ElementB>::VALUE,
+        "The cube unit multiplies operands of the same element type only (half, bfloat16_t, float, int8_t or "
+        "int4b_t). Convert the other operand first, e.g. in an AIV prologue.");
 
     // Methods
 
@@ -107,6 +110,11 @@ template <
     class TensorBias = void
 >
 struct TileMmadTla {
+    static_assert(Gemm::helper::CubeOperandSupport<ArchTag_, typename TensorA::Element,
+        typename TensorB::Element>::VALUE,
+        "The cube unit multiplies operands of the same element type only (half, bfloat16_t, float, int8_t or "
+        "int4b_t). Convert the other operand first, e.g. in an AIV prologue.");
+
     // Methods
 
     CATLASS_DEVICE
@@ -127,10 +127,18 @@ public:
         )
      {
         AscendC::WaitFlag<AscendC::HardEvent::MTE3_MTE2>((event_t)(UbOutEventList[UbOutListId]));
-        vecCopyGmToUb(UbYTensorList[UbOutListId], gmYCopy,actualShape.m());
-        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>((event_t)(UbOutEventList[UbOutListId]));  
+        // For β == 0, Y is not read, so that a NaN or an infinity in it does not turn βY into a NaN
+        if (beta != 0.0f) {
+            vecCopyGmToUb(UbYTensorList[UbOutListId], gmYCopy,actualShape.m());
+        }
+        // Also orders the overwrite of the buffer after its previous store to GM
+        AscendC::SetFlag<AscendC::HardEvent::MTE2_V>((event_t)(UbOutEventList[UbOutListId]));
         AscendC::WaitFlag<AscendC::HardEvent::MTE2_V>((event_t)(UbOutEventList[UbOutListId]));
-        tileVmuls(UbYTensorList[UbOutListId], UbYTensorList[UbOutListId], (ElementY)beta, actualShape.m());
+        if (beta != 0.0f) {
+            tileVmuls(UbYTensorList[UbOutListId], UbYTensorList[UbOutListId], (ElementY)beta, actualShape.m());
+        } else {
+            AscendC::Duplicate<ElementY>(UbYTensorList[UbOutListId], (ElementY)0, actualShape.m());
+        }
         AscendC::SetFlag<AscendC::HardEvent::V_MTE2>((event_t)(UbOutEventList[UbOutListId]));
         AscendC::WaitFlag<AscendC::HardEvent::V_MTE2>((event_t)(UbOutEventList[UbOutListId]));
 
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMV_KERNEL_GEMV_SPLIT_K_STRATEGY_HPP
+#define CATLASS_GEMV_KERNEL_GEMV_SPLIT_K_STRATEGY_HPP
+
+#include <cstdint>
+
+#include "catlass/detail/alignment.hpp"
+#include "catlass/detail/macros.hpp"
+
+namespace Catlass::Gemv::Kernel {
+
+/// Work split of KernelGemvAivSplitK for y (m) = A (m x n) * x (n). The reduction axis n (the K of the GEMV) is cut
+/// into splitK chunks of equal, kAlign aligned length, the rows into tiles of tileM. A work item is one row tile
+/// times one chunk; item w covers row tile w / splitK and chunk w % splitK, so the chunks of a row tile are
+/// adjacent. The items are cut into coreNum contiguous ranges whose sizes differ by at most one.
+struct GemvSplitKPartition {
+    /// Fixed cost of one work item, in elements of A: loading and scaling y, the pipeline fill and the atomic
+    /// store of the partial result.
+    static constexpr uint32_t ITEM_OVERHEAD = 4096;
+
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t ChunkLength(uint32_t n, uint32_t splitK, uint32_t kAlign)
+    {
+        return RoundUp(CeilDiv(n, splitK), kAlign);
+    }
+
+    /// The number of non empty chunks, which can be below splitK once the chunk length is aligned.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t ChunkNum(uint32_t n, uint32_t splitK, uint32_t kAlign)
+    {
+        return CeilDiv(n, ChunkLength(n, splitK, kAlign));
+    }
+
+    /// First work item of core coreIdx; the range of the core ends at WorkStart(workNum, coreNum, coreIdx + 1).
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t WorkStart(uint32_t workNum, uint32_t coreNum, uint32_t coreIdx)
+    {
+        uint32_t base = workNum / coreNum;
+        uint32_t remain = workNum % coreNum;
+        return coreIdx * base + ((coreIdx < remain) ? coreIdx : remain);
+    }
+
+    /// β of the partial result of chunk chunkIdx, which is added to y. For β != 0, y holds the input y, so the first
+    /// chunk adds (β - 1)y and the others none. For β == 0, y starts at zero and no chunk reads the input y, so that
+    /// a NaN or an infinity in it does not reach the result.
+    CATLASS_HOST_DEVICE
+    static constexpr float ChunkBeta(float beta, uint32_t chunkIdx)
+    {
+        return ((beta == 0.0f) || (chunkIdx != 0)) ? 0.0f : (beta - 1.0f);
+    }
+
+    /// Estimated cycles of the busiest core, in elements of A.
+    CATLASS_HOST_DEVICE
+    static constexpr uint64_t Cost(uint32_t m, uint32_t n, uint32_t tileM, uint32_t kAlign, uint32_t coreNum,
+        uint32_t splitK)
+    {
+        uint32_t chunkLength = ChunkLength(n, splitK, kAlign);
+        uint32_t workNum = CeilDiv(m, tileM) * ChunkNum(n, splitK, kAlign);
+        uint32_t rows = (m < tileM) ? m : tileM;
+        return static_cast<uint64_t>(CeilDiv(workNum, coreNum)) *
+            (static_cast<uint64_t>(rows) * chunkLength + ITEM_OVERHEAD);
+    }
+
+    /// Host side choice of splitK: the chunk count that minimizes the work of the busiest core. Ties go to fewer
+    /// chunks, which means fewer atomic stores into y. The result is normalized, ChunkNum returns it unchanged.
+    CATLASS_HOST_DEVICE
+    static constexpr uint32_t SelectSplitK(uint32_t m, uint32_t n, uint32_t tileM, uint32_t kAlign, uint32_t coreNum)
+    {
+        uint32_t maxSplitK = CeilDiv(n, kAlign);
+        uint32_t bestSplitK = 1;
+        uint64_t bestCost = Cost(m, n, tileM, kAlign, coreNum, 1);
+        for (uint32_t splitK = 2; splitK <= maxSplitK; ++splitK) {
+            uint32_t chunkNum = ChunkNum(n, splitK, kAlign);
+            if (chunkNum != splitK) {
+                // Same split as a smaller splitK
+                continue;
+            }
+            uint64_t cost = Cost(m, n, tileM, kAlign, coreNum, splitK);
+            if (cost < bestCost) {
+                bestCost = cost;
+                bestSplitK = splitK;
+            }
+        }
+        return bestSplitK;
+    }
+};
+
+} // namespace Catlass::Gemv::Kernel
+
+#endif // CATLASS_GEMV_KERNEL_GEMV_SPLIT_K_STRATEGY_HPP
@@ -70,6 +70,32 @@ public:
               ptrWorkspace(ptrWorkspace_), epilogueParams(epilogueParams_) {}
     };
 
+    struct Arguments {
+        GemvCoord problemShape;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        EpilogueParams epilogueParams;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        return true;
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        // The m results of A * x before the epilogue.
+        return static_cast<size_t>(args.problemShape.m()) * sizeof(ElementY);
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrX, args.layoutX, args.ptrA, args.layoutA, workspace,
+            args.epilogueParams};
+    }
+
     // Methods
     CATLASS_DEVICE
     KernelGemvAic() {}
@@ -64,6 +64,37 @@
                ptrY(ptrY_),layoutY(layoutY_),ptrY_read(ptrY_read_),alpha(alpha_),beta(beta_),split(split_) {}
      };
 
+     struct Arguments {
+         GemvCoord problemShape;
+         GM_ADDR ptrA;
+         LayoutA layoutA;
+         GM_ADDR ptrX;
+         LayoutX layoutX;
+         GM_ADDR ptrY;
+         LayoutY layoutY;
+         GM_ADDR ptrY_read;
+         float alpha;
+         float beta;
+         uint32_t split;
+     };
+
+     static bool CanImplement(const Arguments &args)
+     {
+         // N is divided into split parts, each part must keep at least one column.
+         return (args.split >= 1) && (args.split <= args.problemShape.n());
+     }
+
+     static size_t GetWorkspaceSize(const Arguments &args)
+     {
+         return 0;
+     }
+
+     static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+     {
+         return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrX, args.layoutX,
+             args.ptrY, args.layoutY, args.ptrY_read, args.alpha, args.beta, args.split};
+     }
+
     
      // Methods
      CATLASS_DEVICE
@@ -0,0 +1,179 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_GEMV_KERNEL_GEMV_AIV_SPLIT_K_HPP
+#define CATLASS_GEMV_KERNEL_GEMV_AIV_SPLIT_K_HPP
+
+#include "catlass/catlass.hpp"
+#include "catlass/arch/resource.hpp"
+#include "catlass/coord.hpp"
+#include "catlass/layout/layout.hpp"
+#include "catlass/gemv_coord.hpp"
+#include "catlass/matrix_coord.hpp"
+#include "catlass/gemm/gemm_type.hpp"
+#include "catlass/gemv/kernel/gemv_split_k_strategy.hpp"
+#include "catlass/gemv/tile/vec_copy_ub_to_gm.hpp"
+
+namespace Catlass::Gemv::Kernel {
+
+// Template for split-K Gemv kernel. Compute Y = αA * x + βY for a row major or column major A. The reduction axis
+// is cut into splitK equal chunks and the work items (row tile x chunk) are spread evenly over all vector cores
+// (GemvSplitKPartition), so a few rows with a long reduction still keep every core busy. The partial results are
+// accumulated into Y with atomic adds, so BlockGemv must use TileCopyGemvAivSplitK, Y must hold the input Y and
+// ptrY_read a copy of it. For β == 0 the input Y is never read: Y must be zeroed before the launch instead, e.g. with
+// aclrtMemsetAsync on the same stream, and ptrY_read is unused. Choose splitK on the host with
+// GemvSplitKPartition::SelectSplitK.
+template <
+    class BlockGemv_,
+    class BlockEpilogue_
+>
+class KernelGemvAivSplitK {
+public:
+    using BlockGemv = BlockGemv_;
+    using ArchTag = typename BlockGemv::ArchTag;
+    using UBTileShape = typename BlockGemv::UBTileShape;
+    using ElementA = typename BlockGemv::ElementA;
+    using LayoutA = typename BlockGemv::LayoutA;
+    using ElementX = typename BlockGemv::ElementX;
+    using LayoutX = typename BlockGemv::LayoutX;
+    using ElementY = typename BlockGemv::ElementY;
+    using LayoutY = typename BlockGemv::LayoutY;
+    using ElementAccumulator = typename BlockGemv::ElementAccumulator;
+
+    static_assert(std::is_same_v<typename BlockGemv::VecCopyUbToGm,
+        Tile::VecCopyUBToGm<ArchTag, Gemm::GemmType<ElementY, LayoutY>, true>>,
+        "KernelGemvAivSplitK accumulates partial results atomically, use TileCopyGemvAivSplitK.");
+
+    static constexpr uint32_t ALIGN = BYTE_PER_C0 / sizeof(ElementA);
+    /// Rows of one work item
+    static constexpr uint32_t TILE_M = RoundUp<ALIGN>(UBTileShape::M);
+    /// Alignment of the chunks, whole UB tiles
+    static constexpr uint32_t K_ALIGN = RoundUp<ALIGN>(UBTileShape::N);
+
+    /// Parameters structure
+    struct Params {
+        // Data members
+        GemvCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrY;
+        LayoutY layoutY;
+        GM_ADDR ptrY_read;
+        float alpha;
+        float beta;
+        uint32_t splitK;
+
+        // Methods
+        CATLASS_HOST_DEVICE
+        Params() {}
+
+        CATLASS_HOST_DEVICE
+        Params(GemvCoord const &problemShape_, GM_ADDR ptrA_, LayoutA layoutA_, GM_ADDR ptrX_, LayoutX layoutX_,
+            GM_ADDR ptrY_, LayoutY layoutY_, GM_ADDR ptrY_read_, float alpha_, float beta_, uint32_t splitK_)
+            : problemShape(problemShape_), ptrA(ptrA_), layoutA(layoutA_), ptrX(ptrX_), layoutX(layoutX_),
+              ptrY(ptrY_), layoutY(layoutY_), ptrY_read(ptrY_read_), alpha(alpha_), beta(beta_), splitK(splitK_) {}
+    };
+
+    struct Arguments {
+        GemvCoord problemShape;
+        GM_ADDR ptrA;
+        LayoutA layoutA;
+        GM_ADDR ptrX;
+        LayoutX layoutX;
+        GM_ADDR ptrY;
+        LayoutY layoutY;
+        GM_ADDR ptrY_read;
+        float alpha;
+        float beta;
+        uint32_t splitK;
+    };
+
+    static bool CanImplement(const Arguments &args)
+    {
+        // Every chunk must keep at least one element of the reduction axis.
+        return (args.splitK >= 1) &&
+            (GemvSplitKPartition::ChunkNum(args.problemShape.n(), args.splitK, K_ALIGN) == args.splitK);
+    }
+
+    static size_t GetWorkspaceSize(const Arguments &args)
+    {
+        return 0;
+    }
+
+    static Params ToUnderlyingArguments(const Arguments &args, uint8_t *workspace)
+    {
+        return Params{args.problemShape, args.ptrA, args.layoutA, args.ptrX, args.layoutX,
+            args.ptrY, args.layoutY, args.ptrY_read, args.alpha, args.beta, args.splitK};
+    }
+
+    // Methods
+    CATLASS_DEVICE
+    KernelGemvAivSplitK() {}
+
+    template <int32_t CORE_TYPE = g_coreType>
+    CATLASS_DEVICE
+    void operator()(Params const &params);
+
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIC>(Params const &params) {}
+
+    /// Executes one Gemv
+    template <>
+    CATLASS_DEVICE
+    void operator()<AscendC::AIV>(Params const &params) {
+        AscendC::SetAtomicNone();
+        Arch::Resource<ArchTag> resource;
+        BlockGemv blockGemv(resource);
+
+        uint32_t m = params.problemShape.m();
+        uint32_t n = params.problemShape.n();
+        uint32_t chunkLength = GemvSplitKPartition::ChunkLength(n, params.splitK, K_ALIGN);
+        uint32_t workNum = CeilDiv(m, TILE_M) * params.splitK;
+        uint32_t aivNum = AscendC::GetBlockNum() * AscendC::GetTaskRation();
+        uint32_t aivIdx = AscendC::GetBlockIdx();
+        uint32_t workStart = GemvSplitKPartition::WorkStart(workNum, aivNum, aivIdx);
+        uint32_t workEnd = GemvSplitKPartition::WorkStart(workNum, aivNum, aivIdx + 1);
+
+        // Represent the full gm
+        AscendC::GlobalTensor<ElementA> gmA;
+        gmA.SetGlobalBuffer((__gm__ ElementA *)params.ptrA);
+        AscendC::GlobalTensor<ElementX> gmX;
+        gmX.SetGlobalBuffer((__gm__ ElementX *)params.ptrX);
+        AscendC::GlobalTensor<ElementY> gmY;
+        gmY.SetGlobalBuffer((__gm__ ElementY *)params.ptrY);
+        AscendC::GlobalTensor<ElementY> gmYCopy;
+        gmYCopy.SetGlobalBuffer((__gm__ ElementY *)params.ptrY_read);
+
+        for (uint32_t workIdx = workStart; workIdx < workEnd; ++workIdx) {
+            uint32_t mOffset = workIdx / params.splitK * TILE_M;
+            uint32_t chunkIdx = workIdx % params.splitK;
+            uint32_t kOffset = chunkIdx * chunkLength;
+            uint32_t mActual = (m - mOffset > TILE_M) ? TILE_M : (m - mOffset);
+            uint32_t kActual = (n - kOffset > chunkLength) ? chunkLength : (n - kOffset);
+            int64_t gmOffsetA = params.layoutA.GetOffset(MatrixCoord{mOffset, kOffset});
+
+            float beta = GemvSplitKPartition::ChunkBeta(params.beta, chunkIdx);
+            blockGemv(gmA[gmOffsetA], params.layoutA,
+                gmX[kOffset], params.layoutX,
+                gmY[mOffset], params.layoutY,
+                gmYCopy[mOffset],
+                GemvCoord{mActual, kActual},
+                params.alpha,
+                beta);
+        }
+    }
+};
+
+} // namespace Catlass::Gemv::Kernel
+
+#endif // CATLASS_GEMV_KERNEL_GEMV_AIV_SPLIT_K_HPP
@@ -55,6 +55,23 @@ struct TileCopyGemvAiv {
     using MatrixCopyGmToUb = Gemv::Tile::MatrixCopyGmToUB<ArchTag, AType>;
 };
 
+/// TileCopyGemvAiv whose Y store adds atomically for every layout of A, for KernelGemvAivSplitK.
+template <
+    /// Tag indicating architecture
+    class ArchTag,
+    /// MatmulType for A matrix operand
+    class AType,
+    /// MatmulType type for X vector operand
+    class XType,
+    /// MatmulType type for Y vector operand
+    class YType,
+    /// MatmulTpe type for Bias operand
+    class BiasType = void
+>
+struct TileCopyGemvAivSplitK : public TileCopyGemvAiv<ArchTag, AType, XType, YType, BiasType> {
+    using VecCopyUbToGm = Gemv::Tile::VecCopyUBToGm<ArchTag, YType, true>;
+};
+
 
 template <
     /// Tag indicating architecture
@@ -311,8 +311,8 @@ public:
     CATLASS_HOST_DEVICE constexpr
     static nZ MakeLayout(Index orgRows, Index orgCols)
     {
-        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
-        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL / sizeof(Element);
+        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
+        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL * 8 / SizeOfBits<Element>::VALUE;
         Index rowsRound = RoundUp<ELE_NUM_PER_C0>(orgRows);
         Index colsRound = RoundUp<C0_NUM_PER_FRACTAL>(orgCols);
         return nZ(orgRows,
@@ -480,8 +480,8 @@ public:
     CATLASS_HOST_DEVICE constexpr
     static zN MakeLayout(Index orgRows, Index orgCols)
     {
-        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
-        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL / sizeof(Element);
+        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
+        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL * 8 / SizeOfBits<Element>::VALUE;
         Index rowsRound = RoundUp<C0_NUM_PER_FRACTAL>(orgRows);
         Index colsRound = RoundUp<ELE_NUM_PER_C0>(orgCols);
         return zN(orgRows,
@@ -664,8 +664,8 @@ public:
     CATLASS_HOST_DEVICE constexpr
     static zZ MakeLayout(Index orgRows, Index orgCols)
     {
-        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
-        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL / sizeof(Element);
+        constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
+        constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL * 8 / SizeOfBits<Element>::VALUE;
         Index rowsRound = RoundUp<C0_NUM_PER_FRACTAL>(orgRows);
         Index colsRound = RoundUp<ELE_NUM_PER_C0>(orgCols);
         return zZ(orgRows,
@@ -1104,8 +1104,8 @@ public:
     /// Make the layout of a coordinate (row, column)
     template <class Element>
     CATLASS_HOST_DEVICE static nN MakeLayout(Index orgRows, Index orgCols) {
-        static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 / sizeof(Element);
-        static constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL / sizeof(Element);
+        static constexpr uint32_t ELE_NUM_PER_C0 = BYTE_PER_C0 * 8 / SizeOfBits<Element>::VALUE;
+        static constexpr uint32_t ELE_NUM_PER_FRACTAL = BYTE_PER_FRACTAL * 8 / SizeOfBits<Element>::VALUE;
         Index rowsRound = RoundUp<ELE_NUM_PER_C0>(orgRows);
         Index colsRound = RoundUp<C0_NUM_PER_FRACTAL>(orgCols);
         return nN(orgRows,
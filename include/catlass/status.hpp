@@ -0,0 +1,29 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef CATLASS_STATUS_HPP
+#define CATLASS_STATUS_HPP
+
+namespace Catlass {
+
+/// Result of the host side calls of the device adapters.
+enum class Status {
+    kSuccess,
+    /// CanImplement of the kernel rejected the arguments.
+    kErrorInvalidProblem,
+    /// The kernel needs a workspace and none was given.
+    kErrorWorkspaceNull,
+    /// The adapter has not been initialized with arguments.
+    kErrorNotInitialized
+};
+
+}  // namespace Catlass
+
+#endif  // CATLASS_STATUS_HPP
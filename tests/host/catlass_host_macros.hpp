@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef TESTS_HOST_CATLASS_HOST_MACROS_HPP
+#define TESTS_HOST_CATLASS_HOST_MACROS_HPP
+
+#include <cstdint>
+
+// Stand-in for catlass/detail/macros.hpp, so the host compiler can build the catlass headers that
+// only hold constexpr host/device helpers. Include it before any catlass header.
+#define CATLASS_DETAIL_MACROS_HPP
+
+#define CATLASS_DEVICE inline
+#define CATLASS_HOST_DEVICE inline
+#define CATLASS_GLOBAL
+
+#endif // TESTS_HOST_CATLASS_HOST_MACROS_HPP
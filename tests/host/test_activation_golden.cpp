@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "test_common.hpp"
+#include "golden/activation.hpp"
+
+using namespace Catlass;
+using golden::ActivationType;
+
+namespace {
+// The sigmoid forms evaluated by TileGelu, TileFastGelu and TileSilu, in the same order of operations.
+float DeviceGelu(float x)
+{
+    float g = 1.5957691216f * (x + 0.044715f * x * x * x);
+    return x / (1.0f + std::exp(-g));
+}
+
+float DeviceSigmoidForm(float x, float scale)
+{
+    return x / (1.0f + std::exp(-scale * x));
+}
+
+bool Near(float a, float b, float tol = 1e-5f)
+{
+    return std::fabs(a - b) <= tol * std::max(1.0f, std::fabs(b));
+}
+} // namespace
+
+HOST_TEST(GeluSigmoidFormMatchesTanhForm)
+{
+    for (float x = -8.0f; x <= 8.0f; x += 0.125f) {
+        CHECK(Near(DeviceGelu(x), golden::ComputeActivation(ActivationType::GELU, x)));
+    }
+    CHECK(Near(golden::ComputeActivation(ActivationType::GELU, 1.0f), 0.841192f));
+    CHECK(Near(golden::ComputeActivation(ActivationType::GELU, -1.0f), -0.158808f));
+}
+
+HOST_TEST(SigmoidActivations)
+{
+    for (float x = -8.0f; x <= 8.0f; x += 0.125f) {
+        CHECK(Near(DeviceSigmoidForm(x, 1.0f), golden::ComputeActivation(ActivationType::SILU, x)));
+        CHECK(Near(DeviceSigmoidForm(x, 1.702f), golden::ComputeActivation(ActivationType::FAST_GELU, x)));
+    }
+    CHECK(Near(golden::ComputeActivation(ActivationType::SILU, 1.0f), 0.731059f));
+    CHECK_EQ(golden::ComputeActivation(ActivationType::SILU, 0.0f), 0.0f);
+}
+
+HOST_TEST(ReluAndNone)
+{
+    CHECK_EQ(golden::ComputeActivation(ActivationType::RELU, -2.5f), 0.0f);
+    CHECK_EQ(golden::ComputeActivation(ActivationType::RELU, 2.5f), 2.5f);
+    CHECK_EQ(golden::ComputeActivation(ActivationType::NONE, -2.5f), -2.5f);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#ifndef TESTS_HOST_TEST_COMMON_HPP
+#define TESTS_HOST_TEST_COMMON_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+// Minimal test harness, so the host tests need nothing beyond the standard library.
+namespace HostTest {
+
+struct TestCase {
+    const char *name;
+    std::function<void()> func;
+};
+
+inline std::vector<TestCase> &Registry()
+{
+    static std::vector<TestCase> tests;
+    return tests;
+}
+
+inline int &FailureCount()
+{
+    static int failures = 0;
+    return failures;
+}
+
+struct Registrar {
+    Registrar(const char *name, std::function<void()> func)
+    {
+        Registry().push_back({name, std::move(func)});
+    }
+};
+
+inline int RunAll()
+{
+    int failedTests = 0;
+    for (auto const &test : Registry()) {
+        int before = FailureCount();
+        test.func();
+        bool passed = (FailureCount() == before);
+        std::printf("[%s] %s\n", passed ? "PASS" : "FAIL", test.name);
+        failedTests += passed ? 0 : 1;
+    }
+    std::printf("%zu tests, %d failed\n", Registry().size(), failedTests);
+    return failedTests == 0 ? 0 : 1;
+}
+
+/// Deterministic pseudo random test data, uniform in [offset - amplitude, offset + amplitude]. Use a different seed
+/// per operand so that the operands are not correlated.
+inline std::vector<float> MakeData(size_t count, float offset, float amplitude, uint32_t seed)
+{
+    std::vector<float> data(count);
+    uint32_t state = seed;
+    for (auto &value : data) {
+        state = state * 1664525u + 1013904223u;
+        value = offset + amplitude * (static_cast<float>(state >> 8) / static_cast<float>(1u << 24) * 2.0f - 1.0f);
+    }
+    return data;
+}
+
+} // namespace HostTest
+
+#define HOST_TEST(name)                                                 \
+    static void name();                                                 \
+    static HostTest::Registrar name##Registrar(#name, name);            \
+    static void name()
+
+#define CHECK(cond)                                                                 \
+    do {                                                                            \
+        if (!(cond)) {                                                              \
+            std::printf("  %s:%d: CHECK(%s) failed\n", __FILE__, __LINE__, #cond);  \
+            ++HostTest::FailureCount();                                             \
+        }                                                                           \
+    } while (0)
+
+#define CHECK_EQ(lhs, rhs) CHECK((lhs) == (rhs))
+
+#endif // TESTS_HOST_TEST_COMMON_HPP
@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include "catlass_host_macros.hpp"
+#include "test_common.hpp"
+#include "catlass/gemm/tile/copy_gm_to_l1_strategy.hpp"
+
+using Catlass::Gemm::Tile::CopyGmToL1CostModel;
+using Catlass::Gemm::Tile::OperandPaddingCostModel;
+
+HOST_TEST(KnownTilesTakeExpectedCopy)
+{
+    constexpr bool SMALL_STRIDE = false;
+    constexpr bool LARGE_STRIDE = true;
+    // Aligned small M: 4 rows of 256 halves (512B) take the interval copy, 16 or more rows nd2nz.
+    CHECK(CopyGmToL1CostModel::SelectIntervalCopy(1, 512, SMALL_STRIDE));
+    CHECK(CopyGmToL1CostModel::SelectIntervalCopy(4, 512, SMALL_STRIDE));
+    CHECK(CopyGmToL1CostModel::SelectIntervalCopy(8, 1024, SMALL_STRIDE));
+    CHECK(!CopyGmToL1CostModel::SelectIntervalCopy(16, 512, SMALL_STRIDE));
+    CHECK(!CopyGmToL1CostModel::SelectIntervalCopy(128, 512, SMALL_STRIDE));
+    // Short rows leave nd2nz little to waste even with few of them.
+    CHECK(!CopyGmToL1CostModel::SelectIntervalCopy(8, 32, SMALL_STRIDE));
+    // Unaligned small M: lines of 100 halves (200B) are not whole 32B blocks, nd2nz is the only option.
+    CHECK(!CopyGmToL1CostModel::SelectIntervalCopy(1, 200, SMALL_STRIDE));
+    CHECK(!CopyGmToL1CostModel::SelectIntervalCopy(4, 200, SMALL_STRIDE));
+    CHECK(!CopyGmToL1CostModel::SelectIntervalCopy(4, 200, LARGE_STRIDE));
+    // Stride of STRIDE_LIMIT or more: aligned lines take the interval copy whatever the line count.
+    CHECK(CopyGmToL1CostModel::SelectIntervalCopy(1, 32, LARGE_STRIDE));
+    CHECK(CopyGmToL1CostModel::SelectIntervalCopy(16, 512, LARGE_STRIDE));
+    CHECK(CopyGmToL1CostModel::SelectIntervalCopy(256, 512, LARGE_STRIDE));
+}
+
+HOST_TEST(DecodeTilesUseIntervalCopy)
+{
+    // Half tiles with an L1 K of 256 or 512 elements are 16 or 32 blocks per row, M of decode is at most 8.
+    for (uint32_t lineCount = 1; lineCount <= 8; ++lineCount) {
+        for (uint32_t lineBlocks = 16; lineBlocks <= 32; lineBlocks *= 2) {
+            CHECK(CopyGmToL1CostModel::UseIntervalCopy(lineCount, lineBlocks));
+        }
+    }
+}
+
+HOST_TEST(FullFractalTilesUseNd2Nz)
+{
+    for (uint32_t lineCount = 16; lineCount <= 256; lineCount += 16) {
+        for (uint32_t lineBlocks = 1; lineBlocks <= 64; ++lineBlocks) {
+            CHECK(!CopyGmToL1CostModel::UseIntervalCopy(lineCount, lineBlocks));
+        }
+    }
+}
+
+HOST_TEST(RuleIsConstexpr)
+{
+    static_assert(CopyGmToL1CostModel::UseIntervalCopy(1, 16), "single row tile should take the interval copy");
+    static_assert(!CopyGmToL1CostModel::UseIntervalCopy(128, 16), "full tile should take nd2nz");
+}
+
+HOST_TEST(LargeStrideTakesIntervalCopy)
+{
+    // nd2nz can not batch lines whose stride does not fit its 16 bit field, every line is a separate instruction.
+    CHECK_EQ(CopyGmToL1CostModel::Nd2NzCycles(4, 16, true), 1120U);
+    CHECK_EQ(CopyGmToL1CostModel::Nd2NzCycles(4, 16, false), 280U);
+    for (uint32_t lineCount = 1; lineCount <= 256; ++lineCount) {
+        for (uint32_t lineBlocks = 1; lineBlocks <= 64; ++lineBlocks) {
+            CHECK(CopyGmToL1CostModel::UseIntervalCopy(lineCount, lineBlocks, true));
+        }
+    }
+}
+
+HOST_TEST(AlignedOperandsAreNotPadded)
+{
+    constexpr uint32_t HALF_BYTES = 2;
+    for (uint32_t stride = 256; stride < Catlass::STRIDE_LIMIT; stride += 256) {
+        for (uint32_t reuse = 1; reuse <= 64; ++reuse) {
+            CHECK(!OperandPaddingCostModel::NeedPadding(128, 256, stride, HALF_BYTES, reuse));
+            CHECK(!OperandPaddingCostModel::NeedPadding(256, 256, stride, HALF_BYTES, reuse));
+        }
+    }
+}
+
+HOST_TEST(UnalignedStridePaddedOnlyWithReuse)
+{
+    constexpr uint32_t HALF_BYTES = 2;
+    // 128 lines of 256 halves, 1000 element stride: direct loads cost 2072 + 2048 cycles, the prologue 6144
+    // cycles plus aligned loads of 2072, so padding wins from the fourth load on.
+    CHECK_EQ(OperandPaddingCostModel::DirectTileCycles(128, 256, 1000, HALF_BYTES), 4120U);
+    CHECK_EQ(OperandPaddingCostModel::PaddingPassCycles(128, 256, 1000, HALF_BYTES), 6144U);
+    CHECK_EQ(OperandPaddingCostModel::PaddedTileCycles(128, 256, HALF_BYTES), 2072U);
+    for (uint32_t reuse = 1; reuse <= 3; ++reuse) {
+        CHECK(!OperandPaddingCostModel::NeedPadding(128, 256, 1000, HALF_BYTES, reuse));
+    }
+    CHECK(OperandPaddingCostModel::NeedPadding(128, 256, 1000, HALF_BYTES, 4));
+
+    // Once padding wins, more reuse never makes the in place load cheaper again.
+    for (uint32_t stride = 1; stride < 4096; stride += 7) {
+        bool padded = false;
+        for (uint32_t reuse = 1; reuse <= 64; ++reuse) {
+            bool need = OperandPaddingCostModel::NeedPadding(128, 256, stride, HALF_BYTES, reuse);
+            CHECK(!padded || need);
+            padded = need;
+        }
+    }
+}
+
+HOST_TEST(LargeStrideReadInPlace)
+{
+    constexpr uint32_t HALF_BYTES = 2;
+    constexpr uint32_t LARGE_STRIDE = Catlass::STRIDE_LIMIT;
+    // Aligned lines go through the interval copy: 256 * (12 + 16) cycles against 8192 + 4120 for padding.
+    CHECK_EQ(OperandPaddingCostModel::DirectTileCycles(256, 256, LARGE_STRIDE, HALF_BYTES), 7168U);
+    CHECK(!OperandPaddingCostModel::NeedPadding(256, 256, LARGE_STRIDE, HALF_BYTES, 1));
+    CHECK(!OperandPaddingCostModel::NeedPadding(256, 256, LARGE_STRIDE, HALF_BYTES, 2));
+    CHECK(OperandPaddingCostModel::NeedPadding(256, 256, LARGE_STRIDE, HALF_BYTES, 3));
+
+    // Lines that are not 32B aligned fall back to one nd2nz per line, which even a single load can not afford.
+    CHECK(OperandPaddingCostModel::NeedPadding(128, 100, LARGE_STRIDE + 100, HALF_BYTES, 1));
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
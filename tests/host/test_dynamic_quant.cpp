@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/dynamic_quant.hpp"
+
+using namespace Catlass;
+
+HOST_TEST(PerTokenQuantWithinHalfAStep)
+{
+    uint32_t m = 6;
+    uint32_t k = 333;
+    std::vector<float> activation = HostTest::MakeData(static_cast<size_t>(m) * k, 0.0f, 1.0f, k);
+    // Rows of growing magnitude, each with its own scale
+    for (size_t i = 0; i < activation.size(); ++i) {
+        activation[i] *= static_cast<float>(1 + i / k);
+    }
+    std::vector<int8_t> quant;
+    std::vector<float> perTokenScale;
+    golden::QuantizeActivationPerToken(m, k, activation, quant, perTokenScale);
+    CHECK_EQ(perTokenScale.size(), static_cast<size_t>(m));
+    for (uint32_t i = 0; i < m; ++i) {
+        float s = perTokenScale[i];
+        int32_t qMax = 0;
+        for (uint32_t p = 0; p < k; ++p) {
+            size_t idx = static_cast<size_t>(i) * k + p;
+            CHECK(std::fabs(quant[idx] * s - activation[idx]) <= 0.5f * s * 1.001f);
+            qMax = std::max(qMax, std::abs(static_cast<int32_t>(quant[idx])));
+        }
+        // The absmax of the row maps to the end of the range
+        CHECK_EQ(qMax, 127);
+    }
+}
+
+HOST_TEST(ZeroRowHasUnitScale)
+{
+    std::vector<float> activation(64, 0.0f);
+    std::vector<int8_t> quant;
+    std::vector<float> perTokenScale;
+    golden::QuantizeActivationPerToken(2, 32, activation, quant, perTokenScale);
+    CHECK_EQ(perTokenScale[0], 1.0f);
+    CHECK_EQ(perTokenScale[1], 1.0f);
+    for (int8_t q : quant) {
+        CHECK_EQ(q, 0);
+    }
+}
+
+HOST_TEST(TiesRoundToEven)
+{
+    // absmax 127 gives a unit scale, so every value is its own quantized value before rounding
+    std::vector<float> activation{127.0f, 0.5f, 1.5f, 2.5f, -2.5f, -0.5f, 3.49f, -127.0f};
+    std::vector<int8_t> quant;
+    std::vector<float> perTokenScale;
+    golden::QuantizeActivationPerToken(1, 8, activation, quant, perTokenScale);
+    CHECK_EQ(perTokenScale[0], 1.0f);
+    std::vector<int8_t> expected{127, 0, 2, 2, -2, 0, 3, -127};
+    CHECK(quant == expected);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
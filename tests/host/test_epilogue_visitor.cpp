@@ -0,0 +1,256 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include "test_common.hpp"
+#include "catlass_host_macros.hpp"
+#include "golden/epilogue_visitor.hpp"
+
+using namespace Catlass::Epilogue::Fusion;
+using Catlass::golden::EvaluateVisitorTree;
+using Catlass::golden::HostVisitor;
+using Catlass::golden::HostVisitorOp;
+using Catlass::golden::VisitorHostArguments;
+
+namespace {
+// Stand-in for a 2 byte device element type, only its size matters to the planner.
+struct Half16 {
+    uint16_t bits;
+};
+
+using Bias = RowBroadcast<1, float>;
+using Scale = ColBroadcast<2, float>;
+using X = AuxLoad<3, float>;
+using Y = AuxLoad<4, float>;
+
+// Replays the tile assignment of TileVisitor on one element: the node writes tiles[base], its operands live in
+// tiles[base] and tiles[base + 1], and a scratch tile is clobbered. A plan with too few tiles reads or writes
+// past TILES, a wrong evaluation order overwrites a live operand.
+template <class Node>
+struct TiledReplay {
+    static float Eval(std::vector<float> &tiles, uint32_t base, const VisitorHostArguments &args, float acc,
+        uint32_t row, uint32_t col)
+    {
+        CHECK(base < tiles.size());
+        tiles.at(base) = HostVisitor<Node>::Visit(args, acc, row, col);
+        return tiles[base];
+    }
+};
+
+template <class Op, class Child>
+struct TiledReplay<Compute<Op, Child>> {
+    static float Eval(std::vector<float> &tiles, uint32_t base, const VisitorHostArguments &args, float acc,
+        uint32_t row, uint32_t col)
+    {
+        float value = HostVisitorOp<Op>::Apply(args, TiledReplay<Child>::Eval(tiles, base, args, acc, row, col));
+        for (uint32_t i = 1; i <= Op::SCRATCH_TILES; ++i) {
+            CHECK(base + i < tiles.size());
+            tiles.at(base + i) = std::numeric_limits<float>::quiet_NaN();
+        }
+        tiles.at(base) = value;
+        return value;
+    }
+};
+
+template <class Op, class Lhs, class Rhs>
+struct TiledReplay<Compute<Op, Lhs, Rhs>> {
+    static float Eval(std::vector<float> &tiles, uint32_t base, const VisitorHostArguments &args, float acc,
+        uint32_t row, uint32_t col)
+    {
+        uint32_t lhsTile = base;
+        uint32_t rhsTile = base + 1;
+        if (VisitorTraits<Compute<Op, Lhs, Rhs>>::LHS_FIRST) {
+            TiledReplay<Lhs>::Eval(tiles, base, args, acc, row, col);
+            TiledReplay<Rhs>::Eval(tiles, base + 1, args, acc, row, col);
+        } else {
+            TiledReplay<Rhs>::Eval(tiles, base, args, acc, row, col);
+            TiledReplay<Lhs>::Eval(tiles, base + 1, args, acc, row, col);
+            lhsTile = base + 1;
+            rhsTile = base;
+        }
+        CHECK(rhsTile < tiles.size() && lhsTile < tiles.size());
+        float value = HostVisitorOp<Op>::Apply(args, tiles.at(lhsTile), tiles.at(rhsTile));
+        tiles.at(base) = value;
+        return value;
+    }
+};
+
+template <class Tree>
+float Replay(const VisitorHostArguments &args, float acc, uint32_t row, uint32_t col)
+{
+    std::vector<float> tiles(VisitorTraits<Tree>::TILES, 0.0f);
+    return TiledReplay<Tree>::Eval(tiles, 0, args, acc, row, col);
+}
+
+bool Near(float a, float b)
+{
+    return std::fabs(a - b) <= 1e-5f * std::max(1.0f, std::fabs(b));
+}
+} // namespace
+
+HOST_TEST(SethiUllmanTileCounts)
+{
+    CHECK_EQ(VisitorTraits<Acc>::TILES, 1U);
+    CHECK_EQ((VisitorTraits<Compute<OpAdd, Acc, Bias>>::TILES), 2U);
+    CHECK_EQ((VisitorTraits<Compute<OpRelu, Compute<OpAdd, Acc, Bias>>>::TILES), 2U);
+    // The activations need a scratch tile.
+    CHECK_EQ((VisitorTraits<Compute<OpGelu, Acc>>::TILES), 2U);
+    // A left deep chain never needs more than two tiles.
+    using Chain = Compute<OpAdd, Compute<OpMul, Compute<OpAdd, Acc, Bias>, Scale>, X>;
+    CHECK_EQ(VisitorTraits<Chain>::TILES, 2U);
+    // A balanced tree of depth two needs three.
+    using Balanced = Compute<OpMul, Compute<OpAdd, Acc, Bias>, Compute<OpSub, X, Y>>;
+    CHECK_EQ(VisitorTraits<Balanced>::TILES, 3U);
+    // A right heavy operand is evaluated first, so it needs no more than the left deep chain.
+    using RightHeavy = Compute<OpSub, Acc, Compute<OpAdd, X, Y>>;
+    CHECK(!VisitorTraits<RightHeavy>::LHS_FIRST);
+    CHECK_EQ(VisitorTraits<RightHeavy>::TILES, 2U);
+    // Stores and reductions reuse the tile of their child.
+    CHECK_EQ((VisitorTraits<Store<0, Half16, ColReduce<5, Balanced>>>::TILES), 3U);
+}
+
+HOST_TEST(UbPlanSizesTheStages)
+{
+    constexpr uint32_t ROW = 32;
+    constexpr uint32_t COLUMN = 256;
+    constexpr uint32_t COUNT = ROW * COLUMN;
+
+    // fp32 C, fp16 bias and fp16 D: one load and one store stage of fp16, no vector.
+    using BiasRelu = Store<0, Half16, Compute<OpRelu, Compute<OpAdd, Acc, RowBroadcast<1, Half16>>>>;
+    using Plan = VisitorUbPlan<BiasRelu, float, ROW, COLUMN>;
+    CHECK_EQ(Plan::TILES, 2U);
+    CHECK_EQ(Plan::LOAD_STAGE_OFFSET, 2 * COUNT * 4);
+    CHECK_EQ(Plan::LOAD_STAGE_BYTES, COUNT * 2);
+    CHECK_EQ(Plan::STORE_STAGE_BYTES, COUNT * 2);
+    CHECK_EQ(Plan::VECTOR_BYTES, 0U);
+    CHECK_EQ(Plan::BYTES, 2 * COUNT * 4 + 2 * COUNT * 2);
+
+    // All fp32: loads and stores go straight to the tiles. fp16 C still needs a load stage.
+    using Fp32Tree = Store<0, float, ColReduce<5, Compute<OpMul, Acc, ColBroadcast<2, float>>>>;
+    CHECK_EQ((VisitorUbPlan<Fp32Tree, float, ROW, COLUMN>::LOAD_STAGE_BYTES), 0U);
+    CHECK_EQ((VisitorUbPlan<Fp32Tree, float, ROW, COLUMN>::STORE_STAGE_BYTES), 0U);
+    CHECK_EQ((VisitorUbPlan<Fp32Tree, float, ROW, COLUMN>::VECTOR_BYTES), COLUMN * 4);
+    CHECK_EQ((VisitorUbPlan<Fp32Tree, Half16, ROW, COLUMN>::LOAD_STAGE_BYTES), COUNT * 2);
+
+    // The UB of a tree depends on its shape, not on its number of nodes.
+    using Chain = Compute<OpAdd, Compute<OpMul, Compute<OpAdd, Acc, Bias>, Scale>, X>;
+    CHECK_EQ(VisitorTraits<Chain>::NODES, 7U);
+    CHECK_EQ((VisitorUbPlan<Chain, float, ROW, COLUMN>::TILES), 2U);
+    CHECK_EQ(VisitorTraits<Chain>::TENSOR_MASK, (1U << 1) | (1U << 2) | (1U << 3));
+}
+
+HOST_TEST(InterpreterFusesBiasActivationAndOutputs)
+{
+    constexpr uint32_t m = 3;
+    constexpr uint32_t n = 4;
+    std::vector<float> dataC(m * n);
+    for (uint32_t i = 0; i < m * n; ++i) {
+        dataC[i] = static_cast<float>(i) - 5.0f;
+    }
+    std::vector<float> bias{1.0f, -1.0f, 0.5f, 2.0f};
+    std::vector<float> rowScale{2.0f, 1.0f, -1.0f};
+    std::vector<float> d(m * n, -100.0f);
+    std::vector<float> colSum(n, 0.0f);
+    std::vector<float> preActivation(m * n, -100.0f);
+
+    // D = relu(alpha * C * rowScale + bias), with the pre activation value and the column sums of D as well
+    using PreActivation = Store<3, float, Compute<OpAdd, Compute<OpMul, Compute<OpScale<0>, Acc>,
+        ColBroadcast<2, float>>, RowBroadcast<1, float>>>;
+    using Tree = Store<0, float, ColReduce<4, Compute<OpRelu, PreActivation>>>;
+
+    VisitorHostArguments args;
+    args.tensors[0] = d.data();
+    args.ld[0] = n;
+    args.tensors[1] = bias.data();
+    args.tensors[2] = rowScale.data();
+    args.tensors[3] = preActivation.data();
+    args.ld[3] = n;
+    args.tensors[4] = colSum.data();
+    args.scalars[0] = 0.5f;
+    EvaluateVisitorTree<Tree>(m, n, dataC, args);
+
+    std::vector<float> expectSum(n, 0.0f);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            float pre = 0.5f * dataC[i * n + j] * rowScale[i] + bias[j];
+            float expect = pre > 0.0f ? pre : 0.0f;
+            CHECK(Near(preActivation[i * n + j], pre));
+            CHECK(Near(d[i * n + j], expect));
+            expectSum[j] += expect;
+        }
+    }
+    for (uint32_t j = 0; j < n; ++j) {
+        CHECK(Near(colSum[j], expectSum[j]));
+    }
+}
+
+HOST_TEST(InterpreterHonoursLeadingDimension)
+{
+    // 2 x 2 output in a buffer with 3 columns, the padding column is left alone.
+    std::vector<float> dataC{1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> aux{10.0f, 20.0f, 0.0f, 30.0f, 40.0f, 0.0f};
+    std::vector<float> d(6, -1.0f);
+    VisitorHostArguments args;
+    args.tensors[0] = d.data();
+    args.ld[0] = 3;
+    args.tensors[3] = aux.data();
+    args.ld[3] = 3;
+    EvaluateVisitorTree<Store<0, float, Compute<OpSub, AuxLoad<3, float>, Acc>>>(2, 2, dataC, args);
+    CHECK_EQ(d[0], 9.0f);
+    CHECK_EQ(d[1], 18.0f);
+    CHECK_EQ(d[2], -1.0f);
+    CHECK_EQ(d[3], 27.0f);
+    CHECK_EQ(d[4], 36.0f);
+    CHECK_EQ(d[5], -1.0f);
+}
+
+HOST_TEST(TileAssignmentMatchesReference)
+{
+    std::vector<float> bias{0.25f, -0.5f};
+    std::vector<float> scale{1.5f, -2.0f};
+    std::vector<float> x{1.0f, 2.0f, 3.0f, 4.0f};
+    std::vector<float> y{0.5f, -1.0f, 2.5f, -3.0f};
+    VisitorHostArguments args;
+    args.tensors[1] = bias.data();
+    args.tensors[2] = scale.data();
+    args.tensors[3] = x.data();
+    args.ld[3] = 2;
+    args.tensors[4] = y.data();
+    args.ld[4] = 2;
+    args.scalars[1] = 0.75f;
+
+    // Non commutative ops on both sides of operands of different heights, and scratch clobbering activations.
+    using Deep = Compute<OpDiv, Compute<OpSub, Compute<OpSilu, Compute<OpAdd, X, Bias>>, Compute<OpMul, Y, Scale>>,
+        Compute<OpAddScalar<1>, Compute<OpAbs, Acc>>>;
+    using Mirrored = Compute<OpSub, Compute<OpGelu, Acc>,
+        Compute<OpMax, Compute<OpMin, X, Y>, Compute<OpFastGelu, Compute<OpMul, Acc, Bias>>>>;
+    using Wide = Compute<OpMul, Compute<OpAdd, Compute<OpSub, X, Acc>, Compute<OpMul, Y, Bias>>,
+        Compute<OpSub, Compute<OpAdd, Scale, Acc>, Compute<OpExp, Compute<OpMul, Compute<OpScale<1>, Y>, X>>>>;
+    CHECK(!VisitorTraits<Mirrored>::LHS_FIRST);
+    CHECK_EQ(VisitorTraits<Wide>::TILES, 4U);
+
+    for (uint32_t row = 0; row < 2; ++row) {
+        for (uint32_t col = 0; col < 2; ++col) {
+            float acc = 0.5f + static_cast<float>(row) - static_cast<float>(col);
+            CHECK(Near(Replay<Deep>(args, acc, row, col), HostVisitor<Deep>::Visit(args, acc, row, col)));
+            CHECK(Near(Replay<Mirrored>(args, acc, row, col), HostVisitor<Mirrored>::Visit(args, acc, row, col)));
+            CHECK(Near(Replay<Wide>(args, acc, row, col), HostVisitor<Wide>::Visit(args, acc, row, col)));
+        }
+    }
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
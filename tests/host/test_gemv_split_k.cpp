@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "catlass_host_macros.hpp"
+#include "test_common.hpp"
+#include "catlass/gemv/kernel/gemv_split_k_strategy.hpp"
+
+using Catlass::Gemv::Kernel::GemvSplitKPartition;
+
+namespace {
+constexpr uint32_t AIV_NUM = 48;
+// UB tiles of the float example: 32 x 512 for a row major A, 512 x 32 for a column major A.
+constexpr uint32_t ROW_TILE_M = 32;
+constexpr uint32_t ROW_K_ALIGN = 512;
+constexpr uint32_t COL_TILE_M = 512;
+constexpr uint32_t COL_K_ALIGN = 32;
+} // namespace
+
+HOST_TEST(WorkRangesCoverEveryItemOnceAndBalance)
+{
+    for (uint32_t coreNum = 1; coreNum <= 50; ++coreNum) {
+        for (uint32_t workNum = 0; workNum <= 300; workNum += 3) {
+            std::vector<uint32_t> owners(workNum, 0);
+            uint32_t minCount = workNum;
+            uint32_t maxCount = 0;
+            // Same walk as KernelGemvAivSplitK
+            for (uint32_t core = 0; core < coreNum; ++core) {
+                uint32_t start = GemvSplitKPartition::WorkStart(workNum, coreNum, core);
+                uint32_t end = GemvSplitKPartition::WorkStart(workNum, coreNum, core + 1);
+                CHECK(start <= end);
+                for (uint32_t w = start; w < end; ++w) {
+                    ++owners[w];
+                }
+                uint32_t count = end - start;
+                minCount = (count < minCount) ? count : minCount;
+                maxCount = (count > maxCount) ? count : maxCount;
+            }
+            CHECK_EQ(GemvSplitKPartition::WorkStart(workNum, coreNum, coreNum), workNum);
+            for (uint32_t w = 0; w < workNum; ++w) {
+                CHECK_EQ(owners[w], 1U);
+            }
+            CHECK(maxCount - minCount <= 1);
+        }
+    }
+}
+
+HOST_TEST(ChunksCoverTheReductionAxis)
+{
+    for (uint32_t n = 1; n <= 5000; n += 37) {
+        for (uint32_t splitK = 1; splitK <= 20; ++splitK) {
+            uint32_t chunkLength = GemvSplitKPartition::ChunkLength(n, splitK, COL_K_ALIGN);
+            uint32_t chunkNum = GemvSplitKPartition::ChunkNum(n, splitK, COL_K_ALIGN);
+            CHECK_EQ(chunkLength % COL_K_ALIGN, 0U);
+            CHECK(chunkNum >= 1);
+            CHECK(chunkNum <= splitK);
+            // Every chunk but the last is full, the last one is not empty.
+            CHECK((chunkNum - 1) * chunkLength < n);
+            CHECK(chunkNum * chunkLength >= n);
+        }
+    }
+}
+
+HOST_TEST(SelectedSplitKIsNormalized)
+{
+    for (uint32_t m = 1; m <= 4096; m *= 4) {
+        for (uint32_t n = 1; n <= 100000; n = n * 3 + 1) {
+            uint32_t rowSplitK = GemvSplitKPartition::SelectSplitK(m, n, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM);
+            uint32_t colSplitK = GemvSplitKPartition::SelectSplitK(m, n, COL_TILE_M, COL_K_ALIGN, AIV_NUM);
+            CHECK_EQ(GemvSplitKPartition::ChunkNum(n, rowSplitK, ROW_K_ALIGN), rowSplitK);
+            CHECK_EQ(GemvSplitKPartition::ChunkNum(n, colSplitK, COL_K_ALIGN), colSplitK);
+        }
+    }
+}
+
+HOST_TEST(FewRowsLongReductionSplits)
+{
+    // One row tile: without a split a single core would do all the work.
+    uint32_t splitK = GemvSplitKPartition::SelectSplitK(32, 65536, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM);
+    CHECK(splitK > AIV_NUM / 2);
+    CHECK(splitK <= AIV_NUM);
+    uint32_t colSplitK = GemvSplitKPartition::SelectSplitK(32, 65536, COL_TILE_M, COL_K_ALIGN, AIV_NUM);
+    CHECK_EQ(colSplitK, AIV_NUM);
+}
+
+HOST_TEST(ManyRowsDoNotSplit)
+{
+    // Four row tiles per core already balance, a split only adds atomic stores.
+    uint32_t m = AIV_NUM * ROW_TILE_M * 4;
+    CHECK_EQ(GemvSplitKPartition::SelectSplitK(m, 4096, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM), 1U);
+    CHECK_EQ(GemvSplitKPartition::SelectSplitK(4096, 512, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM), 1U);
+}
+
+HOST_TEST(ZeroBetaNeverReadsY)
+{
+    // The first chunk turns the input y already in y into βy, the others only add their partial results.
+    CHECK_EQ(GemvSplitKPartition::ChunkBeta(-1.5f, 0), -2.5f);
+    CHECK_EQ(GemvSplitKPartition::ChunkBeta(1.0f, 0), 0.0f);
+    CHECK_EQ(GemvSplitKPartition::ChunkBeta(-1.5f, 1), 0.0f);
+    // For β == 0 y starts at zero, no chunk reads it.
+    for (uint32_t chunkIdx = 0; chunkIdx < 4; ++chunkIdx) {
+        CHECK_EQ(GemvSplitKPartition::ChunkBeta(0.0f, chunkIdx), 0.0f);
+    }
+}
+
+HOST_TEST(SelectedCostNeverExceedsNoSplit)
+{
+    for (uint32_t m = 1; m <= 8192; m = m * 2 + 3) {
+        for (uint32_t n = 64; n <= 131072; n *= 2) {
+            uint32_t splitK = GemvSplitKPartition::SelectSplitK(m, n, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM);
+            CHECK(GemvSplitKPartition::Cost(m, n, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM, splitK) <=
+                GemvSplitKPartition::Cost(m, n, ROW_TILE_M, ROW_K_ALIGN, AIV_NUM, 1));
+        }
+    }
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/int4_matmul.hpp"
+
+using namespace Catlass;
+
+namespace {
+
+std::vector<int8_t> MakeInt4Values(size_t count, uint32_t seed)
+{
+    std::vector<int8_t> values(count);
+    for (size_t i = 0; i < count; ++i) {
+        values[i] = static_cast<int8_t>(static_cast<int32_t>((i * 7 + seed) % 16) - 8);
+    }
+    return values;
+}
+
+} // namespace
+
+HOST_TEST(Int4ColumnMajorPacksAlongK)
+{
+    // Row major k x n = 4 x 2: column 0 is {1, -2, 3, -8}, column 1 is {7, 0, -1, 5}.
+    std::vector<int8_t> quant{1, 7, -2, 0, 3, -1, -8, 5};
+    std::vector<int8_t> packed = golden::PackInt4ColumnMajor(4, 2, quant);
+    CHECK_EQ(packed.size(), static_cast<size_t>(4));
+    // Even k in the low nibble
+    CHECK_EQ(static_cast<uint8_t>(packed[0]), static_cast<uint8_t>(0xE1));
+    CHECK_EQ(static_cast<uint8_t>(packed[1]), static_cast<uint8_t>(0x83));
+    CHECK_EQ(static_cast<uint8_t>(packed[2]), static_cast<uint8_t>(0x07));
+    CHECK_EQ(static_cast<uint8_t>(packed[3]), static_cast<uint8_t>(0x5F));
+    CHECK(golden::UnpackInt4ColumnMajor(4, 2, packed) == quant);
+}
+
+HOST_TEST(Int4PackRoundTripsEveryValue)
+{
+    uint32_t k = 64;
+    uint32_t n = 3;
+    std::vector<int8_t> quant = MakeInt4Values(static_cast<size_t>(k) * n, 5);
+    CHECK(golden::UnpackInt4ColumnMajor(k, n, golden::PackInt4ColumnMajor(k, n, quant)) == quant);
+    CHECK(golden::UnpackInt4(n, k, golden::PackInt4(n, k, quant)) == quant);
+}
+
+HOST_TEST(Int4MatmulMatchesUnpackedReference)
+{
+    uint32_t m = 5;
+    uint32_t n = 7;
+    uint32_t k = 130;
+    std::vector<int8_t> a = MakeInt4Values(static_cast<size_t>(m) * k, 3);
+    std::vector<int8_t> b = MakeInt4Values(static_cast<size_t>(k) * n, 11);
+
+    std::vector<int32_t> golden;
+    golden::ComputeMatmulInt4(m, n, k, golden::PackInt4(m, k, a), golden::PackInt4ColumnMajor(k, n, b), golden);
+
+    std::vector<int32_t> expected;
+    golden::ComputeMatmulInt32Accumulate(m, n, k, a, b, expected);
+    CHECK(golden == expected);
+    // Every product is at most 64, so the full range of int4 accumulates exactly.
+    std::vector<int8_t> minA(static_cast<size_t>(m) * k, -8);
+    std::vector<int8_t> minB(static_cast<size_t>(k) * n, -8);
+    golden::ComputeMatmulInt4(m, n, k, golden::PackInt4(m, k, minA), golden::PackInt4ColumnMajor(k, n, minB), golden);
+    CHECK_EQ(golden[0], static_cast<int32_t>(64 * k));
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
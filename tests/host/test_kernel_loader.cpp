@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "test_common.hpp"
+#include "loader/kernel_group_loader.hpp"
+
+using namespace CatlassKernel::Loader;
+
+namespace {
+int RunBasic(int x)
+{
+    return x + 1;
+}
+
+int RunGrouped(int x)
+{
+    return x + 2;
+}
+
+int RunOptimized(int x)
+{
+    return x + 3;
+}
+
+using RunFunc = int (*)(int);
+
+KernelEntry const *BasicEntries(size_t *entryNum)
+{
+    static const KernelEntry ENTRIES[] = {{"BasicMatmul", reinterpret_cast<void *>(&RunBasic)}};
+    *entryNum = 1;
+    return ENTRIES;
+}
+
+KernelEntry const *GroupedEntries(size_t *entryNum)
+{
+    static const KernelEntry ENTRIES[] = {{"GroupedMatmul", reinterpret_cast<void *>(&RunGrouped)}};
+    *entryNum = 1;
+    return ENTRIES;
+}
+
+KernelEntry const *OptimizedEntries(size_t *entryNum)
+{
+    static const KernelEntry ENTRIES[] = {{"OptimizedMatmul", reinterpret_cast<void *>(&RunOptimized)},
+        {"ClearOptimizedMatmulPlans", reinterpret_cast<void *>(&RunOptimized)}};
+    *entryNum = 2;
+    return ENTRIES;
+}
+
+// Stub of dlopen/dlsym. Opening a library sleeps for the time the runtime would spend registering its kernels.
+struct StubRuntime {
+    std::map<std::string, std::map<std::string, void *>> libraries = {
+        {"libbasic.so", {{KernelGroupSymbol("basic"), reinterpret_cast<void *>(&BasicEntries)}}},
+        {"libgrouped.so", {{KernelGroupSymbol("grouped"), reinterpret_cast<void *>(&GroupedEntries)}}},
+        {"liboptimized.so", {{KernelGroupSymbol("optimized"), reinterpret_cast<void *>(&OptimizedEntries)}}},
+    };
+    std::chrono::milliseconds registerTime{0};
+    std::atomic<int> openCount{0};
+    std::atomic<int> closeCount{0};
+    std::map<std::string, int> opened;
+    std::mutex mutex;
+
+    KernelGroupLoader MakeLoader()
+    {
+        return KernelGroupLoader(
+            [this](std::string const &library) -> void * {
+                ++openCount;
+                std::this_thread::sleep_for(registerTime);
+                std::lock_guard<std::mutex> lock(mutex);
+                ++opened[library];
+                auto it = libraries.find(library);
+                return (it == libraries.end()) ? nullptr : &it->second;
+            },
+            [](void *handle, std::string const &symbol) -> void * {
+                auto &symbols = *static_cast<std::map<std::string, void *> *>(handle);
+                auto it = symbols.find(symbol);
+                return (it == symbols.end()) ? nullptr : it->second;
+            },
+            [this](void *) { ++closeCount; });
+    }
+};
+
+void AddGroups(KernelGroupLoader &loader)
+{
+    loader.AddGroup("basic", "libbasic.so", {"BasicMatmul"});
+    loader.AddGroup("grouped", "libgrouped.so", {"GroupedMatmul"});
+    loader.AddGroup("optimized", "liboptimized.so", {"OptimizedMatmul", "ClearOptimizedMatmulPlans"});
+}
+
+int Call(void *entry, int x)
+{
+    return reinterpret_cast<RunFunc>(entry)(x);
+}
+
+double ElapsedMs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+} // namespace
+
+HOST_TEST(NothingIsLoadedAtStartup)
+{
+    StubRuntime runtime;
+    {
+        KernelGroupLoader loader = runtime.MakeLoader();
+        AddGroups(loader);
+        CHECK_EQ(runtime.openCount.load(), 0);
+        CHECK(loader.LoadedGroups().empty());
+        CHECK_EQ(loader.Groups(), (std::vector<std::string>{"basic", "grouped", "optimized"}));
+    }
+    CHECK_EQ(runtime.closeCount.load(), 0);
+}
+
+HOST_TEST(FirstDispatchLoadsOnlyItsGroup)
+{
+    StubRuntime runtime;
+    KernelGroupLoader loader = runtime.MakeLoader();
+    AddGroups(loader);
+
+    void *entry = loader.Find("GroupedMatmul");
+    CHECK(entry != nullptr);
+    CHECK_EQ(Call(entry, 10), 12);
+    CHECK_EQ(loader.LoadedGroups(), std::vector<std::string>{"grouped"});
+    CHECK_EQ(loader.Find("GroupedMatmul"), entry);
+    CHECK_EQ(runtime.openCount.load(), 1);
+
+    // Looking up without loading leaves the other groups alone.
+    CHECK(loader.FindLoaded("ClearOptimizedMatmulPlans") == nullptr);
+    CHECK(!loader.IsLoaded("optimized"));
+    CHECK(loader.Find("Unknown") == nullptr);
+    CHECK_EQ(runtime.openCount.load(), 1);
+}
+
+HOST_TEST(ConcurrentFirstDispatchLoadsOnce)
+{
+    StubRuntime runtime;
+    runtime.registerTime = std::chrono::milliseconds(20);
+    KernelGroupLoader loader = runtime.MakeLoader();
+    AddGroups(loader);
+
+    constexpr int THREAD_NUM = 16;
+    std::atomic<int> results{0};
+    std::vector<std::thread> threads;
+    for (int i = 0; i < THREAD_NUM; ++i) {
+        threads.emplace_back([&]() {
+            void *entry = loader.Find("BasicMatmul");
+            if (entry != nullptr && Call(entry, 0) == 1) {
+                ++results;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    CHECK_EQ(results.load(), THREAD_NUM);
+    CHECK_EQ(runtime.opened["libbasic.so"], 1);
+    CHECK_EQ(runtime.openCount.load(), 1);
+}
+
+HOST_TEST(PreloadWarmStart)
+{
+    StubRuntime runtime;
+    KernelGroupLoader loader = runtime.MakeLoader();
+    AddGroups(loader);
+
+    CHECK_EQ(loader.Preload({"optimized"}), 1U);
+    CHECK(loader.FindLoaded("ClearOptimizedMatmulPlans") != nullptr);
+    CHECK_EQ(loader.Preload(), 3U);
+    CHECK_EQ(runtime.openCount.load(), 3);
+    CHECK(loader.Find("BasicMatmul") != nullptr);
+    CHECK(loader.Find("OptimizedMatmul") != nullptr);
+    CHECK_EQ(runtime.openCount.load(), 3);
+    CHECK_EQ(loader.Preload({"missing"}), 0U);
+}
+
+HOST_TEST(FailedGroupIsNotRetried)
+{
+    StubRuntime runtime;
+    // The library exists but lacks a declared entry.
+    runtime.libraries["libbroken.so"] = {{KernelGroupSymbol("broken"), reinterpret_cast<void *>(&BasicEntries)}};
+    {
+        KernelGroupLoader loader = runtime.MakeLoader();
+        CHECK(loader.AddGroup("absent", "libabsent.so", {"Absent"}));
+        CHECK(loader.AddGroup("broken", "libbroken.so", {"BasicMatmul", "Missing"}));
+        CHECK(!loader.AddGroup("broken", "libother.so", {"Other"}));
+        CHECK(!loader.AddGroup("other", "libother.so", {"Absent"}));
+
+        CHECK(loader.Find("Absent") == nullptr);
+        CHECK(loader.Find("Absent") == nullptr);
+        CHECK_EQ(runtime.opened["libabsent.so"], 1);
+
+        CHECK(loader.Find("BasicMatmul") == nullptr);
+        CHECK(!loader.IsLoaded("broken"));
+        CHECK_EQ(runtime.closeCount.load(), 1);
+        CHECK(!loader.Load("broken"));
+        CHECK_EQ(runtime.opened["libbroken.so"], 1);
+    }
+    CHECK_EQ(runtime.closeCount.load(), 1);
+}
+
+HOST_TEST(LazyLoadCutsStartupTime)
+{
+    StubRuntime runtime;
+    runtime.registerTime = std::chrono::milliseconds(20);
+
+    // Eager: every group registered before the first call, as a library that links all kernels does.
+    auto start = std::chrono::steady_clock::now();
+    KernelGroupLoader eager = runtime.MakeLoader();
+    AddGroups(eager);
+    eager.Preload();
+    CHECK_EQ(Call(eager.Find("BasicMatmul"), 1), 2);
+    double eagerMs = ElapsedMs(start);
+
+    // Lazy: startup registers nothing, the first call pays for its own group only.
+    start = std::chrono::steady_clock::now();
+    KernelGroupLoader lazy = runtime.MakeLoader();
+    AddGroups(lazy);
+    double startupMs = ElapsedMs(start);
+    CHECK_EQ(Call(lazy.Find("BasicMatmul"), 1), 2);
+    double lazyMs = ElapsedMs(start);
+
+    std::printf("  startup %.2f ms, first call lazy %.2f ms, eager %.2f ms\n", startupMs, lazyMs, eagerMs);
+    CHECK(startupMs < 20.0);
+    CHECK(lazyMs < eagerMs);
+    CHECK_EQ(runtime.openCount.load(), 4);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
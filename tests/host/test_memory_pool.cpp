@@ -0,0 +1,203 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <map>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include "test_common.hpp"
+#include "memory/stream_memory_pool.hpp"
+
+using namespace CatlassKernel::Memory;
+
+namespace {
+constexpr uint64_t STREAM_A = 1;
+constexpr uint64_t STREAM_B = 2;
+
+// Mock runtime: a device with a fixed capacity that hands out distinct addresses.
+struct MockRuntime {
+    size_t capacity{SIZE_MAX};
+    size_t used{0};
+    uintptr_t next{0x10000};
+    std::map<void *, size_t> live;
+    std::vector<uint64_t> syncs;
+    size_t mallocs{0};
+    std::mutex mutex;
+
+    StreamMemoryPool MakePool()
+    {
+        return StreamMemoryPool(
+            [this](size_t size) -> void * {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (used + size > capacity) {
+                    return nullptr;
+                }
+                ++mallocs;
+                used += size;
+                void *ptr = reinterpret_cast<void *>(next);
+                next += size;
+                live[ptr] = size;
+                return ptr;
+            },
+            [this](void *ptr) {
+                std::lock_guard<std::mutex> lock(mutex);
+                used -= live.at(ptr);
+                live.erase(ptr);
+            },
+            [this](uint64_t stream) {
+                std::lock_guard<std::mutex> lock(mutex);
+                syncs.push_back(stream);
+            });
+    }
+};
+} // namespace
+
+HOST_TEST(SizeClasses)
+{
+    CHECK_EQ(PoolSizeClass(1), 512U);
+    CHECK_EQ(PoolSizeClass(512), 512U);
+    CHECK_EQ(PoolSizeClass(513), 1024U);
+    CHECK_EQ(PoolSizeClass(3000), 4096U);
+    CHECK_EQ(PoolSizeClass(1024 * 1024), 1024U * 1024U);
+    CHECK_EQ(PoolSizeClass(1024 * 1024 + 1), 2U * 1024U * 1024U);
+    CHECK_EQ(PoolSizeClass(5 * 1024 * 1024), 6U * 1024U * 1024U);
+}
+
+HOST_TEST(FreedBlockIsReusedOnItsStreamOnly)
+{
+    MockRuntime runtime;
+    StreamMemoryPool pool = runtime.MakePool();
+
+    void *first = pool.Allocate(1000, STREAM_A);
+    CHECK(first != nullptr);
+    CHECK(pool.Free(first));
+    // Same stream and size class: reused without touching the device or waiting for it.
+    CHECK_EQ(pool.Allocate(900, STREAM_A), first);
+    CHECK(pool.Free(first));
+    // Another stream could still race with the launches of STREAM_A, it gets a new block.
+    void *other = pool.Allocate(1000, STREAM_B);
+    CHECK(other != first);
+    // Another size class does not reuse it either.
+    void *larger = pool.Allocate(4000, STREAM_A);
+    CHECK(larger != first);
+
+    CHECK_EQ(runtime.mallocs, 3U);
+    CHECK(runtime.syncs.empty());
+    StreamMemoryPoolStats stats = pool.Stats();
+    CHECK_EQ(stats.reuses, 1U);
+    CHECK_EQ(stats.deviceAllocs, 3U);
+    CHECK_EQ(stats.allocatedBytes, 1024U + 4096U);
+    CHECK_EQ(stats.cachedBytes, 1024U);
+}
+
+HOST_TEST(FreeRejectsForeignPointers)
+{
+    MockRuntime runtime;
+    StreamMemoryPool pool = runtime.MakePool();
+    int local = 0;
+    CHECK(!pool.Free(&local));
+    CHECK(pool.Free(nullptr));
+    CHECK(pool.Allocate(0, STREAM_A) == nullptr);
+    void *ptr = pool.Allocate(64, STREAM_A);
+    CHECK(pool.Free(ptr));
+    CHECK(!pool.Free(ptr));
+}
+
+HOST_TEST(ReleaseSynchronizesStreamsOfCachedBlocks)
+{
+    MockRuntime runtime;
+    StreamMemoryPool pool = runtime.MakePool();
+    void *a0 = pool.Allocate(512, STREAM_A);
+    void *a1 = pool.Allocate(4096, STREAM_A);
+    void *b0 = pool.Allocate(512, STREAM_B);
+    void *inUse = pool.Allocate(512, STREAM_B);
+    pool.Free(a0);
+    pool.Free(a1);
+    pool.Free(b0);
+
+    pool.ReleaseStream(STREAM_A);
+    CHECK_EQ(runtime.syncs, std::vector<uint64_t>{STREAM_A});
+    CHECK_EQ(runtime.live.size(), 2U);
+    CHECK_EQ(pool.Stats().cachedBytes, 512U);
+
+    pool.Release();
+    CHECK_EQ(runtime.syncs, (std::vector<uint64_t>{STREAM_A, STREAM_B}));
+    CHECK_EQ(runtime.live.size(), 1U);
+    CHECK(runtime.live.count(inUse) == 1);
+    CHECK_EQ(pool.Stats().cachedBytes, 0U);
+    CHECK_EQ(pool.Stats().deviceFrees, 3U);
+
+    // Nothing cached, nothing to wait for.
+    pool.Release();
+    CHECK_EQ(runtime.syncs.size(), 2U);
+}
+
+HOST_TEST(OutOfMemoryReleasesCacheAndRetries)
+{
+    MockRuntime runtime;
+    runtime.capacity = 8192;
+    StreamMemoryPool pool = runtime.MakePool();
+    void *a = pool.Allocate(4096, STREAM_A);
+    void *b = pool.Allocate(4096, STREAM_B);
+    pool.Free(a);
+    pool.Free(b);
+
+    // A larger class does not fit next to the cached blocks, they are given back first.
+    void *large = pool.Allocate(8192, STREAM_A);
+    CHECK(large != nullptr);
+    CHECK_EQ(runtime.syncs.size(), 2U);
+    CHECK_EQ(pool.Stats().cachedBytes, 0U);
+
+    // Still too large with an empty cache.
+    CHECK(pool.Allocate(16384, STREAM_A) == nullptr);
+    CHECK_EQ(runtime.syncs.size(), 2U);
+}
+
+HOST_TEST(ConcurrentStreamsNeverShareABlock)
+{
+    MockRuntime runtime;
+    StreamMemoryPool pool = runtime.MakePool();
+    std::mutex liveMutex;
+    std::set<void *> live;
+    bool shared = false;
+
+    std::vector<std::thread> threads;
+    for (uint64_t stream = 1; stream <= 4; ++stream) {
+        threads.emplace_back([&, stream]() {
+            for (int i = 0; i < 500; ++i) {
+                size_t size = 256U << (i % 6);
+                void *ptr = pool.Allocate(size, stream);
+                {
+                    std::lock_guard<std::mutex> lock(liveMutex);
+                    shared = shared || !live.insert(ptr).second;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(liveMutex);
+                    live.erase(ptr);
+                }
+                pool.Free(ptr);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    CHECK(!shared);
+    // Each stream needs at most one block per size class.
+    CHECK(runtime.mallocs <= 4U * 6U);
+    CHECK_EQ(pool.Stats().allocatedBytes, 0U);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/mixed_precision.hpp"
+
+using namespace Catlass;
+
+HOST_TEST(RoundToHalfTiesToEven)
+{
+    CHECK_EQ(golden::RoundToHalf(1.0f), 1.0f);
+    // Half way between 1 and the next fp16, 1 + 2^-10
+    CHECK_EQ(golden::RoundToHalf(1.0f + std::ldexp(1.0f, -11)), 1.0f);
+    CHECK_EQ(golden::RoundToHalf(1.0f + 3.0f * std::ldexp(1.0f, -11)), 1.0f + std::ldexp(1.0f, -9));
+    CHECK_EQ(golden::RoundToHalf(-1.0f - 3.0f * std::ldexp(1.0f, -11)), -1.0f - std::ldexp(1.0f, -9));
+    CHECK_EQ(golden::RoundToHalf(65504.0f), 65504.0f);
+    CHECK_EQ(golden::RoundToHalf(65519.0f), 65504.0f);
+    CHECK(std::isinf(golden::RoundToHalf(65520.0f)));
+    // Subnormals, in steps of 2^-24
+    CHECK_EQ(golden::RoundToHalf(std::ldexp(1.0f, -25)), 0.0f);
+    CHECK_EQ(golden::RoundToHalf(3.0f * std::ldexp(1.0f, -25)), std::ldexp(1.0f, -23));
+    CHECK_EQ(golden::RoundToHalf(std::ldexp(1.0f, -14) + std::ldexp(1.0f, -26)), std::ldexp(1.0f, -14));
+}
+
+HOST_TEST(RoundToBfloat16TiesToEven)
+{
+    CHECK_EQ(golden::RoundToBfloat16(1.0f + std::ldexp(1.0f, -8)), 1.0f);
+    CHECK_EQ(golden::RoundToBfloat16(1.0f + 3.0f * std::ldexp(1.0f, -8)), 1.0f + std::ldexp(1.0f, -6));
+    CHECK_EQ(golden::RoundToBfloat16(-3.0f), -3.0f);
+    CHECK(std::isinf(golden::RoundToBfloat16(3.4e38f)));
+    CHECK(std::isnan(golden::RoundToBfloat16(NAN)));
+}
+
+HOST_TEST(FixpipeCastRoundsTheFp32Accumulator)
+{
+    uint32_t m = 3;
+    uint32_t n = 5;
+    uint32_t k = 40;
+    std::vector<float> a = HostTest::MakeData(static_cast<size_t>(m) * k, 0.0f, 3.0f, 1);
+    std::vector<float> b = HostTest::MakeData(static_cast<size_t>(k) * n, 0.0f, 1.0f, 2);
+    // fp16 operands
+    for (auto &value : a) {
+        value = golden::RoundToHalf(value);
+    }
+    for (auto &value : b) {
+        value = golden::RoundToHalf(value);
+    }
+    std::vector<float> accumulator;
+    golden::ComputeMatmulFp32Accumulate(m, n, k, a, b, golden::FixpipeCast::NO_CAST, accumulator);
+    std::vector<float> outHalf;
+    golden::ComputeMatmulFp32Accumulate(m, n, k, a, b, golden::FixpipeCast::F322F16, outHalf);
+    std::vector<float> outBfloat16;
+    golden::ComputeMatmulFp32Accumulate(m, n, k, a, b, golden::FixpipeCast::F322BF16, outBfloat16);
+    for (size_t i = 0; i < accumulator.size(); ++i) {
+        // The output is rounded once, from the fp32 accumulator
+        CHECK_EQ(outHalf[i], golden::RoundToHalf(accumulator[i]));
+        CHECK_EQ(outBfloat16[i], golden::RoundToBfloat16(accumulator[i]));
+        CHECK(std::fabs(outHalf[i] - accumulator[i]) <= std::fabs(accumulator[i]) * std::ldexp(1.0f, -11));
+        CHECK(std::fabs(outBfloat16[i] - accumulator[i]) <= std::fabs(accumulator[i]) * std::ldexp(1.0f, -8));
+    }
+}
+
+HOST_TEST(Int32AccumulationIsExact)
+{
+    uint32_t k = 1024;
+    // Extreme int8 and int4 values, whose int32 sums exceed the fp32 mantissa
+    std::vector<int8_t> a(k, -128);
+    std::vector<int8_t> b(k, -128);
+    a[0] = 127;
+    std::vector<int32_t> golden;
+    golden::ComputeMatmulInt32Accumulate(1, 1, k, a, b, golden);
+    CHECK_EQ(golden[0], 127 * -128 + 1023 * 16384);
+
+    std::vector<int8_t> a4(k, -8);
+    std::vector<int8_t> b4(k, 7);
+    golden::ComputeMatmulInt32Accumulate(1, 1, k, a4, b4, golden);
+    CHECK_EQ(golden[0], -56 * 1024);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
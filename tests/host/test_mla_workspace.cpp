@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <map>
+#include <vector>
+
+#include "test_common.hpp"
+#include "mla_workspace.hpp"
+
+using namespace MLAWorkspace;
+
+namespace {
+// The buffers are laid out back to back without sharing bytes.
+bool IsExactConcatenation(MLAWorkspaceLayout const &layout)
+{
+    uint64_t end = 0;
+    for (uint32_t id = 0; id < BUFFER_NUM; ++id) {
+        if (layout.offsets[id] % BUFFER_ALIGN != 0 || layout.offsets[id] < end) {
+            return false;
+        }
+        end = layout.offsets[id] + layout.sizes[id];
+    }
+    return end <= layout.size && layout.size == AlignUp(end);
+}
+
+// The kernels address core coreIdx at coreIdx * stride elements and use up to stride elements from there.
+bool CoversEveryCore(uint64_t size, uint32_t blockDim, uint32_t stride, uint64_t elementBytes)
+{
+    for (uint32_t coreIdx = 0; coreIdx < blockDim; ++coreIdx) {
+        uint64_t end = (static_cast<uint64_t>(coreIdx) * stride + stride) * elementBytes;
+        if (end > size) {
+            return false;
+        }
+    }
+    return true;
+}
+
+MLAWorkspaceParams MakeParams(uint32_t numTokens, uint32_t numHeads, uint32_t kvSplitCoreNum)
+{
+    MLAWorkspaceParams params;
+    params.blockDim = 24;
+    params.numTokens = numTokens;
+    params.numHeads = numHeads;
+    params.embeddingSize = 512;
+    params.kvSplitCoreNum = kvSplitCoreNum;
+    params.tp1Spec = (numHeads == 128);
+    return params;
+}
+
+struct MockDevice {
+    std::map<uint8_t *, std::vector<uint8_t>> blocks;
+    size_t allocs{0};
+    size_t frees{0};
+
+    WorkspacePlan MakePlan()
+    {
+        return WorkspacePlan(
+            [this](uint64_t size) {
+                ++allocs;
+                std::vector<uint8_t> block(size);
+                uint8_t *ptr = block.data();
+                blocks[ptr] = std::move(block);
+                return ptr;
+            },
+            [this](uint8_t *ptr) {
+                ++frees;
+                blocks.erase(ptr);
+            });
+    }
+};
+} // namespace
+
+HOST_TEST(MlaLayoutIsExactConcatenation)
+{
+    for (uint32_t numHeads : {16u, 32u, 64u, 128u}) {
+        for (uint32_t kvSplitCoreNum : {1u, 3u, 24u}) {
+            for (uint32_t numTokens : {1u, 7u, 96u}) {
+                CHECK(IsExactConcatenation(MakeWorkspaceLayout(MakeParams(numTokens, numHeads, kvSplitCoreNum))));
+            }
+        }
+    }
+}
+
+HOST_TEST(MlaBuffersCoverEveryCoreStride)
+{
+    constexpr uint64_t FLOAT_BYTES = 4;
+    constexpr uint64_t HALF_BYTES = 2;
+    for (uint32_t blockDim : {1u, 20u, 24u}) {
+        for (uint32_t numHeads : {16u, 128u}) {
+            MLAWorkspaceParams params = MakeParams(8, numHeads, 3);
+            params.blockDim = blockDim;
+            MLAWorkspaceLayout layout = MakeWorkspaceLayout(params);
+            uint32_t sStride = params.tp1Spec ? S_CORE_STRIDE_TP1 : S_CORE_STRIDE;
+            uint32_t pStride = params.tp1Spec ? P_CORE_STRIDE_TP1 : P_CORE_STRIDE;
+            CHECK(CoversEveryCore(layout.sizes[S], blockDim, sStride, FLOAT_BYTES));
+            CHECK(CoversEveryCore(layout.sizes[P], blockDim, pStride, HALF_BYTES));
+            CHECK(CoversEveryCore(layout.sizes[O_TMP], blockDim, O_TMP_CORE_STRIDE, FLOAT_BYTES));
+            CHECK(CoversEveryCore(layout.sizes[O_UPDATE], blockDim, O_UPDATE_CORE_STRIDE, FLOAT_BYTES));
+            // Flash decoding reads one row of embeddingSize per token, head and kv split.
+            uint64_t rows = uint64_t{8} * numHeads * 3;
+            CHECK(layout.sizes[O_CORE_TMP] >= rows * params.embeddingSize * FLOAT_BYTES);
+            CHECK(layout.sizes[L] >= rows * FLOAT_BYTES);
+        }
+    }
+    // One core short of the kernel stride is caught.
+    CHECK(!CoversEveryCore(uint64_t{23} * S_CORE_STRIDE * FLOAT_BYTES, 24, S_CORE_STRIDE, FLOAT_BYTES));
+}
+
+HOST_TEST(MlaLayoutUsesExactSizes)
+{
+    // Common kernel without kv split: one s and one p tile per core, no flash decoding buffers.
+    MLAWorkspaceLayout common = MakeWorkspaceLayout(MakeParams(64, 16, 1));
+    CHECK_EQ(common.sizes[S], uint64_t{24} * 32768 * 4);
+    CHECK_EQ(common.sizes[P], uint64_t{24} * 65536 * 2);
+    CHECK_EQ(common.sizes[O_TMP], uint64_t{24} * 65536 * 8);
+    CHECK_EQ(common.sizes[O_UPDATE], uint64_t{24} * 65536 * 4);
+    CHECK_EQ(common.sizes[O_CORE_TMP], uint64_t{0});
+    CHECK_EQ(common.sizes[L], uint64_t{0});
+    CHECK_EQ(common.size, uint64_t{24} * (131072 + 131072 + 524288 + 262144));
+
+    MLAWorkspaceLayout spec = MakeWorkspaceLayout(MakeParams(4, 128, 6));
+    CHECK_EQ(spec.sizes[S], uint64_t{24} * 32768 * 16);
+    CHECK_EQ(spec.sizes[P], uint64_t{24} * 65536 * 4);
+    CHECK_EQ(spec.sizes[O_CORE_TMP], uint64_t{4} * 128 * 6 * 512 * 4);
+    CHECK_EQ(spec.sizes[L], uint64_t{4} * 128 * 6 * 4);
+
+    // The previous fixed allocation: 2 * 65536 elements of s, p and oTmp and 65536 of oUpdate per core.
+    uint64_t fixed = uint64_t{24} * 65536 * (8 + 4 + 8 + 4);
+    CHECK(common.size < fixed);
+}
+
+HOST_TEST(PlanReusesArenaAcrossDecodeSteps)
+{
+    MockDevice device;
+    {
+        WorkspacePlan plan = device.MakePlan();
+        CHECK(plan.Prepare(MakeParams(8, 16, 3)));
+        uint8_t *s = plan.Buffer(S);
+        uint64_t capacity = plan.Capacity();
+        CHECK_EQ(device.allocs, size_t{1});
+
+        // Same step again, and a step that needs less: no allocation, same addresses.
+        CHECK(plan.Prepare(MakeParams(8, 16, 3)));
+        CHECK(plan.Prepare(MakeParams(8, 16, 1)));
+        CHECK_EQ(device.allocs, size_t{1});
+        CHECK_EQ(plan.Capacity(), capacity);
+        CHECK(plan.Buffer(S) == s);
+        CHECK(plan.Layout().size < capacity);
+
+        // A longer sequence splits over more cores and grows the arena once.
+        CHECK(plan.Prepare(MakeParams(8, 16, 12)));
+        CHECK_EQ(device.allocs, size_t{2});
+        CHECK_EQ(device.frees, size_t{1});
+        CHECK(plan.Prepare(MakeParams(8, 16, 3)));
+        CHECK_EQ(device.allocs, size_t{2});
+        CHECK(plan.Layout().size <= plan.Capacity());
+    }
+    CHECK_EQ(device.frees, size_t{2});
+    CHECK(device.blocks.empty());
+}
+
+HOST_TEST(PlanReportsAllocationFailure)
+{
+    WorkspacePlan plan([](uint64_t) -> uint8_t * { return nullptr; }, [](uint8_t *) {});
+    CHECK(!plan.Prepare(MakeParams(1, 16, 1)));
+    CHECK_EQ(plan.Capacity(), uint64_t{0});
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
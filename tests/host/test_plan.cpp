@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "catlass_host_macros.hpp"
+#include "test_common.hpp"
+#include "plan/lru_cache.hpp"
+#include "plan/optimized_matmul_plan.hpp"
+
+using namespace CatlassKernel::Plan;
+
+namespace {
+constexpr uint32_t BF16_BYTES = 2;
+
+// Fake device memory: hands out distinct addresses and records what is still alive.
+struct FakeDevice {
+    std::map<uint8_t *, size_t> live;
+    std::vector<uint64_t> syncedStreams;
+    size_t allocCount{0};
+    uintptr_t next{0x1000};
+    bool failAlloc{false};
+
+    OptimizedMatmulPlanCache MakeCache(size_t capacity)
+    {
+        return OptimizedMatmulPlanCache(capacity,
+            [this](OptimizedMatmulPlanKey const &, size_t size) -> uint8_t * {
+                if (failAlloc) {
+                    return nullptr;
+                }
+                ++allocCount;
+                auto *ptr = reinterpret_cast<uint8_t *>(next);
+                next += RoundUpSize(size, WORKSPACE_ALIGN_BYTE);
+                live[ptr] = size;
+                return ptr;
+            },
+            [this](OptimizedMatmulPlanKey const &key, OptimizedMatmulPlan const &plan) {
+                syncedStreams.push_back(key.stream);
+                live.erase(plan.workspace);
+            });
+    }
+};
+
+OptimizedMatmulPlanKey MakeKey(uint32_t m, uint32_t n, uint32_t k, uint64_t stream = 1)
+{
+    return OptimizedMatmulPlanKey{m, n, k, 27, false, false, stream};
+}
+} // namespace
+
+HOST_TEST(LruEvictsLeastRecentlyUsed)
+{
+    std::vector<std::string> evicted;
+    LruCache<int, std::string> cache(2, [&](int const &, std::string &value) { evicted.push_back(value); });
+    cache.Insert(1, "a");
+    cache.Insert(2, "b");
+    CHECK(cache.Find(1) != nullptr);
+    cache.Insert(3, "c");
+    CHECK(cache.Find(2) == nullptr);
+    CHECK(cache.Find(1) != nullptr);
+    CHECK_EQ(evicted, std::vector<std::string>{"b"});
+    cache.Insert(1, "a2");
+    CHECK_EQ(*cache.Find(1), "a2");
+    CHECK_EQ(cache.Size(), 2U);
+    cache.Clear();
+    CHECK_EQ(evicted, (std::vector<std::string>{"b", "a", "a2", "c"}));
+    CHECK_EQ(cache.Size(), 0U);
+}
+
+HOST_TEST(PlanPaddingDecisions)
+{
+    // aligned strides need no workspace
+    auto plan = MakeOptimizedMatmulPlan(MakeKey(1024, 1024, 1024), BF16_BYTES);
+    CHECK(!plan.paddingA && !plan.paddingB);
+    CHECK_EQ(plan.WorkspaceSize(), 0U);
+    CHECK_EQ(plan.KernelIdx(), 0U);
+
+    // k = 1000 is not 256 element aligned: with two N tiles A is cheaper to read in place
+    plan = MakeOptimizedMatmulPlan(MakeKey(100, 512, 1000), BF16_BYTES);
+    CHECK(!plan.paddingA && !plan.paddingB);
+    CHECK_EQ(plan.WorkspaceSize(), 0U);
+
+    // with four N tiles the prologue pays off
+    plan = MakeOptimizedMatmulPlan(MakeKey(100, 1024, 1000), BF16_BYTES);
+    CHECK(plan.paddingA && !plan.paddingB);
+    CHECK_EQ(plan.sizeWA, 128U * 1024 * BF16_BYTES);
+    CHECK_EQ(plan.KernelIdx(), 2U);
+
+    // huge aligned stride is read in place with the interval copy, unless its tiles are loaded often
+    plan = MakeOptimizedMatmulPlan(MakeKey(128, 65536, 256), BF16_BYTES);
+    CHECK(!plan.paddingA && !plan.paddingB);
+    plan = MakeOptimizedMatmulPlan(MakeKey(1024, 65536, 256), BF16_BYTES);
+    CHECK(!plan.paddingA && plan.paddingB);
+    CHECK_EQ(plan.OffsetWB(), 0U);
+    CHECK_EQ(plan.WorkspaceSize(), plan.sizeWB);
+
+    plan = MakeOptimizedMatmulPlan(MakeKey(1000, 1000, 1000), BF16_BYTES);
+    CHECK(plan.paddingA && plan.paddingB);
+    CHECK_EQ(plan.OffsetWB() % WORKSPACE_ALIGN_BYTE, 0U);
+    CHECK(plan.OffsetWB() >= plan.sizeWA);
+    CHECK_EQ(plan.WorkspaceSize(), plan.OffsetWB() + plan.sizeWB);
+
+    // column major A and B use the 256x128 tile and their strides are m and k
+    OptimizedMatmulPlanKey key{300, 512, 512, 27, true, true, 1};
+    plan = MakeOptimizedMatmulPlan(key, BF16_BYTES);
+    CHECK_EQ(plan.l1M, 256U);
+    CHECK_EQ(plan.l1N, 128U);
+    CHECK(plan.paddingA && !plan.paddingB);
+}
+
+HOST_TEST(RepeatedShapeReusesWorkspace)
+{
+    FakeDevice device;
+    auto cache = device.MakeCache(4);
+    std::vector<uint8_t *> workspaces;
+    auto launch = [&](OptimizedMatmulPlan const &plan) { workspaces.push_back(plan.workspace); };
+    for (int i = 0; i < 5; ++i) {
+        CHECK(cache.Execute(MakeKey(1000, 1000, 1000), BF16_BYTES, launch));
+    }
+    CHECK_EQ(device.allocCount, 1U);
+    CHECK_EQ(cache.Misses(), 1U);
+    CHECK_EQ(cache.Hits(), 4U);
+    CHECK(device.syncedStreams.empty());
+    for (auto *workspace : workspaces) {
+        CHECK(workspace == workspaces.front());
+    }
+
+    // aligned shapes launch without any workspace
+    CHECK(cache.Execute(MakeKey(1024, 1024, 1024), BF16_BYTES, launch));
+    CHECK(workspaces.back() == nullptr);
+    CHECK_EQ(device.allocCount, 1U);
+}
+
+HOST_TEST(StreamsGetSeparateWorkspaces)
+{
+    FakeDevice device;
+    auto cache = device.MakeCache(4);
+    uint8_t *first{nullptr};
+    uint8_t *second{nullptr};
+    cache.Execute(MakeKey(1000, 1000, 1000, 1), BF16_BYTES, [&](OptimizedMatmulPlan const &plan) { first = plan.workspace; });
+    cache.Execute(MakeKey(1000, 1000, 1000, 2), BF16_BYTES, [&](OptimizedMatmulPlan const &plan) { second = plan.workspace; });
+    CHECK(first != nullptr && second != nullptr && first != second);
+    CHECK_EQ(device.live.size(), 2U);
+}
+
+HOST_TEST(EvictionReleasesAfterStreamSync)
+{
+    FakeDevice device;
+    {
+        auto cache = device.MakeCache(2);
+        auto launch = [](OptimizedMatmulPlan const &) {};
+        cache.Execute(MakeKey(1000, 1000, 1000, 7), BF16_BYTES, launch);
+        cache.Execute(MakeKey(1100, 1000, 1000, 8), BF16_BYTES, launch);
+        cache.Execute(MakeKey(1200, 1000, 1000, 9), BF16_BYTES, launch);
+        CHECK_EQ(cache.Size(), 2U);
+        CHECK_EQ(device.syncedStreams, std::vector<uint64_t>{7});
+        CHECK_EQ(device.live.size(), 2U);
+    }
+    // destroying the cache releases the rest
+    CHECK(device.live.empty());
+}
+
+HOST_TEST(FailedAllocationSkipsLaunch)
+{
+    FakeDevice device;
+    auto cache = device.MakeCache(2);
+    device.failAlloc = true;
+    bool launched = false;
+    CHECK(!cache.Execute(MakeKey(1000, 1000, 1000), BF16_BYTES, [&](OptimizedMatmulPlan const &) { launched = true; }));
+    CHECK(!launched);
+    CHECK_EQ(cache.Size(), 0U);
+    device.failAlloc = false;
+    CHECK(cache.Execute(MakeKey(1000, 1000, 1000), BF16_BYTES, [&](OptimizedMatmulPlan const &) { launched = true; }));
+    CHECK(launched);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/quant_matmul_per_group.hpp"
+
+using namespace Catlass;
+
+using HostTest::MakeData;
+
+HOST_TEST(QuantizersWithinHalfAStep)
+{
+    uint32_t m = 8;
+    uint32_t n = 40;
+    // A shorter last group
+    uint32_t k = 200;
+    uint32_t groupSize = 64;
+    uint32_t blockN = 16;
+    auto activation = MakeData(static_cast<size_t>(m) * k, 0.0f, 3.0f, 1);
+    auto weight = MakeData(static_cast<size_t>(k) * n, 0.0f, 3.0f, 2);
+    std::vector<int8_t> quantA;
+    std::vector<int8_t> quantB;
+    std::vector<float> perTokenScale;
+    std::vector<float> scale;
+    golden::QuantizeActivationPerGroup(m, k, groupSize, activation, quantA, perTokenScale);
+    golden::QuantizeWeightPerBlock(k, n, groupSize, blockN, weight, quantB, scale);
+    CHECK_EQ(perTokenScale.size(), static_cast<size_t>(4) * m);
+    CHECK_EQ(scale.size(), static_cast<size_t>(4) * n);
+
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t p = 0; p < k; ++p) {
+            size_t idx = static_cast<size_t>(i) * k + p;
+            float s = perTokenScale[static_cast<size_t>(p / groupSize) * m + i];
+            CHECK(std::fabs(quantA[idx] * s - activation[idx]) <= 0.5f * s * 1.001f);
+        }
+    }
+    for (uint32_t p = 0; p < k; ++p) {
+        for (uint32_t j = 0; j < n; ++j) {
+            size_t idx = static_cast<size_t>(p) * n + j;
+            float s = scale[static_cast<size_t>(p / groupSize) * n + j];
+            CHECK(std::fabs(quantB[idx] * s - weight[idx]) <= 0.5f * s * 1.001f);
+            // The scale of a block is repeated over its columns, including the shorter last block
+            CHECK_EQ(s, scale[static_cast<size_t>(p / groupSize) * n + (j / blockN) * blockN]);
+        }
+    }
+}
+
+HOST_TEST(SingleGroupIsPerTokenPerChannel)
+{
+    uint32_t m = 4;
+    uint32_t n = 6;
+    uint32_t k = 32;
+    std::vector<int8_t> a(static_cast<size_t>(m) * k);
+    std::vector<int8_t> b(static_cast<size_t>(k) * n);
+    for (size_t i = 0; i < a.size(); ++i) {
+        a[i] = static_cast<int8_t>(static_cast<int32_t>(i * 7 % 255) - 127);
+    }
+    for (size_t i = 0; i < b.size(); ++i) {
+        b[i] = static_cast<int8_t>(static_cast<int32_t>(i * 11 % 255) - 127);
+    }
+    std::vector<float> scale(n);
+    std::vector<float> perTokenScale(m);
+    for (uint32_t j = 0; j < n; ++j) {
+        scale[j] = 0.01f * static_cast<float>(j + 1);
+    }
+    for (uint32_t i = 0; i < m; ++i) {
+        perTokenScale[i] = 0.5f + static_cast<float>(i);
+    }
+
+    std::vector<float> golden;
+    golden::ComputeQuantMatmulPerGroup(m, n, k, k, a, b, scale, perTokenScale, golden);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            int32_t sum = 0;
+            for (uint32_t p = 0; p < k; ++p) {
+                sum += a[static_cast<size_t>(i) * k + p] * b[static_cast<size_t>(p) * n + j];
+            }
+            CHECK_EQ(golden[static_cast<size_t>(i) * n + j],
+                static_cast<float>(sum) * scale[j] * perTokenScale[i]);
+        }
+    }
+}
+
+HOST_TEST(MatchesMatmulOfDequantizedOperands)
+{
+    uint32_t m = 16;
+    uint32_t n = 48;
+    uint32_t k = 320;
+    uint32_t groupSize = 128;
+    auto activation = MakeData(static_cast<size_t>(m) * k, 0.0f, 3.0f, 3);
+    auto weight = MakeData(static_cast<size_t>(k) * n, 0.0f, 3.0f, 4);
+    std::vector<int8_t> quantA;
+    std::vector<int8_t> quantB;
+    std::vector<float> perTokenScale;
+    std::vector<float> scale;
+    golden::QuantizeActivationPerGroup(m, k, groupSize, activation, quantA, perTokenScale);
+    golden::QuantizeWeightPerBlock(k, n, groupSize, 16, weight, quantB, scale);
+
+    std::vector<float> golden;
+    golden::ComputeQuantMatmulPerGroup(m, n, k, groupSize, quantA, quantB, scale, perTokenScale, golden);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            double expected = 0.0;
+            double magnitude = 0.0;
+            for (uint32_t p = 0; p < k; ++p) {
+                uint32_t g = p / groupSize;
+                double x = quantA[static_cast<size_t>(i) * k + p] * perTokenScale[static_cast<size_t>(g) * m + i];
+                double w = quantB[static_cast<size_t>(p) * n + j] * scale[static_cast<size_t>(g) * n + j];
+                expected += x * w;
+                magnitude += std::fabs(x * w);
+            }
+            // Only the fp32 rounding of the group scaling and accumulation differs
+            CHECK(std::fabs(golden[static_cast<size_t>(i) * n + j] - expected) <= magnitude * 1e-5 + 1e-6);
+        }
+    }
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <string>
+
+#include "test_common.hpp"
+#include "registry/basic_matmul_kernels.hpp"
+#include "registry/kernel_registry.hpp"
+
+using namespace CatlassKernel::Registry;
+using CatlassKernel::Tuning::BASIC_MATMUL_OP_NAME;
+
+namespace {
+constexpr uint32_t DTYPE_FP16 = 1;
+constexpr uint32_t DTYPE_BF16 = 27;
+
+// Launchers are replaced by tags, so that the test can check which instantiation a query lands on.
+struct TagLauncherTable {
+    std::string Default(bool transA, bool transB) const
+    {
+        return "default" + LayoutSuffix(transA, transB);
+    }
+
+    std::string Preload(bool transA, bool transB) const
+    {
+        return "preload" + LayoutSuffix(transA, transB);
+    }
+
+    std::string Config(size_t idx) const
+    {
+        return "config_" + std::to_string(idx);
+    }
+};
+
+KernelQuery MakeQuery(uint32_t m, uint32_t n, uint32_t k, bool transA = false, bool transB = false,
+    uint32_t dtype = DTYPE_FP16)
+{
+    return KernelQuery{BASIC_MATMUL_OP_NAME, dtype, transA, transB, m, n, k};
+}
+
+std::string SelectTag(KernelRegistry<std::string> const &registry, KernelQuery const &query,
+    std::string const &preferred = "")
+{
+    auto const *entry = registry.Select(query, preferred);
+    return (entry == nullptr) ? std::string("none") : entry->launcher;
+}
+} // namespace
+
+HOST_TEST(ClassifyShapes)
+{
+    CHECK(ClassifyShape(1, 4096, 4096) == ShapeClass::SMALL_M);
+    CHECK(ClassifyShape(64, 64, 64) == ShapeClass::SMALL_M);
+    CHECK(ClassifyShape(4096, 16, 4096) == ShapeClass::SKINNY_N);
+    CHECK(ClassifyShape(4096, 4096, 128) == ShapeClass::LARGE_SQUARE);
+    CHECK(ClassifyShape(2048, 4096, 128) == ShapeClass::LARGE_SQUARE);
+    CHECK(ClassifyShape(2048, 8192, 128) == ShapeClass::GENERAL);
+    CHECK(ClassifyShape(512, 512, 512) == ShapeClass::GENERAL);
+}
+
+HOST_TEST(SelectsByShapeClassAndLayout)
+{
+    KernelRegistry<std::string> registry;
+    RegisterBasicMatmulKernels(registry, DTYPE_FP16, TagLauncherTable{});
+
+    // configs 6 (64x256) and 9 (256x64)
+    CHECK_EQ(SelectTag(registry, MakeQuery(32, 4096, 4096)), "config_6");
+    CHECK_EQ(SelectTag(registry, MakeQuery(4096, 32, 4096)), "config_9");
+    CHECK_EQ(SelectTag(registry, MakeQuery(4096, 4096, 4096)), "preload_nn");
+    CHECK_EQ(SelectTag(registry, MakeQuery(512, 1024, 256)), "default_nn");
+
+    // tile configurations are row major only, other layouts fall back to the policies covering them
+    CHECK_EQ(SelectTag(registry, MakeQuery(32, 4096, 4096, false, true)), "default_nt");
+    CHECK_EQ(SelectTag(registry, MakeQuery(4096, 4096, 4096, true, false)), "preload_tn");
+    CHECK_EQ(SelectTag(registry, MakeQuery(512, 1024, 256, true, true)), "default_tt");
+
+    CHECK_EQ(SelectTag(registry, MakeQuery(512, 1024, 256, false, false, DTYPE_BF16)), "none");
+    KernelQuery otherOp = MakeQuery(512, 1024, 256);
+    otherOp.op = "grouped_matmul";
+    CHECK_EQ(SelectTag(registry, otherOp), "none");
+}
+
+HOST_TEST(RejectsDuplicateNames)
+{
+    KernelRegistry<std::string> registry;
+    RegisterBasicMatmulKernels(registry, DTYPE_FP16, TagLauncherTable{});
+    size_t count = registry.List(BASIC_MATMUL_OP_NAME).size();
+    CHECK_EQ(count, 8 + CatlassKernel::Tuning::BASIC_MATMUL_CONFIG_NUM);
+    CHECK(!registry.Register(KernelSpec{"basic_matmul_default_nn", BASIC_MATMUL_OP_NAME, DTYPE_BF16, false, false,
+        {ShapeClass::GENERAL}, 0}, "dup"));
+    CHECK_EQ(registry.List(BASIC_MATMUL_OP_NAME).size(), count);
+}
+
+HOST_TEST(OverrideAndPreferredKernel)
+{
+    KernelRegistry<std::string> registry;
+    RegisterBasicMatmulKernels(registry, DTYPE_FP16, TagLauncherTable{});
+    const std::string tuned = "basic_matmul_128x128x512_128_s3d0";
+
+    CHECK_EQ(registry.Query(MakeQuery(512, 1024, 256), tuned), tuned);
+    CHECK_EQ(SelectTag(registry, MakeQuery(512, 1024, 256), "unknown_kernel"), "default_nn");
+    // a preferred kernel that does not support the layout is ignored
+    CHECK_EQ(SelectTag(registry, MakeQuery(512, 1024, 256, true, false), tuned), "default_tn");
+
+    CHECK(!registry.SetOverride("unknown_kernel"));
+    CHECK(registry.SetOverride("basic_matmul_preload_nn"));
+    CHECK_EQ(SelectTag(registry, MakeQuery(32, 4096, 4096), tuned), "preload_nn");
+    CHECK_EQ(SelectTag(registry, MakeQuery(32, 4096, 4096, false, true)), "default_nt");
+
+    registry.ClearOverride(BASIC_MATMUL_OP_NAME);
+    CHECK_EQ(SelectTag(registry, MakeQuery(32, 4096, 4096)), "config_6");
+}
+
+HOST_TEST(PriorityAndRegistrationOrder)
+{
+    KernelRegistry<int> registry;
+    CHECK(registry.Register(KernelSpec{"a", "op", 0, false, false, {ShapeClass::GENERAL}, 0}, 1));
+    CHECK(registry.Register(KernelSpec{"b", "op", 0, false, false, {ShapeClass::GENERAL}, 0}, 2));
+    CHECK_EQ(registry.Select(KernelQuery{"op", 0, false, false, 512, 512, 512})->launcher, 1);
+    CHECK(registry.Register(KernelSpec{"c", "op", 0, false, false, {ShapeClass::GENERAL}, 5}, 3));
+    CHECK_EQ(registry.Select(KernelQuery{"op", 0, false, false, 512, 512, 512})->launcher, 3);
+    // a kernel without shape classes is reachable by name only
+    CHECK(registry.Register(KernelSpec{"d", "op", 0, false, false, {}, 10}, 4));
+    CHECK_EQ(registry.Select(KernelQuery{"op", 0, false, false, 512, 512, 512})->launcher, 3);
+    CHECK_EQ(registry.Select(KernelQuery{"op", 0, false, false, 512, 512, 512}, "d")->launcher, 4);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "catlass_host_macros.hpp"
+#include "test_common.hpp"
+#include "catlass/gemm/tile/fixpipe_quant_param.hpp"
+#include "golden/requant.hpp"
+
+using namespace Catlass;
+using Gemm::Tile::FixpipeRequantParam;
+
+HOST_TEST(RequantParamRoundTrip)
+{
+    uint64_t param = FixpipeRequantParam::Encode(0.5f, -3);
+    CHECK_EQ(golden::DecodeRequantScale(param), 0.5f);
+    CHECK_EQ(golden::DecodeRequantOffset(param), -3);
+    CHECK_EQ((param >> FixpipeRequantParam::SIGN_SHIFT) & 1, static_cast<uint64_t>(1));
+
+    uint64_t unsignedParam = FixpipeRequantParam::Encode(0.5f, 7, false);
+    CHECK_EQ((unsignedParam >> FixpipeRequantParam::SIGN_SHIFT) & 1, static_cast<uint64_t>(0));
+    CHECK_EQ(golden::DecodeRequantOffset(unsignedParam), 7);
+}
+
+HOST_TEST(RequantScaleIsTruncatedTo10MantissaBits)
+{
+    // 1 + 2^-10 survives, 1 + 2^-11 is dropped.
+    float kept = 1.0f + 1.0f / 1024.0f;
+    float dropped = 1.0f + 1.0f / 2048.0f;
+    CHECK_EQ(golden::DecodeRequantScale(FixpipeRequantParam::Encode(kept, 0)), kept);
+    CHECK_EQ(golden::DecodeRequantScale(FixpipeRequantParam::Encode(dropped, 0)), 1.0f);
+    // Truncation, not rounding: the largest mantissa below 1.0 + 2^-10 still decodes to 1.0.
+    uint32_t bits = 0x3F801FFFu;
+    float below;
+    std::memcpy(&below, &bits, sizeof(below));
+    CHECK_EQ(golden::DecodeRequantScale(FixpipeRequantParam::Encode(below, 0)), 1.0f);
+}
+
+HOST_TEST(RequantOffsetSaturatesTo9Bits)
+{
+    CHECK_EQ(golden::DecodeRequantOffset(FixpipeRequantParam::Encode(1.0f, 255)), 255);
+    CHECK_EQ(golden::DecodeRequantOffset(FixpipeRequantParam::Encode(1.0f, -256)), -256);
+    CHECK_EQ(golden::DecodeRequantOffset(FixpipeRequantParam::Encode(1.0f, 1000)), 255);
+    CHECK_EQ(golden::DecodeRequantOffset(FixpipeRequantParam::Encode(1.0f, -1000)), -256);
+}
+
+HOST_TEST(RequantRoundsHalfToEvenAndSaturates)
+{
+    uint64_t half = FixpipeRequantParam::Encode(0.5f, 0);
+    CHECK_EQ(golden::RequantInt32ToInt8(3, half), static_cast<int8_t>(2));
+    CHECK_EQ(golden::RequantInt32ToInt8(5, half), static_cast<int8_t>(2));
+    CHECK_EQ(golden::RequantInt32ToInt8(-3, half), static_cast<int8_t>(-2));
+    CHECK_EQ(golden::RequantInt32ToInt8(-5, half), static_cast<int8_t>(-2));
+    // The offset is added after rounding.
+    uint64_t shifted = FixpipeRequantParam::Encode(0.5f, 10);
+    CHECK_EQ(golden::RequantInt32ToInt8(5, shifted), static_cast<int8_t>(12));
+    CHECK_EQ(golden::RequantInt32ToInt8(240, shifted), static_cast<int8_t>(127));
+    CHECK_EQ(golden::RequantInt32ToInt8(-1000, shifted), static_cast<int8_t>(-128));
+    CHECK_EQ(golden::RequantInt32ToInt8(-276, shifted), static_cast<int8_t>(-128));
+    CHECK_EQ(golden::RequantInt32ToInt8(-274, shifted), static_cast<int8_t>(-127));
+}
+
+HOST_TEST(RequantPerChannelUsesColumnParam)
+{
+    std::vector<int32_t> acc{10, 10, 10, -10, -10, -10};
+    std::vector<uint64_t> perChannel{
+        FixpipeRequantParam::Encode(1.0f, 0),
+        FixpipeRequantParam::Encode(0.5f, 1),
+        FixpipeRequantParam::Encode(2.0f, -1)
+    };
+    std::vector<int8_t> out;
+    golden::ComputeRequant(2, 3, acc, perChannel, out);
+    std::vector<int8_t> expected{10, 6, 19, -10, -4, -21};
+    CHECK(out == expected);
+
+    golden::ComputeRequant(2, 3, acc, {FixpipeRequantParam::Encode(0.5f, 0)}, out);
+    std::vector<int8_t> expectedPerTensor{5, 5, 5, -5, -5, -5};
+    CHECK(out == expectedPerTensor);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/norm.hpp"
+
+using namespace Catlass;
+using golden::NormType;
+using HostTest::MakeData;
+
+namespace {
+constexpr uint32_t TILE_COLUMN = 256;
+constexpr uint32_t LANES = 64;
+
+// Row sum of one tile as computed by TileRowReduceSum: the columns are folded into 64 lanes, then the lanes are
+// summed. Everything in float.
+float TileRowSum(const float *values, uint32_t cols)
+{
+    float lanes[LANES] = {};
+    for (uint32_t j = 0; j < cols; ++j) {
+        lanes[j % LANES] += values[j];
+    }
+    float sum = 0.0f;
+    for (uint32_t lane = 0; lane < LANES; ++lane) {
+        sum += lanes[lane];
+    }
+    return sum;
+}
+
+// The float arithmetic of the residual norm epilogue: per tile partial statistics summed across the column tiles
+// of a row (the atomic adds of the multi tile path, or a single tile if the row fits one), the variance of
+// LayerNorm from the centered values, and D = ((s - mean) * scale) * gamma + beta.
+void DeviceRowNorm(NormType type, uint32_t m, uint32_t n, const std::vector<float> &s,
+    const std::vector<float> &gamma, const std::vector<float> &beta, float epsilon, std::vector<float> &out)
+{
+    bool isLayerNorm = (type == NormType::LAYER_NORM);
+    float invN = 1.0f / static_cast<float>(n);
+    std::vector<float> centered(n);
+    for (uint32_t i = 0; i < m; ++i) {
+        const float *row = s.data() + static_cast<size_t>(i) * n;
+        float shift = 0.0f;
+        if (isLayerNorm) {
+            float sum = 0.0f;
+            for (uint32_t col = 0; col < n; col += TILE_COLUMN) {
+                sum += TileRowSum(row + col, std::min(TILE_COLUMN, n - col));
+            }
+            shift = sum * -invN;
+        }
+        for (uint32_t j = 0; j < n; ++j) {
+            centered[j] = row[j] + shift;
+        }
+        float squareSum = 0.0f;
+        for (uint32_t col = 0; col < n; col += TILE_COLUMN) {
+            uint32_t cols = std::min(TILE_COLUMN, n - col);
+            std::vector<float> squares(cols);
+            for (uint32_t j = 0; j < cols; ++j) {
+                squares[j] = centered[col + j] * centered[col + j];
+            }
+            squareSum += TileRowSum(squares.data(), cols);
+        }
+        float scale = 1.0f / std::sqrt(squareSum * invN + epsilon);
+        for (uint32_t j = 0; j < n; ++j) {
+            float value = centered[j] * scale * gamma[j];
+            if (isLayerNorm && !beta.empty()) {
+                value += beta[j];
+            }
+            out[static_cast<size_t>(i) * n + j] = value;
+        }
+    }
+}
+
+float MaxAbsDiff(const std::vector<float> &a, const std::vector<float> &b)
+{
+    float diff = 0.0f;
+    for (size_t i = 0; i < a.size(); ++i) {
+        diff = std::max(diff, std::fabs(a[i] - b[i]));
+    }
+    return diff;
+}
+} // namespace
+
+HOST_TEST(ReferenceKnownValues)
+{
+    std::vector<float> rms(2);
+    golden::ComputeRowNorm(NormType::RMS_NORM, 1, 2, std::vector<float>{3.0f, 4.0f},
+        std::vector<float>{1.0f, 2.0f}, std::vector<float>{}, 0.0f, rms);
+    // rms([3, 4]) = sqrt(12.5)
+    CHECK(std::fabs(rms[0] - 0.848528f) < 1e-5f);
+    CHECK(std::fabs(rms[1] - 2.262742f) < 1e-5f);
+
+    std::vector<float> layer(4);
+    golden::ComputeRowNorm(NormType::LAYER_NORM, 1, 4, std::vector<float>{1.0f, 2.0f, 3.0f, 4.0f},
+        std::vector<float>(4, 1.0f), std::vector<float>(4, 0.5f), 0.0f, layer);
+    // mean 2.5, variance 1.25
+    CHECK(std::fabs(layer[0] - (0.5f - 1.341641f)) < 1e-5f);
+    CHECK(std::fabs(layer[3] - (0.5f + 1.341641f)) < 1e-5f);
+    CHECK(std::fabs(layer[1] + layer[2] - 1.0f) < 1e-5f);
+}
+
+HOST_TEST(DeviceArithmeticMatchesReference)
+{
+    constexpr uint32_t m = 5;
+    constexpr float epsilon = 1e-6f;
+    // One partial tile, one full tile, and rows spanning several tiles with a partial last one
+    for (uint32_t n : {100u, 256u, 1000u}) {
+        std::vector<float> s = MakeData(static_cast<size_t>(m) * n, 0.5f, 4.0f, n);
+        std::vector<float> gamma = MakeData(n, 1.0f, 0.5f, n + 1);
+        std::vector<float> beta = MakeData(n, 0.0f, 0.5f, n + 2);
+        for (NormType type : {NormType::RMS_NORM, NormType::LAYER_NORM}) {
+            std::vector<float> expected(s.size());
+            std::vector<float> actual(s.size());
+            golden::ComputeRowNorm(type, m, n, s, gamma, beta, epsilon, expected);
+            DeviceRowNorm(type, m, n, s, gamma, beta, epsilon, actual);
+            CHECK(MaxAbsDiff(expected, actual) < 1e-4f);
+        }
+    }
+}
+
+HOST_TEST(LayerNormVarianceIsCentered)
+{
+    // A large mean and a small spread, typical of a residual stream. Subtracting the mean before squaring keeps
+    // the float result close to the reference, while E[s^2] - mean^2 in float cancels catastrophically.
+    constexpr uint32_t m = 2;
+    constexpr uint32_t n = 1024;
+    constexpr float epsilon = 1e-6f;
+    std::vector<float> s = MakeData(static_cast<size_t>(m) * n, 1000.0f, 0.05f, 7);
+    std::vector<float> gamma(n, 1.0f);
+    std::vector<float> expected(s.size());
+    std::vector<float> actual(s.size());
+    golden::ComputeRowNorm(NormType::LAYER_NORM, m, n, s, gamma, std::vector<float>{}, epsilon, expected);
+    DeviceRowNorm(NormType::LAYER_NORM, m, n, s, gamma, std::vector<float>{}, epsilon, actual);
+    CHECK(MaxAbsDiff(expected, actual) < 2e-2f);
+
+    float sum = 0.0f;
+    float squareSum = 0.0f;
+    double centeredSquareSum = 0.0;
+    double mean = 0.0;
+    for (uint32_t j = 0; j < n; ++j) {
+        mean += s[j];
+    }
+    mean /= n;
+    for (uint32_t j = 0; j < n; ++j) {
+        sum += s[j];
+        squareSum += s[j] * s[j];
+        centeredSquareSum += (s[j] - mean) * (s[j] - mean);
+    }
+    float uncenteredVariance = squareSum / n - (sum / n) * (sum / n);
+    double variance = centeredSquareSum / n;
+    CHECK(std::fabs(uncenteredVariance - variance) > 0.5 * variance);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
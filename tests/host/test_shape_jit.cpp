@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+#include "test_common.hpp"
+#include "jit/shape_codegen.hpp"
+#include "jit/shape_jit_cache.hpp"
+
+using namespace CatlassKernel::Jit;
+
+namespace {
+JitKernelSpec MakeSpec(std::string const &fingerprint = "build-1")
+{
+    return JitKernelSpec{"basic_matmul", "kernel/basic_matmul.hpp",
+        "Catlass::BasicMatmulBody<RowMajor, RowMajor, RowMajor, half, half>", fingerprint};
+}
+
+// Every loaded binary gets its own launcher address, so tests can tell them apart.
+int launcherSlots[16];
+
+// Fake bisheng: "compiles" by copying the source into the binary, optionally held back or failing.
+struct FakeCompiler {
+    std::atomic<int> compiles{0};
+    std::atomic<int> loads{0};
+    bool fail{false};
+    bool hold{false};
+    std::mutex mutex;
+    std::condition_variable cond;
+
+    ShapeJitCache::CompileFunc Compile()
+    {
+        return [this](std::string const &sourcePath, std::string const &binaryPath) {
+            ++compiles;
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cond.wait(lock, [this]() { return !hold; });
+            }
+            if (fail) {
+                std::ofstream(binaryPath) << "partial";
+                return false;
+            }
+            std::filesystem::copy_file(sourcePath, binaryPath);
+            return true;
+        };
+    }
+
+    ShapeJitCache::LoadFunc Load()
+    {
+        return [this](std::string const &binaryPath) -> void * {
+            std::ifstream file(binaryPath);
+            std::string firstLine;
+            std::getline(file, firstLine);
+            if (firstLine.rfind("// Generated by the catlass shape JIT", 0) != 0) {
+                return nullptr;
+            }
+            return &launcherSlots[loads++ % 16];
+        };
+    }
+
+    void Release()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            hold = false;
+        }
+        cond.notify_all();
+    }
+};
+
+struct TempDir {
+    std::filesystem::path path;
+
+    explicit TempDir(std::string const &name)
+        : path(std::filesystem::temp_directory_path() / (name + "_" + std::to_string(getpid())))
+    {
+        std::filesystem::remove_all(path);
+    }
+
+    ~TempDir()
+    {
+        std::filesystem::remove_all(path);
+    }
+
+    size_t FileCount(std::string const &extension) const
+    {
+        size_t count = 0;
+        if (!std::filesystem::exists(path)) {
+            return 0;
+        }
+        for (auto const &item : std::filesystem::directory_iterator(path)) {
+            count += (item.path().extension() == extension) ? 1 : 0;
+        }
+        return count;
+    }
+};
+} // namespace
+
+HOST_TEST(GeneratedSourceFixesTheShape)
+{
+    JitShape shape{1, 4096, 11008};
+    std::string source = GenerateShapeSource(MakeSpec(), shape);
+    CHECK(source.find("#include \"kernel/basic_matmul.hpp\"") != std::string::npos);
+    CHECK(source.find("constexpr uint32_t JIT_M = 1;") != std::string::npos);
+    CHECK(source.find("constexpr uint32_t JIT_N = 4096;") != std::string::npos);
+    CHECK(source.find("constexpr uint32_t JIT_K = 11008;") != std::string::npos);
+    CHECK(source.find(MakeSpec().body + "(Catlass::GemmCoord{JIT_M, JIT_N, JIT_K}") != std::string::npos);
+    CHECK(source.find(std::string("void ") + JIT_LAUNCH_SYMBOL + "(") != std::string::npos);
+    CHECK(source.find("build-1") != std::string::npos);
+    CHECK_EQ(source, GenerateShapeSource(MakeSpec(), shape));
+}
+
+HOST_TEST(BinaryNameKeysShapeAndSourceHash)
+{
+    JitShape shape{16, 256, 512};
+    std::string name = JitBinaryName(MakeSpec(), shape, GenerateShapeSource(MakeSpec(), shape));
+    CHECK_EQ(name.rfind("basic_matmul_16x256x512_", 0), 0U);
+    CHECK_EQ(name.size(), std::string("basic_matmul_16x256x512_").size() + 16 + 3);
+    CHECK_EQ(name, JitBinaryName(MakeSpec(), shape, GenerateShapeSource(MakeSpec(), shape)));
+
+    JitShape other{16, 256, 1024};
+    CHECK(name != JitBinaryName(MakeSpec(), other, GenerateShapeSource(MakeSpec(), other)));
+    CHECK(name != JitBinaryName(MakeSpec("build-2"), shape, GenerateShapeSource(MakeSpec("build-2"), shape)));
+    CHECK_EQ(HashString(""), 0xcbf29ce484222325ULL);
+    CHECK_EQ(HashString("a"), 0xaf63dc4c8601ec8cULL);
+}
+
+HOST_TEST(FallsBackUntilBinaryIsReady)
+{
+    TempDir dir("catlass_jit_fallback");
+    FakeCompiler compiler;
+    compiler.hold = true;
+    ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 1);
+    JitShape shape{8, 128, 256};
+
+    CHECK(cache.Lookup(MakeSpec(), shape) == nullptr);
+    // The compile is held back, calls keep running the generic kernel without waiting.
+    for (int i = 0; i < 10; ++i) {
+        CHECK(cache.Lookup(MakeSpec(), shape) == nullptr);
+    }
+    compiler.Release();
+    cache.WaitIdle();
+
+    void *launcher = cache.Lookup(MakeSpec(), shape);
+    CHECK(launcher != nullptr);
+    CHECK_EQ(cache.Lookup(MakeSpec(), shape), launcher);
+    CHECK_EQ(compiler.compiles.load(), 1);
+    ShapeJitStats stats = cache.Stats();
+    CHECK_EQ(stats.fallbacks, 11U);
+    CHECK_EQ(stats.hits, 2U);
+    CHECK_EQ(stats.compiles, 1U);
+    CHECK_EQ(dir.FileCount(".so"), 1U);
+    CHECK_EQ(dir.FileCount(".cpp"), 1U);
+}
+
+HOST_TEST(OnlyHotShapesAreCompiled)
+{
+    TempDir dir("catlass_jit_hot");
+    FakeCompiler compiler;
+    ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 3);
+    JitShape cold{32, 64, 64};
+    JitShape hot{64, 64, 64};
+
+    cache.Lookup(MakeSpec(), cold);
+    cache.Lookup(MakeSpec(), cold);
+    cache.Lookup(MakeSpec(), hot);
+    cache.Lookup(MakeSpec(), hot);
+    cache.Lookup(MakeSpec(), hot);
+    cache.WaitIdle();
+    CHECK_EQ(compiler.compiles.load(), 1);
+    CHECK(cache.Lookup(MakeSpec(), hot) != nullptr);
+    CHECK(cache.Lookup(MakeSpec(), cold) == nullptr);
+    cache.WaitIdle();
+    CHECK_EQ(compiler.compiles.load(), 2);
+}
+
+HOST_TEST(DiskCacheIsReusedAcrossInstances)
+{
+    TempDir dir("catlass_jit_disk");
+    JitShape shape{1, 8192, 8192};
+    {
+        FakeCompiler compiler;
+        ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 1);
+        cache.Lookup(MakeSpec(), shape);
+        cache.WaitIdle();
+        CHECK_EQ(compiler.compiles.load(), 1);
+    }
+    {
+        // A new process with the same build finds the binary, no compile.
+        FakeCompiler compiler;
+        ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 1);
+        cache.Lookup(MakeSpec(), shape);
+        cache.WaitIdle();
+        CHECK(cache.Lookup(MakeSpec(), shape) != nullptr);
+        CHECK_EQ(compiler.compiles.load(), 0);
+        CHECK_EQ(cache.Stats().diskHits, 1U);
+    }
+    {
+        // Another build of the library does not reuse it.
+        FakeCompiler compiler;
+        ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 1);
+        cache.Lookup(MakeSpec("build-2"), shape);
+        cache.WaitIdle();
+        CHECK_EQ(compiler.compiles.load(), 1);
+        CHECK_EQ(dir.FileCount(".so"), 2U);
+    }
+}
+
+HOST_TEST(FailedCompileKeepsGenericKernel)
+{
+    TempDir dir("catlass_jit_fail");
+    FakeCompiler compiler;
+    compiler.fail = true;
+    ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 1);
+    JitShape shape{4, 4096, 4096};
+
+    cache.Lookup(MakeSpec(), shape);
+    cache.WaitIdle();
+    CHECK(cache.Lookup(MakeSpec(), shape) == nullptr);
+    cache.WaitIdle();
+    CHECK_EQ(compiler.compiles.load(), 1);
+    CHECK_EQ(cache.Stats().failures, 1U);
+    // The partly written output is not published.
+    CHECK_EQ(dir.FileCount(".so"), 0U);
+}
+
+HOST_TEST(ConcurrentLookupsCompileOnce)
+{
+    TempDir dir("catlass_jit_concurrent");
+    FakeCompiler compiler;
+    ShapeJitCache cache(dir.path.string(), compiler.Compile(), compiler.Load(), 4);
+    JitShape shape{2, 2048, 2048};
+
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 8; ++i) {
+        threads.emplace_back([&]() {
+            for (int j = 0; j < 100; ++j) {
+                cache.Lookup(MakeSpec(), shape);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    cache.WaitIdle();
+    CHECK_EQ(compiler.compiles.load(), 1);
+    ShapeJitStats stats = cache.Stats();
+    CHECK_EQ(stats.hits + stats.fallbacks, 800U);
+    CHECK(cache.Lookup(MakeSpec(), shape) != nullptr);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "catlass_host_macros.hpp"
+#include "test_common.hpp"
+#include "catlass/gemm/kernel/skinny_matmul_strategy.hpp"
+
+using Catlass::Gemm::Kernel::SkinnyColumnPartition;
+using Catlass::Gemm::Kernel::SkinnyMatmulCostModel;
+using Catlass::Gemm::Kernel::SkinnyMatmulPath;
+
+namespace {
+constexpr uint32_t AIC_NUM = 24;
+constexpr uint32_t HALF_BYTES = 2;
+
+// Decode shapes of common layers: n x k of the weight.
+const std::vector<std::pair<uint32_t, uint32_t>> DECODE_SHAPES{
+    {4096, 4096}, {11008, 4096}, {4096, 11008}, {14336, 4096}, {32000, 4096}, {1024, 8192}};
+} // namespace
+
+HOST_TEST(ColumnPartitionCoversEveryColumnOnce)
+{
+    for (uint32_t coreNum = 1; coreNum <= 40; ++coreNum) {
+        for (uint32_t n = 1; n <= 2048; n += 7) {
+            uint32_t columnsPerCore = SkinnyColumnPartition::ColumnsPerCore(n, coreNum);
+            CHECK_EQ(columnsPerCore % SkinnyColumnPartition::COLUMN_ALIGN, 0U);
+            std::vector<uint32_t> owners(n, 0);
+            uint32_t activeCores = 0;
+            // Same walk as SkinnyMatmul
+            for (uint32_t core = 0; core < coreNum; ++core) {
+                uint32_t nStart = core * columnsPerCore;
+                if (nStart >= n) {
+                    continue;
+                }
+                ++activeCores;
+                uint32_t nEnd = (n - nStart > columnsPerCore) ? (nStart + columnsPerCore) : n;
+                for (uint32_t j = nStart; j < nEnd; ++j) {
+                    ++owners[j];
+                }
+            }
+            CHECK_EQ(activeCores, SkinnyColumnPartition::ActiveCores(n, coreNum));
+            for (uint32_t j = 0; j < n; ++j) {
+                CHECK_EQ(owners[j], 1U);
+            }
+        }
+    }
+}
+
+HOST_TEST(DecodeShapesPickGemvSkinnyThenGemm)
+{
+    for (auto const &shape : DECODE_SHAPES) {
+        uint32_t n = shape.first;
+        uint32_t k = shape.second;
+        // A second row of A already costs GEMV a second pass over B.
+        for (uint32_t m = 2; m <= SkinnyMatmulCostModel::SKINNY_TILE_M; ++m) {
+            CHECK(SkinnyMatmulCostModel::Select(m, n, k, HALF_BYTES, AIC_NUM) == SkinnyMatmulPath::SKINNY_GEMM);
+        }
+        for (uint32_t m = SkinnyMatmulCostModel::SKINNY_TILE_M + 1; m <= 256; ++m) {
+            CHECK(SkinnyMatmulCostModel::Select(m, n, k, HALF_BYTES, AIC_NUM) == SkinnyMatmulPath::GEMM);
+        }
+        CHECK_EQ(SkinnyMatmulCostModel::Crossover(SkinnyMatmulPath::SKINNY_GEMM, n, k, HALF_BYTES, AIC_NUM, 256),
+            SkinnyMatmulCostModel::SKINNY_TILE_M + 1);
+    }
+}
+
+HOST_TEST(SingleRowPrefersGemvWhenItFillsTheCores)
+{
+    // 128 GEMV blocks keep the 48 AIV cores busy in whole waves, so the lower fixed cost of GEMV decides.
+    CHECK(SkinnyMatmulCostModel::Select(1, 4096, 4096, HALF_BYTES, AIC_NUM) == SkinnyMatmulPath::GEMV);
+    CHECK_EQ(SkinnyMatmulCostModel::Crossover(SkinnyMatmulPath::GEMV, 4096, 4096, HALF_BYTES, AIC_NUM, 16), 2U);
+    // Too few GEMV blocks for the AIV cores: 8 blocks of 32 rows read B at a third of the rate of the skinny split.
+    CHECK(SkinnyMatmulCostModel::Select(1, 256, 8192, HALF_BYTES, AIC_NUM) == SkinnyMatmulPath::SKINNY_GEMM);
+}
+
+HOST_TEST(GemmTakesOverEarlierOnWholeWaves)
+{
+    // n = 12288 makes 48 GEMM blocks, two whole waves on 24 cores, so only the fixed cost of the narrower skinny
+    // tiles is left to compare.
+    uint32_t crossover =
+        SkinnyMatmulCostModel::Crossover(SkinnyMatmulPath::SKINNY_GEMM, 12288, 4096, HALF_BYTES, AIC_NUM, 256);
+    CHECK(crossover > 2);
+    CHECK(crossover <= SkinnyMatmulCostModel::SKINNY_TILE_M);
+    CHECK(SkinnyMatmulCostModel::Select(2, 12288, 4096, HALF_BYTES, AIC_NUM) == SkinnyMatmulPath::SKINNY_GEMM);
+}
+
+HOST_TEST(SelectionIsMonotonicInM)
+{
+    for (auto const &shape : DECODE_SHAPES) {
+        SkinnyMatmulPath previous = SkinnyMatmulPath::GEMV;
+        for (uint32_t m = 1; m <= 512; ++m) {
+            SkinnyMatmulPath path = SkinnyMatmulCostModel::Select(m, shape.first, shape.second, HALF_BYTES, AIC_NUM);
+            CHECK(path >= previous);
+            previous = path;
+        }
+    }
+}
+
+HOST_TEST(SkinnyReadsBOnceGemvOncePerRow)
+{
+    // With the HBM saturated by every path, the traffic term alone separates them.
+    uint32_t n = 8192;
+    uint32_t k = 8192;
+    uint64_t gemvOne = SkinnyMatmulCostModel::GemvCycles(1, n, k, HALF_BYTES, 2 * AIC_NUM);
+    CHECK_EQ(SkinnyMatmulCostModel::GemvCycles(8, n, k, HALF_BYTES, 2 * AIC_NUM), 8 * gemvOne);
+    uint64_t skinnyOne = SkinnyMatmulCostModel::SkinnyGemmCycles(1, n, k, HALF_BYTES, AIC_NUM);
+    uint64_t skinnySixteen = SkinnyMatmulCostModel::SkinnyGemmCycles(16, n, k, HALF_BYTES, AIC_NUM);
+    CHECK(skinnySixteen < 2 * skinnyOne);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
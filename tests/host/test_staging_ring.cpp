@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "test_common.hpp"
+#include "memory/host_staging_ring.hpp"
+
+using namespace CatlassKernel::Memory;
+
+namespace {
+constexpr uint64_t STREAM_A = 1;
+constexpr uint64_t STREAM_B = 2;
+constexpr size_t RING_SIZE = 1024;
+
+// Mock runtime: copies run immediately into the device buffer, fences complete when the test says so.
+struct MockRuntime {
+    std::vector<uint8_t> host = std::vector<uint8_t>(RING_SIZE);
+    std::vector<uint8_t> device = std::vector<uint8_t>(RING_SIZE);
+    std::map<int, bool> fences;
+    int nextFence{0};
+    size_t copies{0};
+    size_t waits{0};
+    size_t destroyed{0};
+    bool failCopy{false};
+    std::mutex mutex;
+
+    std::unique_ptr<HostStagingRing> MakeRing(size_t capacity = RING_SIZE)
+    {
+        HostStagingRing::FenceOps fenceOps{
+            [this](uint64_t) -> void * {
+                std::lock_guard<std::mutex> lock(mutex);
+                int id = ++nextFence;
+                fences[id] = false;
+                return reinterpret_cast<void *>(static_cast<uintptr_t>(id));
+            },
+            [this](void *fence) {
+                std::lock_guard<std::mutex> lock(mutex);
+                return fences.at(Id(fence));
+            },
+            [this](void *fence) {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++waits;
+                fences.at(Id(fence)) = true;
+            },
+            [this](void *fence) {
+                std::lock_guard<std::mutex> lock(mutex);
+                ++destroyed;
+                fences.erase(Id(fence));
+            }};
+        return std::make_unique<HostStagingRing>(host.data(), device.data(), capacity,
+            [this](uint8_t *dst, uint8_t const *src, size_t size, uint64_t) {
+                std::lock_guard<std::mutex> lock(mutex);
+                if (failCopy) {
+                    return false;
+                }
+                ++copies;
+                std::memcpy(dst, src, size);
+                return true;
+            },
+            fenceOps);
+    }
+
+    void CompleteAll()
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto &fence : fences) {
+            fence.second = true;
+        }
+    }
+
+    size_t Offset(uint8_t const *ptr) const
+    {
+        return static_cast<size_t>(ptr - device.data());
+    }
+
+    static int Id(void *fence)
+    {
+        return static_cast<int>(reinterpret_cast<uintptr_t>(fence));
+    }
+};
+} // namespace
+
+HOST_TEST(StagedDataReachesDeviceSlot)
+{
+    MockRuntime runtime;
+    auto ring = runtime.MakeRing();
+    std::vector<int32_t> groupList{3, 7, 11, 20};
+    uint8_t *slot = ring->Stage(groupList.data(), groupList.size() * sizeof(int32_t), STREAM_A);
+    CHECK(slot != nullptr);
+    CHECK_EQ(runtime.Offset(slot), 0U);
+    CHECK(std::memcmp(slot, groupList.data(), groupList.size() * sizeof(int32_t)) == 0);
+
+    // Slots are aligned, the next one starts on the following 64B boundary.
+    uint8_t *next = ring->Stage(groupList.data(), 4, STREAM_A);
+    CHECK_EQ(runtime.Offset(next), HostStagingRing::SLOT_ALIGN);
+    CHECK(ring->Commit(STREAM_A));
+    // Both slots share the one fence of the commit.
+    CHECK_EQ(runtime.fences.size(), 1U);
+    CHECK_EQ(ring->PendingSlots(), 2U);
+    CHECK_EQ(ring->Stats().uploads, 2U);
+}
+
+HOST_TEST(SlotIsReusedOnlyAfterItsFence)
+{
+    MockRuntime runtime;
+    auto ring = runtime.MakeRing();
+    std::vector<uint8_t> data(RING_SIZE / 2, 1);
+    uint8_t *first = ring->Stage(data.data(), data.size(), STREAM_A);
+    ring->Commit(STREAM_A);
+    uint8_t *second = ring->Stage(data.data(), data.size(), STREAM_A);
+    ring->Commit(STREAM_A);
+    CHECK(first != second);
+
+    // The fences have not completed, polling keeps both slots.
+    ring->Poll();
+    CHECK_EQ(ring->PendingSlots(), 2U);
+
+    // The ring is full, the third upload waits for the oldest fence and takes its slot.
+    uint8_t *third = ring->Stage(data.data(), data.size(), STREAM_A);
+    CHECK_EQ(third, first);
+    CHECK_EQ(runtime.waits, 1U);
+    CHECK_EQ(ring->Stats().fenceWaits, 1U);
+    CHECK_EQ(runtime.destroyed, 1U);
+
+    // Completed fences free their slots without waiting.
+    ring->Commit(STREAM_A);
+    runtime.CompleteAll();
+    ring->Poll();
+    CHECK_EQ(ring->PendingSlots(), 0U);
+    CHECK_EQ(runtime.waits, 1U);
+    CHECK_EQ(runtime.destroyed, 3U);
+}
+
+HOST_TEST(WrapsAroundPastShortTail)
+{
+    MockRuntime runtime;
+    auto ring = runtime.MakeRing();
+    std::vector<uint8_t> data(512, 2);
+    uint8_t *a = ring->Stage(data.data(), 512, STREAM_A);
+    uint8_t *b = ring->Stage(data.data(), 320, STREAM_A);
+    ring->Commit(STREAM_A);
+    CHECK_EQ(runtime.Offset(a), 0U);
+    CHECK_EQ(runtime.Offset(b), 512U);
+    runtime.CompleteAll();
+
+    // 192 bytes are left at the end, too short for the slot: it starts over at the front once a is free.
+    uint8_t *c = ring->Stage(data.data(), 384, STREAM_A);
+    CHECK_EQ(runtime.Offset(c), 0U);
+    CHECK_EQ(runtime.waits, 0U);
+    // Wrapped, the room between c and b is still usable.
+    ring->Commit(STREAM_A);
+    uint8_t *d = ring->Stage(data.data(), 64, STREAM_A);
+    CHECK_EQ(runtime.Offset(d), 384U);
+    CHECK_EQ(ring->PendingSlots(), 3U);
+    CHECK(std::memcmp(d, data.data(), 64) == 0);
+}
+
+HOST_TEST(RejectsOversizeAndUncommittedFullRing)
+{
+    MockRuntime runtime;
+    auto ring = runtime.MakeRing();
+    std::vector<uint8_t> data(RING_SIZE + 1, 3);
+    CHECK(ring->Stage(data.data(), data.size(), STREAM_A) == nullptr);
+    CHECK(ring->Stage(data.data(), 0, STREAM_A) == nullptr);
+
+    // Slots that are not committed yet may still be read by a launch not enqueued yet, they are never waited for.
+    CHECK(ring->Stage(data.data(), RING_SIZE, STREAM_A) != nullptr);
+    CHECK(ring->Stage(data.data(), 64, STREAM_A) == nullptr);
+    CHECK_EQ(runtime.waits, 0U);
+    CHECK_EQ(ring->Stats().rejects, 2U);
+
+    runtime.failCopy = true;
+    ring->Commit(STREAM_A);
+    CHECK(ring->Stage(data.data(), 64, STREAM_A) == nullptr);
+    CHECK_EQ(ring->PendingSlots(), 0U);
+}
+
+HOST_TEST(CommitFencesOnlyItsStream)
+{
+    MockRuntime runtime;
+    auto ring = runtime.MakeRing();
+    std::vector<uint8_t> data(RING_SIZE / 2, 4);
+    uint8_t *a = ring->Stage(data.data(), data.size(), STREAM_A);
+    uint8_t *b = ring->Stage(data.data(), data.size(), STREAM_B);
+    CHECK(a != nullptr && b != nullptr);
+    ring->Commit(STREAM_B);
+    runtime.CompleteAll();
+    ring->Poll();
+    // The slot of STREAM_A is older and not committed, it blocks the reuse of the ring behind it.
+    CHECK_EQ(ring->PendingSlots(), 2U);
+    CHECK(ring->Stage(data.data(), 64, STREAM_A) == nullptr);
+
+    ring->Commit(STREAM_A);
+    runtime.CompleteAll();
+    CHECK_EQ(ring->Stage(data.data(), 64, STREAM_B), a);
+}
+
+HOST_TEST(ConcurrentLaunchesGetDisjointSlots)
+{
+    MockRuntime runtime;
+    auto ring = runtime.MakeRing();
+    bool corrupted = false;
+    std::mutex resultMutex;
+    std::vector<std::thread> threads;
+    for (uint64_t stream = 1; stream <= 4; ++stream) {
+        threads.emplace_back([&, stream]() {
+            std::vector<uint8_t> data(100, static_cast<uint8_t>(stream));
+            for (int i = 0; i < 200; ++i) {
+                uint8_t *slot = ring->Stage(data.data(), data.size(), stream);
+                if (slot == nullptr) {
+                    continue;
+                }
+                // The "kernel" reads the slot before the commit, nobody may overwrite it meanwhile.
+                bool ok = std::memcmp(slot, data.data(), data.size()) == 0;
+                ring->Commit(stream);
+                runtime.CompleteAll();
+                std::lock_guard<std::mutex> lock(resultMutex);
+                corrupted = corrupted || !ok;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    CHECK(!corrupted);
+    HostStagingRingStats stats = ring->Stats();
+    CHECK_EQ(stats.uploads + stats.rejects, 800U);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/activation.hpp"
+#include "swiglu_weight.hpp"
+
+using namespace Catlass;
+using golden::ActivationType;
+
+namespace {
+constexpr uint32_t L1_N = 256;
+constexpr uint32_t PAIR_N = L1_N / 2;
+
+// Row major m x n product of a row major m x k and a row major k x n matrix
+std::vector<float> Matmul(uint32_t m, uint32_t n, uint32_t k, const std::vector<float> &a, const std::vector<float> &b)
+{
+    std::vector<float> c(static_cast<size_t>(m) * n, 0.0f);
+    for (uint32_t i = 0; i < m; ++i) {
+        for (uint32_t p = 0; p < k; ++p) {
+            for (uint32_t j = 0; j < n; ++j) {
+                c[i * n + j] += a[i * k + p] * b[p * n + j];
+            }
+        }
+    }
+    return c;
+}
+
+// SwiGLU as the kernel computes it: one matmul against the interleaved weight, then every L1_N wide cube block is
+// split in halves, the left half being the gate and the right half the up projection of the same output columns.
+std::vector<float> BlockedSwiGlu(uint32_t m, uint32_t n, uint32_t k, const std::vector<float> &a,
+    const std::vector<float> &interleaved)
+{
+    std::vector<float> c = Matmul(m, n * 2, k, a, interleaved);
+    std::vector<float> d(static_cast<size_t>(m) * n, 0.0f);
+    for (uint32_t blockStart = 0; blockStart < n * 2; blockStart += L1_N) {
+        uint32_t actualN = std::min(L1_N, n * 2 - blockStart);
+        uint32_t halfN = actualN / 2;
+        for (uint32_t i = 0; i < m; ++i) {
+            for (uint32_t j = 0; j < halfN; ++j) {
+                float gate = c[i * n * 2 + blockStart + j];
+                float up = c[i * n * 2 + blockStart + halfN + j];
+                d[i * n + blockStart / 2 + j] = golden::ComputeActivation(ActivationType::SILU, gate) * up;
+            }
+        }
+    }
+    return d;
+}
+
+void CheckBlockedSwiGlu(uint32_t m, uint32_t n, uint32_t k)
+{
+    auto a = HostTest::MakeData(static_cast<size_t>(m) * k, 0.0f, 1.0f, 1);
+    auto gate = HostTest::MakeData(static_cast<size_t>(k) * n, 0.0f, 0.5f, 2);
+    auto up = HostTest::MakeData(static_cast<size_t>(k) * n, 0.0f, 0.25f, 3);
+    auto interleaved = SwiGluWeight::InterleaveGateUp(k, n, PAIR_N, gate, up);
+
+    auto d = BlockedSwiGlu(m, n, k, a, interleaved);
+    auto gateOut = Matmul(m, n, k, a, gate);
+    auto upOut = Matmul(m, n, k, a, up);
+    for (size_t i = 0; i < d.size(); ++i) {
+        float expected = golden::ComputeActivation(ActivationType::SILU, gateOut[i]) * upOut[i];
+        CHECK(std::fabs(d[i] - expected) <= 1e-4f * (1.0f + std::fabs(expected)));
+    }
+}
+} // namespace
+
+HOST_TEST(InterleavedColumnIsABijection)
+{
+    for (uint32_t n : {PAIR_N, 3 * PAIR_N, 2 * PAIR_N + 40, 17u}) {
+        std::vector<uint32_t> hits(n * 2, 0);
+        for (uint32_t j = 0; j < n; ++j) {
+            uint32_t gateColumn = SwiGluWeight::InterleavedColumn(n, PAIR_N, j, false);
+            uint32_t upColumn = SwiGluWeight::InterleavedColumn(n, PAIR_N, j, true);
+            CHECK(gateColumn < n * 2);
+            CHECK(upColumn < n * 2);
+            ++hits[gateColumn];
+            ++hits[upColumn];
+            // Both projections of an output column stay in the same cube block
+            CHECK_EQ(gateColumn / L1_N, upColumn / L1_N);
+            CHECK_EQ(gateColumn / L1_N, j / PAIR_N);
+        }
+        for (uint32_t hit : hits) {
+            CHECK_EQ(hit, 1u);
+        }
+    }
+}
+
+HOST_TEST(BlockedSwiGluMatchesSeparateProjections)
+{
+    CheckBlockedSwiGlu(4, 2 * PAIR_N, 8);
+    // A shorter last pair, split in half by the kernel from the actual block width
+    CheckBlockedSwiGlu(3, PAIR_N + 24, 5);
+    CheckBlockedSwiGlu(2, 40, 3);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
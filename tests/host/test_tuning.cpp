@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+#include "test_common.hpp"
+#include "tuning/autotuner.hpp"
+#include "tuning/basic_matmul_configs.hpp"
+
+using namespace CatlassKernel::Tuning;
+
+HOST_TEST(DefaultConfigIsValid)
+{
+    CHECK(IsValidTileConfig(TileConfig{}, 2, 4));
+}
+
+HOST_TEST(RejectsOverBudgetConfigs)
+{
+    // L1: (256 * 512 + 512 * 256) * 2B * 2 stages = 1MB > 512KB
+    CHECK(!IsValidTileConfig(TileConfig{256, 256, 512, 64, 2, 3, 0}, 2, 4));
+    // L0A: 256 * 128 * 2B * 2 stages = 128KB > 64KB
+    CHECK(!IsValidTileConfig(TileConfig{256, 128, 256, 128, 2, 3, 0}, 2, 4));
+    // L0C: 256 * 256 * 4B = 256KB > 128KB
+    CHECK(!IsValidTileConfig(TileConfig{256, 256, 64, 32, 2, 3, 0}, 2, 4));
+}
+
+HOST_TEST(RejectsMisalignedConfigs)
+{
+    CHECK(!IsValidTileConfig(TileConfig{120, 256, 256, 64, 2, 3, 0}, 2, 4));
+    CHECK(!IsValidTileConfig(TileConfig{128, 256, 256, 96, 2, 3, 0}, 2, 4));
+    CHECK(!IsValidTileConfig(TileConfig{128, 256, 256, 8, 2, 3, 0}, 2, 4));
+    CHECK(!IsValidTileConfig(TileConfig{128, 256, 256, 64, 2, 0, 0}, 2, 4));
+    CHECK(!IsValidTileConfig(TileConfig{128, 256, 256, 64, 2, 3, 2}, 2, 4));
+}
+
+HOST_TEST(EnumerationOnlyYieldsValidConfigs)
+{
+    auto configs = EnumerateTileConfigs(2, 4, ArchBudget{}, {1, 2});
+    CHECK(!configs.empty());
+    for (auto const &config : configs) {
+        CHECK(IsValidTileConfig(config, 2, 4));
+    }
+    CHECK(std::find(configs.begin(), configs.end(), TileConfig{}) != configs.end());
+    auto sorted = configs;
+    std::sort(sorted.begin(), sorted.end());
+    CHECK(std::adjacent_find(sorted.begin(), sorted.end()) == sorted.end());
+}
+
+HOST_TEST(CompiledConfigsAreEnumerated)
+{
+    auto configs = EnumerateTileConfigs(2, 4);
+    for (size_t i = 0; i < BASIC_MATMUL_CONFIG_NUM; ++i) {
+        CHECK(std::find(configs.begin(), configs.end(), BASIC_MATMUL_CONFIGS[i]) != configs.end());
+    }
+    CHECK_EQ(DefaultBasicMatmulConfig(1024, 512).swizzleDirection, 0U);
+    CHECK_EQ(DefaultBasicMatmulConfig(512, 1024).swizzleDirection, 1U);
+}
+
+HOST_TEST(ShapeBucketRoundsUpToPowerOfTwo)
+{
+    CHECK_EQ(ShapeBucket(0), 16U);
+    CHECK_EQ(ShapeBucket(1), 16U);
+    CHECK_EQ(ShapeBucket(16), 16U);
+    CHECK_EQ(ShapeBucket(17), 32U);
+    CHECK_EQ(ShapeBucket(1000), 1024U);
+    CHECK_EQ(ShapeBucket(1024), 1024U);
+    CHECK(MakeTuningKey("op", 1, false, false, 1000, 33, 64) == MakeTuningKey("op", 1, false, false, 600, 64, 50));
+}
+
+HOST_TEST(DatabaseKeepsLatestRecord)
+{
+    TuningDatabase database;
+    auto key = MakeTuningKey(BASIC_MATMUL_OP_NAME, 1, false, false, 512, 512, 512);
+    database.Update(key, TuningRecord{BASIC_MATMUL_CONFIGS[2], 20.0});
+    CHECK(database.Find(key)->config == BASIC_MATMUL_CONFIGS[2]);
+    // A retune of a larger shape of the same bucket is slower in absolute terms, but still replaces the record.
+    database.Update(key, TuningRecord{BASIC_MATMUL_CONFIGS[3], 30.0});
+    CHECK(database.Find(key)->config == BASIC_MATMUL_CONFIGS[3]);
+    CHECK_EQ(database.Find(key)->timeUs, 30.0);
+    database.Update(key, TuningRecord{BASIC_MATMUL_CONFIGS[4], 10.0});
+    CHECK(database.Find(key)->config == BASIC_MATMUL_CONFIGS[4]);
+    CHECK_EQ(database.Size(), 1U);
+    CHECK(!database.Find(MakeTuningKey(BASIC_MATMUL_OP_NAME, 1, true, false, 512, 512, 512)).has_value());
+}
+
+HOST_TEST(DatabaseRoundTrip)
+{
+    const std::string path = "tuning_db_roundtrip.txt";
+    TuningDatabase database;
+    auto keyA = MakeTuningKey(BASIC_MATMUL_OP_NAME, 1, false, false, 4096, 128, 1024);
+    auto keyB = MakeTuningKey(BASIC_MATMUL_OP_NAME, 1, false, true, 64, 8192, 4096);
+    database.Update(keyA, TuningRecord{BASIC_MATMUL_CONFIGS[7], 12.5});
+    database.Update(keyB, TuningRecord{BASIC_MATMUL_CONFIGS[6], 40.25});
+    CHECK(database.Save(path));
+
+    TuningDatabase loaded;
+    CHECK(loaded.Load(path));
+    CHECK_EQ(loaded.Size(), 2U);
+    CHECK(loaded.Find(keyA)->config == BASIC_MATMUL_CONFIGS[7]);
+    CHECK(loaded.Find(keyB)->config == BASIC_MATMUL_CONFIGS[6]);
+    CHECK_EQ(loaded.Find(keyB)->timeUs, 40.25);
+    std::remove(path.c_str());
+}
+
+HOST_TEST(DatabaseRejectsOtherVersion)
+{
+    const std::string path = "tuning_db_version.txt";
+    {
+        std::ofstream file(path);
+        file << TuningDatabase::MAGIC << " " << TuningDatabase::VERSION + 1 << "\n";
+        file << "basic_matmul 1 0 0 512 512 512 128 128 256 64 2 3 0 10\n";
+    }
+    TuningDatabase database;
+    CHECK(!database.Load(path));
+    CHECK_EQ(database.Size(), 0U);
+    CHECK(!database.Load("tuning_db_missing.txt"));
+    std::remove(path.c_str());
+}
+
+HOST_TEST(TunePicksFastestAndSkipsFailures)
+{
+    std::vector<TileConfig> candidates(BASIC_MATMUL_CONFIGS, BASIC_MATMUL_CONFIGS + BASIC_MATMUL_CONFIG_NUM);
+    auto measure = [](TileConfig const &config) {
+        if (config.l1K == 512) {
+            return -1.0;
+        }
+        return static_cast<double>(config.l1M) + config.swizzleDirection;
+    };
+    TuningDatabase database;
+    auto key = MakeTuningKey(BASIC_MATMUL_OP_NAME, 1, false, false, 100, 100, 100);
+    auto best = TuneAndRecord(database, key, candidates, measure);
+    CHECK(best.has_value());
+    CHECK(best->config == BASIC_MATMUL_CONFIGS[6]);
+    CHECK_EQ(best->timeUs, 65.0);
+    CHECK(database.Find(key)->config == BASIC_MATMUL_CONFIGS[6]);
+
+    auto none = Tune(candidates, [](TileConfig const &) { return -1.0; });
+    CHECK(!none.has_value());
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
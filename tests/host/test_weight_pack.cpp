@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "pack/weight_pack.hpp"
+
+using namespace CatlassKernel::Pack;
+
+namespace {
+template <class T>
+std::vector<T> MakeMatrix(uint32_t rows, uint32_t cols)
+{
+    std::vector<T> data(static_cast<size_t>(rows) * cols);
+    for (size_t i = 0; i < data.size(); ++i) {
+        data[i] = static_cast<T>(i * 2654435761u + 1);
+    }
+    return data;
+}
+
+template <class T>
+bool RoundTrip(FractalFormat format, uint32_t rows, uint32_t cols, bool columnMajor)
+{
+    FractalLayout layout = MakeFractalLayout(format, rows, cols, sizeof(T));
+    std::vector<T> src = MakeMatrix<T>(rows, cols);
+    std::vector<T> packed(layout.Size(), static_cast<T>(0x5a));
+    std::vector<T> dst(src.size());
+    PackFractal(src.data(), columnMajor, layout, packed.data());
+    UnpackFractal(packed.data(), layout, columnMajor, dst.data());
+    return src == dst;
+}
+} // namespace
+
+HOST_TEST(PackRoundTripIsBitExact)
+{
+    for (FractalFormat format : {FractalFormat::ZN, FractalFormat::NZ}) {
+        for (bool columnMajor : {false, true}) {
+            CHECK(RoundTrip<uint16_t>(format, 1, 1, columnMajor));
+            CHECK(RoundTrip<uint16_t>(format, 37, 61, columnMajor));
+            CHECK(RoundTrip<uint16_t>(format, 256, 128, columnMajor));
+            CHECK(RoundTrip<uint8_t>(format, 45, 70, columnMajor));
+            CHECK(RoundTrip<uint32_t>(format, 19, 9, columnMajor));
+        }
+    }
+}
+
+HOST_TEST(ZnLayoutMatchesDeviceLayout)
+{
+    // half: C0 is 16 elements, a fractal is 16 x 16.
+    FractalLayout layout = MakeFractalLayout(FractalFormat::ZN, 40, 20, 2);
+    CHECK_EQ(layout.rowsRound, 48u);
+    CHECK_EQ(layout.colsRound, 32u);
+    CHECK_EQ(layout.Size(), size_t{48 * 32});
+    CHECK_EQ(layout.Offset(0, 1), size_t{1});
+    CHECK_EQ(layout.Offset(1, 0), size_t{16});
+    CHECK_EQ(layout.Offset(16, 0), size_t{256});
+    CHECK_EQ(layout.Offset(0, 16), size_t{48 * 16});
+    CHECK_EQ(layout.Offset(39, 19), size_t{2 * 256 + 48 * 16 + 7 * 16 + 3});
+}
+
+HOST_TEST(NzLayoutMatchesDeviceLayout)
+{
+    FractalLayout layout = MakeFractalLayout(FractalFormat::NZ, 40, 20, 2);
+    CHECK_EQ(layout.rowsRound, 48u);
+    CHECK_EQ(layout.colsRound, 32u);
+    CHECK_EQ(layout.Offset(1, 0), size_t{1});
+    CHECK_EQ(layout.Offset(0, 1), size_t{16});
+    CHECK_EQ(layout.Offset(0, 16), size_t{256});
+    CHECK_EQ(layout.Offset(16, 0), size_t{32 * 16});
+    CHECK_EQ(layout.Offset(39, 19), size_t{2 * 32 * 16 + 256 + 7 + 3 * 16});
+}
+
+HOST_TEST(Int8UsesWideC0)
+{
+    FractalLayout zn = MakeFractalLayout(FractalFormat::ZN, 20, 40, 1);
+    CHECK_EQ(zn.EleNumPerC0(), 32u);
+    CHECK_EQ(zn.rowsRound, 32u);
+    CHECK_EQ(zn.colsRound, 64u);
+    CHECK_EQ(zn.Offset(0, 32), size_t{32 * 32});
+    FractalLayout nz = MakeFractalLayout(FractalFormat::NZ, 20, 40, 1);
+    CHECK_EQ(nz.rowsRound, 32u);
+    CHECK_EQ(nz.colsRound, 48u);
+    CHECK_EQ(nz.Offset(0, 16), size_t{512});
+}
+
+HOST_TEST(PackZeroFillsPadding)
+{
+    FractalLayout layout = MakeFractalLayout(FractalFormat::ZN, 5, 7, 2);
+    std::vector<uint16_t> src(5 * 7, 0xffff);
+    std::vector<uint16_t> packed(layout.Size(), 0x1234);
+    PackFractal(src.data(), false, layout, packed.data());
+    size_t nonZero = 0;
+    for (uint16_t value : packed) {
+        nonZero += (value != 0);
+    }
+    CHECK_EQ(nonZero, src.size());
+    CHECK_EQ(packed[layout.Offset(4, 6)], 0xffff);
+    CHECK_EQ(packed[layout.Offset(5, 0)], 0);
+}
+
+HOST_TEST(PackedFormatFollowsTransB)
+{
+    CHECK(PackedFormatOfB(false) == FractalFormat::ZN);
+    CHECK(PackedFormatOfB(true) == FractalFormat::NZ);
+    CHECK_EQ(MakeFractalLayout(FractalFormat::ZN, 4, 4, 3).elementBytes, 0u);
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2025 Huawei Technologies Co., Ltd.
+ * This file is a part of the CANN Open Software.
+ * Licensed under CANN Open Software License Agreement Version 1.0 (the "License").
+ * Please refer to the License for details. You may not use this file except in compliance with the License.
+ * THIS SOFTWARE IS PROVIDED ON AN "AS IS" BASIS, WITHOUT WARRANTIES OF ANY KIND, EITHER EXPRESS OR IMPLIED,
+ * INCLUDING BUT NOT LIMITED TO NON-INFRINGEMENT, MERCHANTABILITY, OR FITNESS FOR A PARTICULAR PURPOSE.
+ * See LICENSE in the root of the software repository for the full text of the License.
+ */
+
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "test_common.hpp"
+#include "golden/weight_quant.hpp"
+
+using namespace Catlass;
+
+namespace {
+// Rows of a dequant tile of WeightOnlyQuantMatmul
+constexpr uint32_t DEQUANT_TILE_ROWS = 32;
+
+void CheckRoundTrip(uint32_t k, uint32_t n, uint32_t groupSize, uint32_t bits, bool symmetric)
+{
+    auto weight = HostTest::MakeData(static_cast<size_t>(k) * n, 0.0f, 4.0f, k * n);
+    std::vector<int8_t> quant;
+    std::vector<float> scale;
+    std::vector<float> zero;
+    golden::QuantizeWeightPerGroup(k, n, groupSize, bits, symmetric, weight, quant, scale, zero);
+
+    uint32_t groupNum = (k + groupSize - 1) / groupSize;
+    CHECK_EQ(scale.size(), static_cast<size_t>(groupNum) * n);
+    CHECK_EQ(zero.size(), symmetric ? 0 : static_cast<size_t>(groupNum) * n);
+    for (int8_t q : quant) {
+        CHECK(q >= golden::QuantMin(bits));
+        CHECK(q <= golden::QuantMax(bits));
+    }
+
+    std::vector<float> dequant;
+    golden::DequantizeWeightPerGroup(k, n, groupSize, quant, scale, zero, dequant);
+    for (uint32_t i = 0; i < k; ++i) {
+        for (uint32_t j = 0; j < n; ++j) {
+            size_t idx = static_cast<size_t>(i) * n + j;
+            float s = scale[static_cast<size_t>(i / groupSize) * n + j];
+            // Rounding error of half a step, plus the rounding of the zero point for asymmetric weights
+            float bound = symmetric ? 0.5f * s : s;
+            CHECK(std::fabs(dequant[idx] - weight[idx]) <= bound * 1.001f);
+        }
+    }
+}
+} // namespace
+
+HOST_TEST(PackInt4RoundTrip)
+{
+    std::vector<int8_t> quant;
+    for (int32_t low = -8; low <= 7; ++low) {
+        for (int32_t high = -8; high <= 7; ++high) {
+            quant.push_back(static_cast<int8_t>(low));
+            quant.push_back(static_cast<int8_t>(high));
+        }
+    }
+    uint32_t n = static_cast<uint32_t>(quant.size());
+    auto packed = golden::PackInt4(1, n, quant);
+    CHECK_EQ(packed.size(), quant.size() / 2);
+    // The even column is in the low nibble
+    CHECK_EQ(static_cast<uint8_t>(packed[1]), 0x98u);
+    CHECK(golden::UnpackInt4(1, n, packed) == quant);
+}
+
+HOST_TEST(QuantizeDequantizeWithinOneStep)
+{
+    for (uint32_t bits : {4u, 8u}) {
+        for (bool symmetric : {true, false}) {
+            CheckRoundTrip(256, 48, 64, bits, symmetric);
+            // A shorter last group
+            CheckRoundTrip(200, 30, 128, bits, symmetric);
+        }
+    }
+}
+
+HOST_TEST(ConstantGroupIsExact)
+{
+    uint32_t k = 64;
+    uint32_t n = 4;
+    std::vector<float> weight(static_cast<size_t>(k) * n, 0.0f);
+    std::vector<int8_t> quant;
+    std::vector<float> scale;
+    std::vector<float> zero;
+    golden::QuantizeWeightPerGroup(k, n, 32, 8, false, weight, quant, scale, zero);
+    std::vector<float> dequant;
+    golden::DequantizeWeightPerGroup(k, n, 32, quant, scale, zero, dequant);
+    for (float w : dequant) {
+        CHECK_EQ(w, 0.0f);
+    }
+}
+
+HOST_TEST(DequantTilesStayWithinAGroup)
+{
+    // The kernel loads one scale row per tile of DEQUANT_TILE_ROWS rows, which must match every row of the tile
+    for (uint32_t groupSize : {32u, 64u, 128u}) {
+        for (uint32_t k : {32u, 100u, 1000u}) {
+            for (uint32_t rowOffset = 0; rowOffset < k; rowOffset += DEQUANT_TILE_ROWS) {
+                uint32_t rowEnd = std::min(k, rowOffset + DEQUANT_TILE_ROWS);
+                for (uint32_t row = rowOffset; row < rowEnd; ++row) {
+                    CHECK_EQ(row / groupSize, rowOffset / groupSize);
+                }
+            }
+        }
+    }
+}
+
+int main()
+{
+    return HostTest::RunAll();
+}
@@ -13,4 +13,9 @@ pip uninstall torch_catlass
 
 # torch lib
 bash "$BUILD_SCRIPT_PATH" --clean torch_library || exit 1
-python3 "$SCRIPT_PATH/test_torch_lib.py"
\ No newline at end of file
+python3 "$SCRIPT_PATH/test_torch_lib.py"
+
+# host unit tests
+cmake -S "$SCRIPT_PATH/host" -B "$SCRIPT_PATH/../build/host_tests" || exit 1
+cmake --build "$SCRIPT_PATH/../build/host_tests" -j || exit 1
+ctest --test-dir "$SCRIPT_PATH/../build/host_tests" --output-on-failure || exit 1
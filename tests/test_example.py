@@ -74,7 +74,18 @@ normal_cases = ["00_basic_matmul 256 512 1024 0",
                 "15_gemm 256 512 1024 0",
                 "16_group_gemm 3 '128,256,512' '256,512,128' '512,256,128' 0",
                 "17_gemv_aiv 256 512 0",
-                "18_gemv_aic 256 512 0"]
+                "18_gemv_aic 256 512 0",
+                "20_matmul_bias_activation 256 512 1024 0",
+                "21_matmul_visitor_epilogue 256 512 1024 0",
+                "22_matmul_residual_norm 256 1024 1024 1 0",
+                "23_grouped_matmul_slice_m_swiglu 8 1024 768 2048 0",
+                "24_weight_only_quant_matmul 16 4096 4096 4 128 0",
+                "25_quant_matmul_per_group 256 1024 2048 128 0",
+                "26_dynamic_quant_matmul 256 1024 4096 0",
+                "27_int4_matmul 256 512 4096 0",
+                "28_requant_matmul 256 512 1024 1 0",
+                "29_skinny_matmul 8 4096 4096 0",
+                "30_gemv_aiv_split_k 32 65536 0 0"]
 
 
 def set_case(case: str):